@@ -69,6 +69,7 @@ set(BS_BANSHEECORE_INC_SCENE
 	"Include/BsGameObjectManager.h"
 	"Include/BsSceneObject.h"
 	"Include/BsCoreSceneManager.h"
+	"Include/BsSceneTransformStore.h"
 	"Include/BsPrefab.h"
 	"Include/BsPrefabDiff.h"
 	"Include/BsPrefabUtility.h"
@@ -191,6 +192,7 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsTexture.h"
 	"Include/BsResources.h"
 	"Include/BsResourceManifest.h"
+	"Include/BsResourcePackage.h"
 	"Include/BsResourceHandle.h"
 	"Include/BsResource.h"
 	"Include/BsPixelData.h"
@@ -355,6 +357,7 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsResource.cpp"
 	"Source/BsResourceHandle.cpp"
 	"Source/BsResourceManifest.cpp"
+	"Source/BsResourcePackage.cpp"
 	"Source/BsResources.cpp"
 	"Source/BsTexture.cpp"
 	"Source/BsTextureManager.cpp"
@@ -469,6 +472,7 @@ set(BS_BANSHEECORE_SRC_SCENE
 	"Source/BsGameObjectManager.cpp"
 	"Source/BsSceneObject.cpp"
 	"Source/BsCoreSceneManager.cpp"
+	"Source/BsSceneTransformStore.cpp"
 	"Source/BsPrefab.cpp"
 	"Source/BsPrefabDiff.cpp"
 	"Source/BsPrefabUtility.cpp"
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsAsyncOp.h"
 #include <functional>
+#include <atomic>
 
 namespace BansheeEngine
 {
@@ -14,7 +15,7 @@ namespace BansheeEngine
 
 	/**
 	 * Command queue policy that provides no synchonization. Should be used with command queues that are used on a single 
-	 * thread only.
+	 * thread only. Queue operations never lock. Used by the per-thread core accessors.
 	 */
 	class CommandQueueNoSync
 	{
@@ -33,7 +34,8 @@ namespace BansheeEngine
 
 	/**
 	 * Command queue policy that provides synchonization. Should be used with command queues that are used on multiple 
-	 * threads.
+	 * threads. Every queue operation, including queuing a single command, takes the queue mutex. Used by the core thread's
+	 * own command queue and by synced core accessors.
 	 */
 	class CommandQueueSync
 	{
@@ -64,75 +66,175 @@ namespace BansheeEngine
 	};
 
 	/**
-	 * Represents a single queued command in the command list. Contains all the data for executing the command and checking 
-	 * up on the command status.
+	 * Header of a single command stored in a QueuedCommandBuffer. Contains all the data for executing the command and 
+	 * checking up on the command status. The callable the command executes is constructed in place directly after the
+	 * header.
 	 */
 	struct QueuedCommand
 	{
-#if BS_DEBUG_MODE
-		QueuedCommand(std::function<void(AsyncOp&)> _callback, UINT32 _debugId, const SPtr<AsyncOpSyncData>& asyncOpSyncData,
-			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: debugId(_debugId), callbackWithReturnValue(_callback), asyncOp(asyncOpSyncData), returnsValue(true)
-			, callbackId(_callbackId), notifyWhenComplete(_notifyWhenComplete)
-		{ }
+		typedef void(*ExecuteFunc)(void*, AsyncOp&);
+		typedef void(*DestroyFunc)(void*);
 
-		QueuedCommand(std::function<void()> _callback, UINT32 _debugId, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			:debugId(_debugId), callback(_callback), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
-			, notifyWhenComplete(_notifyWhenComplete)
-		{ }
-
-		UINT32 debugId;
-#else
-		QueuedCommand(std::function<void(AsyncOp&)> _callback, const SPtr<AsyncOpSyncData>& asyncOpSyncData, 
-			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			:callbackWithReturnValue(_callback), returnsValue(true), notifyWhenComplete(_notifyWhenComplete), 
-			callbackId(_callbackId), asyncOp(asyncOpSyncData)
+		QueuedCommand(const AsyncOp& _asyncOp, bool _returnsValue, bool _notifyWhenComplete, UINT32 _callbackId)
+			:execute(nullptr), destroy(nullptr), size(0), callbackId(_callbackId), asyncOp(_asyncOp)
+			, returnsValue(_returnsValue), notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
-		QueuedCommand(std::function<void()> _callback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			:callback(_callback), returnsValue(false), notifyWhenComplete(_notifyWhenComplete), callbackId(_callbackId), asyncOp(AsyncOpEmpty())
-		{ }
-#endif
+		/** Executes a callable of type T that doesn't return a value. */
+		template<class T>
+		static void executeCallable(void* callable, AsyncOp& asyncOp)
+		{
+			(*(T*)callable)();
+		}
 
-		~QueuedCommand()
-		{ }
+		/** Executes a callable of type T that reports its return value through the provided async operation. */
+		template<class T>
+		static void executeReturnCallable(void* callable, AsyncOp& asyncOp)
+		{
+			(*(T*)callable)(asyncOp);
+		}
 
-		QueuedCommand(const QueuedCommand& source)
+		/** Destroys a callable of type T, without freeing its memory. */
+		template<class T>
+		static void destroyCallable(void* callable)
 		{
-			callback = source.callback;
-			callbackWithReturnValue = source.callbackWithReturnValue;
-			asyncOp = source.asyncOp;
-			returnsValue = source.returnsValue;
-			callbackId = source.callbackId;
-			notifyWhenComplete = source.notifyWhenComplete;
+			((T*)callable)->~T();
+		}
 
+		ExecuteFunc execute;
+		DestroyFunc destroy;
+		UINT32 size; /**< Size of the command in bytes, including the header and the callable. */
+		UINT32 callbackId;
 #if BS_DEBUG_MODE
-			debugId = source.debugId;
+		UINT32 debugId;
 #endif
+		AsyncOp asyncOp;
+		bool returnsValue;
+		bool notifyWhenComplete;
+	};
+
+	/**
+	 * Stores a list of queued commands in a linear byte arena. Commands (and the callables they execute) are constructed 
+	 * in place, so queuing a command doesn't require any heap allocations once the buffer has been warmed up. The memory is 
+	 * retained when the buffer is cleared, so buffers should be reused rather than recreated.
+	 */
+	class BS_CORE_EXPORT QueuedCommandBuffer
+	{
+		/** Contiguous block of memory that commands get allocated from. */
+		struct Block
+		{
+			UINT8* data;
+			UINT32 capacity;
+			UINT32 used;
+		};
+
+	public:
+		QueuedCommandBuffer();
+		~QueuedCommandBuffer();
+
+		/**
+		 * Constructs a new command at the end of the buffer.
+		 *
+		 * @tparam		RETURNS_VALUE		True if the command reports a return value through @p asyncOp.
+		 * @param[in]	callable			Callable to execute when the command is played back. Must be callable with no 
+		 *									parameters, or with an AsyncOp& parameter if @p RETURNS_VALUE is true.
+		 * @param[in]	asyncOp				Async operation used for reporting the return value of the callable.
+		 * @param[in]	notifyWhenComplete	Whether to call the notify callback when the command finishes executing.
+		 * @param[in]	callbackId			Identifier passed to the notify callback.
+		 * @return							Newly constructed command header.
+		 */
+		template<bool RETURNS_VALUE, class T>
+		QueuedCommand* push(T&& callable, const AsyncOp& asyncOp, bool notifyWhenComplete, UINT32 callbackId)
+		{
+			typedef typename std::decay<T>::type CallableType;
+			static_assert(std::alignment_of<CallableType>::value <= COMMAND_ALIGNMENT, 
+				"Command callable requires larger alignment than the command buffer provides.");
+
+			UINT32 size = HEADER_SIZE + align((UINT32)sizeof(CallableType));
+			UINT8* data = allocate(size);
+
+			QueuedCommand* command = new (data) QueuedCommand(asyncOp, RETURNS_VALUE, notifyWhenComplete, callbackId);
+			new (data + HEADER_SIZE) CallableType(std::forward<T>(callable));
+
+			command->execute = getExecuteFunc<CallableType>(std::integral_constant<bool, RETURNS_VALUE>());
+			command->destroy = &QueuedCommand::destroyCallable<CallableType>;
+			command->size = size;
+
+			mNumCommands++;
+			return command;
 		}
 
-		QueuedCommand& operator=(const QueuedCommand& rhs)
+		/** Destroys all the commands in the buffer without executing them. Allocated memory is retained. */
+		void clear();
+
+		/** Returns the number of commands in the buffer. */
+		UINT32 getNumCommands() const { return mNumCommands; }
+
+		/** Returns true if there are no commands in the buffer. */
+		bool isEmpty() const { return mNumCommands == 0; }
+
+	private:
+		friend class CommandQueueBase;
+
+		/** Alignment of every command header and callable in the buffer. */
+		static const UINT32 COMMAND_ALIGNMENT = 16;
+
+		/** Size of a single memory block. Commands larger than this will get a block of their own. */
+		static const UINT32 BLOCK_SIZE = 64 * 1024;
+
+		/** Offset of a callable relative to the start of its command. */
+		static const UINT32 HEADER_SIZE = (sizeof(QueuedCommand) + COMMAND_ALIGNMENT - 1) & ~(COMMAND_ALIGNMENT - 1);
+
+		/** Rounds the provided size up to command alignment. */
+		static UINT32 align(UINT32 size) { return (size + COMMAND_ALIGNMENT - 1) & ~(COMMAND_ALIGNMENT - 1); }
+
+		/** Returns the method used for executing a callable of type T that doesn't return a value. */
+		template<class T>
+		static QueuedCommand::ExecuteFunc getExecuteFunc(std::false_type) { return &QueuedCommand::executeCallable<T>; }
+
+		/** Returns the method used for executing a callable of type T that returns a value through an AsyncOp. */
+		template<class T>
+		static QueuedCommand::ExecuteFunc getExecuteFunc(std::true_type) { return &QueuedCommand::executeReturnCallable<T>; }
+
+		/** Returns a pointer to the callable belonging to the provided command. */
+		static void* getCallable(QueuedCommand* command) { return (UINT8*)command + HEADER_SIZE; }
+
+		/** Allocates room for a new command of the specified size, allocating a new block if needed. */
+		UINT8* allocate(UINT32 size);
+
+		/** 
+		 * Calls the provided function on every command in the buffer in the order they were queued, destroying each command 
+		 * after the call. Buffer is empty when the method returns.
+		 */
+		template<class T>
+		void consume(T func)
 		{
-			callback = rhs.callback;
-			callbackWithReturnValue = rhs.callbackWithReturnValue;
-			asyncOp = rhs.asyncOp;
-			returnsValue = rhs.returnsValue;
-			callbackId = rhs.callbackId;
-			notifyWhenComplete = rhs.notifyWhenComplete;
-			
-#if BS_DEBUG_MODE
-			debugId = rhs.debugId;
-#endif
+			for (UINT32 i = 0; i < (UINT32)mBlocks.size(); i++)
+			{
+				Block& block = mBlocks[i];
+
+				UINT32 offset = 0;
+				while (offset < block.used)
+				{
+					QueuedCommand* command = (QueuedCommand*)(block.data + offset);
+					offset += command->size;
 
-			return *this;
+					func(*command);
+
+					command->destroy(getCallable(command));
+					command->~QueuedCommand();
+				}
+
+				block.used = 0;
+			}
+
+			mActiveBlock = 0;
+			mNumCommands = 0;
 		}
 
-		std::function<void()> callback;
-		std::function<void(AsyncOp&)> callbackWithReturnValue;
-		AsyncOp asyncOp;
-		bool returnsValue;
-		UINT32 callbackId;
-		bool notifyWhenComplete;
+		Vector<Block> mBlocks;
+		UINT32 mActiveBlock;
+		UINT32 mNumCommands;
 	};
 
 	/** Manages a list of commands that can be queued for later execution on the core thread. */
@@ -162,10 +264,10 @@ namespace BansheeEngine
 		 * @param[in]	notifyCallback  	Callback that will be called if a command that has @p notifyOnComplete flag set.
 		 * 									The callback will receive @p callbackId of the command.
 		 */
-		void playbackWithNotify(Queue<QueuedCommand>* commands, std::function<void(UINT32)> notifyCallback);
+		void playbackWithNotify(QueuedCommandBuffer* commands, std::function<void(UINT32)> notifyCallback);
 
 		/** Executes all provided commands one by one in order. To get the commands you should call flush(). */
-		void playback(Queue<QueuedCommand>* commands);
+		void playback(QueuedCommandBuffer* commands);
 
 		/**
 		 * Allows you to set a breakpoint that will trigger when the specified command is executed.		
@@ -200,7 +302,16 @@ namespace BansheeEngine
 		 * Callback method also needs to call AsyncOp::markAsResolved once it is done processing. (If it doesn't it will 
 		 * still be called automatically, but the return value will default to nullptr)
 		 */
-		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+		template<class T>
+		AsyncOp queueReturn(T&& commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		{
+			AsyncOp asyncOp(mAsyncOpSyncData);
+			QueuedCommand* command = mCommands->push<true>(std::forward<T>(commandCallback), asyncOp, _notifyWhenComplete, 
+				_callbackId);
+
+			onCommandQueued(command);
+			return asyncOp;
+		}
 
 		/**
 		 * Queue up a new command to execute. Make sure the provided function has all of its parameters properly bound. 
@@ -213,13 +324,24 @@ namespace BansheeEngine
 		 * @param[in]	_callbackId		   	(optional) Identifier for the callback so you can then later find
 		 * 									it if needed.
 		 */
-		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+		template<class T>
+		void queue(T&& commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		{
+			QueuedCommand* command = mCommands->push<false>(std::forward<T>(commandCallback), AsyncOp(AsyncOpEmpty()), 
+				_notifyWhenComplete, _callbackId);
+
+			onCommandQueued(command);
+		}
 
 		/**
 		 * Returns a copy of all queued commands and makes room for new ones. Must be called from the thread that created 
 		 * the command queue. Returned commands must be passed to playback() method.
+		 *
+		 * @note	
+		 * Command buffers are recycled once played back, so in steady state this only swaps between already allocated
+		 * buffers.
 		 */
-		Queue<QueuedCommand>* flush();
+		QueuedCommandBuffer* flush();
 
 		/** Cancels all currently queued commands. */
 		void cancelAll();
@@ -235,8 +357,33 @@ namespace BansheeEngine
 		void throwInvalidThreadException(const String& message) const;
 
 	private:
-		Queue<QueuedCommand>* mCommands;
-		Stack<Queue<QueuedCommand>*> mEmptyCommandQueues; /**< List of empty queues for reuse. */
+		/** Maximum number of played back command buffers kept around for reuse. */
+		static const UINT32 MAX_FREE_BUFFERS = 4;
+
+		/** Assigns debug information to a newly queued command, and executes it immediately if required. */
+		void onCommandQueued(QueuedCommand* command);
+
+		/** 
+		 * Returns an empty command buffer, either one previously played back or a newly allocated one. Called from the 
+		 * thread that flushes the queue.
+		 */
+		QueuedCommandBuffer* acquireBuffer();
+
+		/** 
+		 * Returns a played back command buffer so it can be reused by acquireBuffer(). Called from the thread that plays back
+		 * the commands.
+		 */
+		void releaseBuffer(QueuedCommandBuffer* buffer);
+
+		QueuedCommandBuffer* mCommands;
+
+		/** 
+		 * Single producer/single consumer ring of played back buffers. Playback thread produces, flushing thread consumes,
+		 * so no locking is needed when moving buffers between them.
+		 */
+		QueuedCommandBuffer* mFreeBuffers[MAX_FREE_BUFFERS];
+		std::atomic<UINT32> mFreeBuffersHead;
+		std::atomic<UINT32> mFreeBuffersTail;
 
 		SPtr<AsyncOpSyncData> mAsyncOpSyncData;
 		ThreadId mMyThreadId;
@@ -285,6 +432,10 @@ namespace BansheeEngine
 	 * 			
 	 * Use SyncPolicy to choose whether you want command queue be synchonized or not. Synchonized command queues may be 
 	 * used across multiple threads and non-synchonized only on one.
+	 *
+	 * @note
+	 * Storing commands in a QueuedCommandBuffer removes heap allocations from queuing, but has no effect on locking, which
+	 * is determined by SyncPolicy alone. Only moving played back buffers between threads is lock-free.
 	 */
 	template<class SyncPolicy = CommandQueueNoSync>
 	class CommandQueue : public CommandQueueBase, public SyncPolicy
@@ -299,7 +450,8 @@ namespace BansheeEngine
 		{ }
 
 		/** @copydoc CommandQueueBase::queueReturn */
-		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		template<class T>
+		AsyncOp queueReturn(T&& commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
 		{
 #if BS_DEBUG_MODE
 #if BS_THREAD_SUPPORT != 0
@@ -309,14 +461,15 @@ namespace BansheeEngine
 #endif
 
 			this->lock();
-			AsyncOp asyncOp = CommandQueueBase::queueReturn(commandCallback, _notifyWhenComplete, _callbackId);
+			AsyncOp asyncOp = CommandQueueBase::queueReturn(std::forward<T>(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 
 			return asyncOp;
 		}
 
 		/** @copydoc CommandQueueBase::queue */
-		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		template<class T>
+		void queue(T&& commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
 		{
 #if BS_DEBUG_MODE
 #if BS_THREAD_SUPPORT != 0
@@ -326,12 +479,12 @@ namespace BansheeEngine
 #endif
 
 			this->lock();
-			CommandQueueBase::queue(commandCallback, _notifyWhenComplete, _callbackId);
+			CommandQueueBase::queue(std::forward<T>(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 		}
 
 		/** @copydoc CommandQueueBase::flush */
-		BansheeEngine::Queue<QueuedCommand>* flush()
+		QueuedCommandBuffer* flush()
 		{
 #if BS_DEBUG_MODE
 #if BS_THREAD_SUPPORT != 0
@@ -341,7 +494,7 @@ namespace BansheeEngine
 #endif
 
 			this->lock();
-			BansheeEngine::Queue<QueuedCommand>* commands = CommandQueueBase::flush();
+			QueuedCommandBuffer* commands = CommandQueueBase::flush();
 			this->unlock();
 
 			return commands;
@@ -26,12 +26,25 @@ namespace BansheeEngine
 		HComponent getHandle() const { return mThisHandle; }
 
 		/**
-		 * Called once per frame on all components.
+		 * Called once per frame on all active components.
+		 *
+		 * Components are updated grouped by type rather than in scene hierarchy order. All components of one type are
+		 * updated before any component of the next type. The order of types, and of components within a type, is 
+		 * undefined. Don't rely on a parent object's components being updated before the components of its children.
 		 * 			
 		 * @note	Internal method.
 		 */
 		virtual void update() { }
 
+		/**
+		 * Determines if update() of this component type may be called from multiple threads at once, for different
+		 * components. Such components must not access any state other than their own during update() (including creating
+		 * or destroying scene objects and components). Should return the same value for all components of the same type.
+		 *
+		 * @note	Internal method.
+		 */
+		virtual bool isUpdateThreadSafe() const { return false; }
+
 		/**
 		 * Calculates bounds of the visible contents represented by this component (for example a mesh for Renderable).
 		 * 
@@ -61,6 +74,7 @@ namespace BansheeEngine
 	protected:
 		friend class SceneObject;
 		friend class SceneObjectRTTI;
+		friend class CoreSceneManager;
 
 		Component(const HSceneObject& parent);
 		virtual ~Component();
@@ -112,6 +126,9 @@ namespace BansheeEngine
 	private:
 		HSceneObject mParent;
 
+		UINT32 mUpdateListIdx; /**< Index of the per-type update list the component is in, in CoreSceneManager. */
+		UINT32 mUpdateIdx; /**< Index of the component within its update list, or -1 if not registered for updates. */
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -121,7 +138,9 @@ namespace BansheeEngine
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		Component() {} // Serialization only
+		Component() // Serialization only
+			:mUpdateListIdx((UINT32)-1), mUpdateIdx((UINT32)-1)
+		{ }
 	};
 
 	/** @} */
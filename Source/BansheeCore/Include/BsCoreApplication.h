@@ -26,6 +26,22 @@ namespace BansheeEngine
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
+
+		/**
+		 * Number of frames the sim thread is allowed to run ahead of the core thread. Higher values allow the two threads
+		 * to overlap better (frame time approaches the slower of the two instead of their sum) at the cost of input 
+		 * latency and memory used for queued frame data. Clamped to [1, CoreThread::MAX_FRAMES_IN_FLIGHT].
+		 */
+		UINT32 maxFramesInFlight = 1;
+	};
+
+	/** Contains statistics about how often the sim thread had to wait on the core thread. */
+	struct FramePipelineStats
+	{
+		UINT64 numFrames = 0; /**< Total number of frames submitted to the core thread. */
+		UINT64 numStalls = 0; /**< Number of frames during which the sim thread had to wait on the core thread. */
+		UINT64 totalStallTime = 0; /**< Total time the sim thread spent waiting on the core thread, in microseconds. */
+		UINT64 lastStallTime = 0; /**< Time the sim thread spent waiting on the core thread last frame, in microseconds. */
 	};
 
 	/**
@@ -70,6 +86,14 @@ namespace BansheeEngine
 			 */
 			ThreadId getSimThreadId() { return mSimThreadId; }
 
+			/** 
+			 * Returns statistics about how often the sim thread had to wait for the core thread to finish a frame before
+			 * it could queue a new one.
+			 *
+			 * @note	Sim thread only.
+			 */
+			const FramePipelineStats& getFramePipelineStats() const { return mFramePipelineStats; }
+
 			/**	Returns true if the application is running in an editor, false if standalone. */
 			virtual bool isEditor() const { return false; }
 
@@ -106,6 +130,16 @@ namespace BansheeEngine
 		/**	Called when the frame finishes rendering. */
 		void frameRenderingFinishedCallback();
 
+		/** 
+		 * Blocks the sim thread until there are less than @p maxFramesInFlight frames queued on the core thread. Returns
+		 * the time spent waiting, in microseconds.
+		 *
+		 * @param[in]	maxFramesInFlight	Maximum number of frames allowed to be queued on the core thread.
+		 * @param[in]	profile				If true the wait is recorded as a CPU profiler sample. Must be false when called 
+		 *									outside of ProfilerCPU::beginThread()/ProfilerCPU::endThread().
+		 */
+		UINT64 waitForCoreThread(UINT32 maxFramesInFlight, bool profile = true);
+
 		/**	Called by the core thread to begin profiling. */
 		void beginCoreProfiling();
 
@@ -125,7 +159,9 @@ namespace BansheeEngine
 
 		Map<DynLib*, UpdatePluginFunc> mPluginUpdateFunctions;
 
-		bool mIsFrameRenderingFinished;
+		UINT32 mMaxFramesInFlight;
+		UINT32 mNumFramesInFlight;
+		FramePipelineStats mFramePipelineStats;
 		Mutex mFrameRenderingFinishedMutex;
 		Signal mFrameRenderingFinishedCondition;
 		ThreadId mSimThreadId;
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsCoreObjectCore.h"
 #include "BsModule.h"
+#include "BsSpinLock.h"
 
 namespace BansheeEngine
 {
@@ -56,9 +57,26 @@ namespace BansheeEngine
 		struct DirtyObjectData
 		{
 			CoreObject* object;
+			UINT64 internalId;
 			INT32 syncDataId;
 		};
 
+		/** 
+		 * List of objects that were marked as dirty on a single thread. Only the owning thread adds to the list, while the
+		 * list is emptied once per frame by syncDownload(), so the lock is virtually never contended.
+		 *
+		 * @note
+		 * A spin lock is used instead of a lock-free queue on purpose. Acquiring an uncontended spin lock is a single atomic
+		 * exchange, which costs the same as the compare-and-swap a lock-free push needs. In exchange the entries stay in 
+		 * a contiguous vector whose memory is reused every frame, while a lock-free queue would need to allocate its nodes
+		 * or handle a full ring buffer.
+		 */
+		struct ThreadDirtyList
+		{
+			SpinLock lock;
+			Vector<DirtyObjectData> entries;
+		};
+
 	public:
 		CoreObjectManager();
 		~CoreObjectManager();
@@ -125,14 +143,36 @@ namespace BansheeEngine
 		 */
 		void updateDependencies(CoreObject* object, Vector<CoreObject*>* dependencies);
 
+		/** Returns the dirty list belonging to the calling thread, creating it if needed. */
+		ThreadDirtyList* getThreadDirtyList();
+
+		/** 
+		 * Moves the contents of all per-thread dirty lists into @p output, skipping objects that were destroyed since the 
+		 * last sync. Caller must hold mObjectsMutex.
+		 */
+		void collectDirtyObjects(Vector<DirtyObjectData>& output);
+
+		UINT32 mId;
 		UINT64 mNextAvailableID;
 		Map<UINT64, CoreObject*> mObjects;
-		Map<UINT64, DirtyObjectData> mDirtyObjects;
 		Map<UINT64, Vector<CoreObject*>> mDependencies;
 		Map<UINT64, Vector<CoreObject*>> mDependants;
 
+		Vector<ThreadDirtyList*> mThreadDirtyLists;
+		Vector<DirtyObjectData> mDirtyObjects; /**< Scratch list used during syncDownload(), kept to avoid reallocations. */
+		Vector<DirtyObjectData> mDestroyedDirtyObjects; /**< Objects destroyed while dirty, along with their sync data. */
+		UnorderedSet<UINT64> mDestroyedObjects; /**< Ids of all objects destroyed since the last sync. */
+		Mutex mThreadDirtyListsMutex;
+
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
-		List<CoreStoredSyncData> mCoreSyncData;
+
+		/** 
+		 * Ring buffer of sync data, one entry per frame queued on the core thread. Entries are reused so their entry lists
+		 * don't need to be reallocated every frame. Grows if more frames are queued than there are entries.
+		 */
+		Vector<CoreStoredSyncData> mCoreSyncData;
+		UINT32 mCoreSyncDataStart;
+		UINT32 mNumCoreSyncData;
 
 		Mutex mObjectsMutex;
 	};
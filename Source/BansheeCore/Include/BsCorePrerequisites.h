@@ -198,6 +198,7 @@
 namespace BansheeEngine 
 {
 	static const StringID RenderAPIAny = "AnyRenderAPI";
+	static const StringID RenderAPINull = "NullRenderAPI";
 	static const StringID RendererAny = "AnyRenderer";
 
     class Color;
@@ -358,6 +359,8 @@ namespace BansheeEngine
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class SavedResourceData;
+	class ResourcePackage;
 	class Texture;
 	class Mesh;
 	class MeshBase;
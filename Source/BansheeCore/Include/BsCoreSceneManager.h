@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
 #include "BsGameObject.h"
+#include "BsSceneTransformStore.h"
 
 namespace BansheeEngine
 {
@@ -18,6 +19,15 @@ namespace BansheeEngine
 	 */
 	class BS_CORE_EXPORT CoreSceneManager : public Module<CoreSceneManager>
 	{
+		/** Contains all active components of a single type. */
+		struct ComponentUpdateList
+		{
+			UINT32 typeId;
+			bool threadSafe;
+			bool hasRemovals;
+			Vector<Component*> components;
+		};
+
 	public:
 		CoreSceneManager();
 		virtual ~CoreSceneManager();
@@ -35,12 +45,31 @@ namespace BansheeEngine
 		/** Changes the root scene object. Any persistent objects will remain in the scene, now parented to the new root. */
 		void _setRootNode(const HSceneObject& root);
 
-		/** Called every frame. Calls update methods on all scene objects and their components. */
+		/**
+		 * Called every frame. Calls update methods on all active components in the scene. Components are updated type by
+		 * type, and components of types that report themselves as thread safe are updated in parallel.
+		 */
 		virtual void _update();
 
+		/** Registers a component for updates. Called whenever a component gets enabled. */
+		void _notifyComponentActivated(Component* component);
+
+		/** Unregisters a component from updates. Called whenever a component gets disabled or destroyed. */
+		void _notifyComponentDeactivated(Component* component);
+
+		/** 
+		 * Recalculates world transforms of all scene objects whose transform (or the transform of their parents) changed
+		 * since the last call, and notifies components of children whose parents moved. Should be called at least once 
+		 * per frame, after all scene objects have been updated. Calling it more often is cheap if nothing changed.
+		 */
+		void _updateTransforms();
+
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
 		virtual void _updateCoreObjectTransforms() { }
 
+		/** Returns the store containing transforms of all scene objects in the scene. */
+		SceneTransformStore& _getTransformStore() { return mTransformStore; }
+
 	protected:
 		friend class SceneObject;
 
@@ -57,8 +86,19 @@ namespace BansheeEngine
 		 */
 		void registerNewSO(const HSceneObject& node);
 
+		/** Removes null entries left in update lists by components deactivated during _update(). */
+		void compactUpdateLists();
+
 	protected:
+		/** Minimum number of components of a thread safe type required before they are updated in parallel. */
+		static const UINT32 PARALLEL_UPDATE_THRESHOLD = 256;
+
 		HSceneObject mRootNode;
+		SceneTransformStore mTransformStore;
+
+		Vector<ComponentUpdateList> mUpdateLists;
+		UnorderedMap<UINT32, UINT32> mUpdateListLookup; /**< Maps component RTTI type ids to indices in mUpdateLists. */
+		bool mIsUpdating;
 	};
 
 	/**
@@ -50,12 +50,24 @@ namespace BansheeEngine
 		};
 
 public:
-	CoreThread();
+	/** Maximum number of frames the sim thread is allowed to queue on the core thread before waiting for it. */
+	static const UINT32 MAX_FRAMES_IN_FLIGHT = 3;
+
+	/**
+	 * Constructor.
+	 *
+	 * @param[in]	maxFramesInFlight	Number of frames the sim thread may queue on the core thread before it has to 
+	 *									wait for the core thread to finish one. Clamped to [1, MAX_FRAMES_IN_FLIGHT].
+	 */
+	CoreThread(UINT32 maxFramesInFlight = 1);
 	~CoreThread();
 
 	/** Returns the id of the core thread.  */
 	ThreadId getCoreThreadId() { return mCoreThreadId; }
 
+	/** Returns the number of frames the sim thread is allowed to queue on the core thread. */
+	UINT32 getMaxFramesInFlight() const { return mNumFrameAllocs - 1; }
+
 	/**
 	 * Creates or retrieves an accessor that you can use for executing commands on the core thread from a non-core thread. 
 	 * The accessor will be bound to the thread you call this method on.
@@ -109,27 +121,30 @@ public:
 	void queueCommand(std::function<void()> commandCallback, bool blockUntilComplete = false);
 
 	/**
-	 * Called once every frame.
+	 * Called once every frame. Switches to the next frame allocator and clears it.
 	 * 			
 	 * @note	Must be called before sim thread schedules any core thread operations for the frame. 
+	 * @note	Must only be called once the core thread finished the frame queued getMaxFramesInFlight() frames ago.
 	 */
 	void update();
 
 	/**
 	 * Returns a frame allocator that should be used for allocating temporary data being passed to the core thread. As the 
-	 * name implies the data only lasts one frame, so you need to be careful not to use it for longer than that.
+	 * name implies the data only lasts one frame, so you need to be careful not to use it for longer than that. (The 
+	 * allocator is only cleared once the core thread is done with the frame, so data lasts until then.)
 	 * 			
 	 * @note	Sim thread only.
 	 */
 	FrameAlloc* getFrameAlloc() const;
 private:
-	static const int NUM_FRAME_ALLOCS = 2;
+	static const UINT32 NUM_FRAME_ALLOCS = MAX_FRAMES_IN_FLIGHT + 1;
 
 	/**
-	 * Double buffered frame allocators. Means sim thread cannot be more than 1 frame ahead of core thread (If that changes
-	 * you should be able to easily add more).
+	 * Ring of frame allocators, one for each frame that may be in flight on the core thread plus one for the frame
+	 * the sim thread is currently working on. Only the first mNumFrameAllocs entries are used.
 	 */
 	FrameAlloc* mFrameAllocs[NUM_FRAME_ALLOCS];
+	UINT32 mNumFrameAllocs;
 	UINT32 mActiveFrameAlloc;
 
 	static AccessorData mAccessor;
@@ -32,6 +32,11 @@ namespace BansheeEngine
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
+	 * Objects are stored in a slot map. Instance IDs assigned by the manager encode the slot index in the lower 32 bits
+	 * and the slot generation in the upper 32 bits, so looking up an object by ID is a single array access. Generation is
+	 * incremented whenever a slot is freed, ensuring IDs of destroyed objects never resolve to new objects occupying the
+	 * same slot. IDs assigned through remapId() don't encode their slot, and are instead looked up in a separate map.
+	 *
 	 * @note	Sim thread only.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
@@ -43,6 +48,17 @@ namespace BansheeEngine
 			GameObjectHandleBase handle;
 		};
 
+		/** Single entry in the object slot map. */
+		struct ObjectSlot
+		{
+			GameObjectHandleBase handle;
+			UINT64 id = 0; /**< Instance ID of the object in the slot, or 0 if the slot is free. */
+			UINT32 generation = 0;
+		};
+
+		/** Index returned by findSlot() if no object with the specified ID exists. */
+		static const UINT32 INVALID_SLOT = (UINT32)-1;
+
 	public:
 		GameObjectManager();
 		~GameObjectManager();
@@ -137,14 +153,21 @@ namespace BansheeEngine
 		UINT32 getDeserializationFlags() const { return mGODeserializationMode; }
 
 	private:
-		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
-		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		/** Returns the index of the slot containing the object with the specified ID, or INVALID_SLOT if not found. */
+		UINT32 findSlot(UINT64 id) const;
+
+		/** Returns the ID a newly registered object in the specified slot should be assigned. Never zero. */
+		static UINT64 makeId(UINT32 slotIdx, UINT32 generation) { return ((UINT64)generation << 32) | (slotIdx + 1); }
+
+		Vector<ObjectSlot> mSlots;
+		Vector<UINT32> mFreeSlots;
+		UnorderedMap<UINT64, UINT32> mRemappedIds; /**< Maps IDs assigned through remapId() to their object slots. */
+		Vector<GameObjectHandleBase> mQueuedForDestroy;
 
 		GameObject* mActiveDeserializedObject;
 		bool mIsDeserializationActive;
-		Map<UINT64, UINT64> mIdMapping;
-		Map<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
+		UnorderedMap<UINT64, UINT64> mIdMapping;
+		UnorderedMap<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
 		Vector<UnresolvedHandle> mUnresolvedHandles;
 		Vector<std::function<void()>> mEndCallbacks;
 		UINT32 mGODeserializationMode;
@@ -64,7 +64,11 @@ namespace BansheeEngine
 		static SPtr<GpuParamBlockBufferCore> create(UINT32 size, GpuParamBlockUsage usage = GPBU_DYNAMIC);
 
 	protected:
-		/** @copydoc CoreObjectCore::syncToCore */
+		/** 
+		 * @copydoc CoreObjectCore::syncToCore 
+		 *
+		 * @note	Sync data contains only the modified range of the buffer, prefixed by its offset.
+		 */
 		virtual void syncToCore(const CoreSyncData& data)  override;
 
 		GpuParamBlockUsage mUsage;
@@ -156,9 +160,15 @@ namespace BansheeEngine
 		/** @copydoc CoreObject::syncToCore */
 		virtual CoreSyncData syncToCore(FrameAlloc* allocator) override;
 
+		/** Extends the range of bytes that will be sent to the core thread on next sync, and marks the object dirty. */
+		void markRangeDirty(UINT32 offset, UINT32 size);
+
 		GpuParamBlockUsage mUsage;
 		UINT32 mSize;
 		UINT8* mCachedData;
+
+		UINT32 mDirtyStart;
+		UINT32 mDirtyEnd;
 	};
 
 	/** @endcond */
@@ -36,6 +36,16 @@ namespace BansheeEngine
 	template<> struct TGpuDataParamInfo < Matrix4x3 > { enum { TypeId = GPDT_MATRIX_4X3 }; };
 	template<> struct TGpuDataParamInfo < Color > { enum { TypeId = GPDT_COLOR }; };
 
+	/** Types of object slots stored in GpuParams. */
+	enum GpuParamSlotType
+	{
+		GPST_PARAM_BLOCK,
+		GPST_TEXTURE,
+		GPST_LOAD_STORE_TEXTURE,
+		GPST_SAMPLER_STATE,
+		GPST_COUNT // Keep at end
+	};
+
 	/** Contains functionality common for both sim and core thread version of GpuParams. */
 	class BS_CORE_EXPORT GpuParamsBase
 	{
@@ -93,6 +103,12 @@ namespace BansheeEngine
 		/** Marks the sim thread object as dirty, causing it to sync its contents with its core thread counterpart. */
 		virtual void _markCoreDirty() { }
 
+		/** 
+		 * Marks a single object slot of the sim thread object as dirty. Only the modified slots are synced with the core
+		 * thread counterpart, as opposed to _markCoreDirty() which syncs all of them.
+		 */
+		virtual void _markSlotDirty(GpuParamSlotType type, UINT32 slot) { }
+
 		/** @copydoc IResourceListener::markListenerResourcesDirty */
 		virtual void _markResourcesDirty() { }
 
@@ -100,6 +116,9 @@ namespace BansheeEngine
 		/**	Gets a descriptor for a data parameter with the specified name. */
 		GpuParamDataDesc* getParamDesc(const String& name) const;
 
+		/** Returns the number of slots of the specified type. */
+		UINT32 getNumSlots(GpuParamSlotType type) const;
+
 		SPtr<GpuParamDesc> mParamDesc;
 
 		UINT32 mNumParamBlocks;
@@ -251,7 +270,11 @@ namespace BansheeEngine
 		/** @copydoc CoreObject::getThisPtr */
 		SPtr<GpuParamsCore> _getThisPtr() const override;
 
-		/** @copydoc CoreObjectCore::syncToCore */
+		/** 
+		 * @copydoc CoreObjectCore::syncToCore 
+		 *
+		 * @note	Sync data contains only the modified slots. See GpuParams::syncToCore.
+		 */
 		void syncToCore(const CoreSyncData& data) override;
 	};
 
@@ -270,7 +293,7 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT GpuParams : public CoreObject, public TGpuParams<false>, public IResourceListener
 	{
 	public:
-		~GpuParams() { }
+		~GpuParams();
 
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<GpuParamsCore> getCore() const;
@@ -288,6 +311,9 @@ namespace BansheeEngine
 		/** @copydoc GpuParamsBase::_markCoreDirty */
 		void _markCoreDirty() override;
 
+		/** @copydoc GpuParamsBase::_markSlotDirty */
+		void _markSlotDirty(GpuParamSlotType type, UINT32 slot) override;
+
 		/** @copydoc IResourceListener::markListenerResourcesDirty */
 		void _markResourcesDirty() override;
 
@@ -302,17 +328,24 @@ namespace BansheeEngine
 		/** @copydoc CoreObject::createCore */
 		SPtr<CoreObjectCore> createCore() const override;
 
-		/** @copydoc CoreObject::syncToCore */
+		/** 
+		 * @copydoc CoreObject::syncToCore 
+		 *
+		 * @note	Only slots marked dirty since the last sync are written, unless a full sync was requested.
+		 */
 		CoreSyncData syncToCore(FrameAlloc* allocator) override;
 
 		/** @copydoc IResourceListener::getListenerResources */
 		void getListenerResources(Vector<HResource>& resources) override;
 
 		/** @copydoc IResourceListener::notifyResourceLoaded */
-		void notifyResourceLoaded(const HResource& resource) override { markCoreDirty(); }
+		void notifyResourceLoaded(const HResource& resource) override { _markCoreDirty(); }
 
 		/** @copydoc IResourceListener::notifyResourceChanged */
-		void notifyResourceChanged(const HResource& resource) override { markCoreDirty(); }
+		void notifyResourceChanged(const HResource& resource) override { _markCoreDirty(); }
+
+		UINT8* mDirtySlots[GPST_COUNT]; /**< One flag per slot, for each slot type. */
+		bool mSyncAllSlots;
 	};
 
 	/** @} */
@@ -66,6 +66,15 @@ namespace BansheeEngine
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Reads @p size bytes from the current position of the provided stream into the internal buffer. If the stream
+		 * reads from a memory mapped file (for example a resource package) the internal buffer will instead point directly
+		 * to the mapped data, without any allocation or copy, and keep the file mapped for as long as it is used.
+		 *
+		 * @note	If any internal data is allocated, it is freed.
+		 */
+		void readInternalBuffer(const SPtr<DataStream>& stream, UINT32 size);
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -85,6 +94,7 @@ namespace BansheeEngine
 	private:
 		UINT8* mData;
 		bool mOwnsData;
+		SPtr<MappedFile> mMappedFile;
 		mutable bool mLocked;
 
 		/************************************************************************/
@@ -41,7 +41,8 @@ namespace BansheeEngine
 	{
 		Box,
 		Triangle,
-		Kaiser
+		Kaiser,
+		Lanczos
 	};
 
 	/**	Options used to control texture compression. */
@@ -61,6 +62,7 @@ namespace BansheeEngine
 		MipMapWrapMode wrapMode = MipMapWrapMode::Mirror; /*< Determines how to downsample pixels on borders. */
 		bool isNormalMap = false; /*< Determines does the input data represent a normal map. */
 		bool normalizeMipmaps = false; /*< Should the downsampled values be re-normalized. Only relevant for mip-maps representing normal maps. */
+		bool isSRGB = false; /*< Determines has the input data been gamma corrected. If true filtering is done in linear space. Ignored for normal maps. */
 	};
 
 	/**	Utility methods for converting and managing pixel data and formats. */
@@ -193,15 +195,26 @@ namespace BansheeEngine
 		/**
 		 * Converts pixels from one format to another. Provided pixel data objects must have previously allocated buffers
 		 * of adequate size and their sizes must match.
+		 *
+		 * @note	
+		 * When converting from R8G8B8X8 or B8G8R8X8, alpha is treated as zero. Unlike unpackColor(), which returns NaN
+		 * or infinity for alpha of those formats.
 		 */
         static void bulkPixelConversion(const PixelData& src, PixelData& dst);
 
-		/** Compresses the provided data using the specified compression options.  */
+		/** 
+		 * Compresses the provided data using the specified compression options. Horizontal bands of the image are 
+		 * compressed in parallel using the TaskScheduler, if it is running.
+		 */
 		static void compress(const PixelData& src, PixelData& dst, const CompressionOptions& options);
 
 		/**
 		 * Generates mip-maps from the provided source data using the specified compression options. Returned list includes
-		 * the base level.
+		 * the base level. Filtering is done on floating point data and rows of each level are processed in parallel using
+		 * the TaskScheduler, if it is running.
+		 *
+		 * Source doesn't need to have power of two dimensions. Each level is half the size of the previous one, rounded 
+		 * down, same as the levels of a texture.
 		 *
 		 * @return	A list of calculated mip-map data. First entry is the largest mip and other follow in order from 
 		 *			largest to smallest.
@@ -16,11 +16,18 @@ namespace BansheeEngine
 
 	/**
 	 * Provides various performance measuring methods.
+	 *
+	 * Aside from aggregating samples into reports, the profiler can also record a trace: a timeline of every sample
+	 * begin/end on every thread (including task scheduler workers), which can be saved in the Chrome Trace Event format
+	 * and viewed in chrome://tracing or Perfetto. See setTracingEnabled() and saveTrace().
 	 * 			
 	 * @note	Thread safe. Matching begin* \ end* calls must belong to the same thread though.
 	 */
 	class BS_CORE_EXPORT ProfilerCPU : public Module<ProfilerCPU>
 	{
+		/** Maximum number of trace events stored per thread. Must be a power of two. */
+		static const UINT32 TRACE_BUFFER_SIZE = 64 * 1024;
+
 		/**	Timer class responsible for tracking elapsed time. */
 		class Timer
 		{
@@ -238,6 +245,47 @@ namespace BansheeEngine
 			Stack<ActiveBlock, StdFrameAlloc<ActiveBlock>>* activeBlocks;
 		};
 
+		/** Types of events recorded while tracing. */
+		enum class TraceEventType : UINT32
+		{
+			Begin,
+			End
+		};
+
+		/** Single event recorded while tracing is enabled. */
+		struct TraceEvent
+		{
+			UINT64 timestamp; /**< Value of the CPU timestamp counter at the time of the event. */
+			UINT32 nameId; /**< Index of the interned event name. Not used for end events. */
+			TraceEventType type;
+		};
+
+		/**
+		 * Ring buffer containing trace events recorded by a single thread. Only the owning thread ever writes to the
+		 * buffer so recording requires no locks. When full the oldest events get overwritten.
+		 */
+		struct TraceBuffer
+		{
+			TraceBuffer(UINT32 threadId, const String& threadName);
+
+			/** Appends a new event to the buffer. Must only be called from the owning thread. */
+			void record(TraceEventType type, UINT32 nameId);
+
+			static BS_THREADLOCAL TraceBuffer* activeBuffer;
+
+			TraceEvent events[TRACE_BUFFER_SIZE];
+			std::atomic<UINT64> numEvents; /**< Total number of events ever recorded in the buffer. */
+
+			UINT32 threadId;
+			String threadName;
+
+			/** Names already interned by this thread, keyed by their address so the lookup doesn't need to hash strings. */
+			UnorderedMap<const char*, UINT32> nameIds;
+
+			/** Task names already interned by this thread. */
+			UnorderedMap<String, UINT32> taskNameIds;
+		};
+
 	public:
 		ProfilerCPU();
 		~ProfilerCPU();
@@ -305,6 +353,39 @@ namespace BansheeEngine
 		 */
 		CPUProfilerReport generateReport();
 
+		/**
+		 * Starts or stops recording of trace events. While enabled every begin/end sample call also records a timestamped
+		 * event into a per-thread buffer, and so does every task executed by the TaskScheduler. Enabling the trace discards
+		 * any events recorded previously.
+		 *
+		 * @note	
+		 * Recorded event names are cached by their address, so names provided to beginSample() and beginSamplePrecise()
+		 * must remain valid and unchanged for the lifetime of the profiler (string literals are the usual case).
+		 */
+		void setTracingEnabled(bool enabled);
+
+		/** Checks if trace events are currently being recorded. */
+		bool isTracingEnabled() const { return mTracingEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * Saves all trace events recorded since tracing was last enabled into a JSON file in the Chrome Trace Event
+		 * format. Only the most recent TRACE_BUFFER_SIZE events are kept per thread.
+		 *
+		 * @note	Safe to call while tracing is enabled, although events recorded during the save might not be included.
+		 */
+		void saveTrace(const Path& path);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Records the start of a task in the trace. Registered with the TaskScheduler by the application. */
+		static void _onTaskStarted(const Task& task);
+
+		/** Records the end of a task in the trace. Registered with the TaskScheduler by the application. */
+		static void _onTaskFinished(const Task& task);
+
+		/** @} */
 	private:
 		/**
 		 * Calculates overhead that the timing and sampling methods themselves introduce so we might get more accurate 
@@ -312,6 +393,18 @@ namespace BansheeEngine
 		 */
 		void estimateTimerOverhead();
 
+		/** Returns the trace buffer of the calling thread, creating one if the thread doesn't have it yet. */
+		TraceBuffer* getTraceBuffer();
+
+		/** Returns a unique ID for the provided event name, registering the name if not seen before. */
+		UINT32 internTraceName(const char* name);
+
+		/** Records a begin event for a sample with the provided name, in the trace of the calling thread. */
+		void traceBegin(const char* name);
+
+		/** Records an end event for the last started sample, in the trace of the calling thread. */
+		void traceEnd();
+
 	private:
 		double mBasicTimerOverhead;
 		UINT64 mPreciseTimerOverhead;
@@ -323,6 +416,14 @@ namespace BansheeEngine
 
 		ProfilerVector<ThreadInfo*> mActiveThreads;
 		Mutex mThreadSync;
+
+		std::atomic<bool> mTracingEnabled;
+		UINT64 mTraceStartTimestamp;
+		std::chrono::steady_clock::time_point mTraceStartTime;
+		ProfilerVector<TraceBuffer*> mTraceBuffers;
+		ProfilerVector<String> mTraceNames;
+		UnorderedMap<String, UINT32> mTraceNameIds;
+		Mutex mTraceSync;
 	};
 
 	/** Profiling entry containing information about a single CPU profiling block containing timing information. */
@@ -0,0 +1,88 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Archive containing data of multiple resources in a single file. Package is memory mapped when opened, and resource
+	 * data is decoded directly from the mapped pages, without any file reads or intermediate copies.
+	 *
+	 * Package consists of a header, followed by an index of UUID/offset/size entries, followed by the resource data. Data
+	 * for each resource is identical to the contents of a resource file saved through Resources::save(), and starts at a
+	 * 64 byte aligned offset.
+	 *
+	 * @note	
+	 * Register a package with Resources::registerResourcePackage() so the resources contained in it can be loaded by UUID.
+	 * @note
+	 * Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourcePackage
+	{
+		struct PrivatelyConstruct {};
+
+		/** Location of a single resource within the package. */
+		struct Entry
+		{
+			UINT64 offset;
+			UINT64 size;
+		};
+
+	public:
+		ResourcePackage(const PrivatelyConstruct& dummy, const Path& path, const SPtr<MappedFile>& file);
+
+		/** Returns the path to the package file. */
+		const Path& getPath() const { return mPath; }
+
+		/** Checks if the package contains a resource with the specified UUID. */
+		bool contains(const String& uuid) const;
+
+		/** 
+		 * Returns a stream that can be used for reading data of the resource with the specified UUID, or null if the
+		 * resource is not in the package. The stream reads directly from the mapped file and keeps it mapped for as long
+		 * as the stream is alive.
+		 */
+		SPtr<DataStream> openResource(const String& uuid) const;
+
+		/** Returns UUIDs of all resources in the package. */
+		Vector<String> getResourceUUIDs() const;
+
+		/** Opens an existing package. Returns null if the file doesn't exist or isn't a valid package. */
+		static SPtr<ResourcePackage> open(const Path& path);
+
+		/**
+		 * Creates a new package from a set of saved resource files. Any existing file at @p path is overwritten.
+		 *
+		 * @param[in]	path		Path at which to save the package.
+		 * @param[in]	resources	UUID and file path of each resource to include in the package. Files must have been 
+		 *							saved through Resources::save().
+		 * @return					True if the package was successfully created.
+		 */
+		static bool create(const Path& path, const Vector<std::pair<String, Path>>& resources);
+
+	private:
+		/** Identifier at the start of every package file. */
+		static const UINT32 MAGIC = 0x4B505342; // "BSPK"
+
+		/** Version of the package format. */
+		static const UINT32 VERSION = 1;
+
+		/** Alignment of resource data within the package, in bytes. */
+		static const UINT32 DATA_ALIGNMENT = 64;
+
+		/** Maximum length of a UUID string stored in the package index. */
+		static const UINT32 MAX_UUID_LENGTH = 36;
+
+		Path mPath;
+		SPtr<MappedFile> mFile;
+		UnorderedMap<String, Entry> mEntries;
+	};
+
+	/** @} */
+}
@@ -149,6 +149,46 @@ namespace BansheeEngine
 		 */
 		HResource loadFromUUID(const String& uuid, bool async = false, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
 
+		/**
+		 * Loads a set of resources along with their dependencies. Unlike loading each resource individually, the
+		 * dependency lists of all resources in the batch are read up front, on multiple threads. Then all file reads and
+		 * deserialization are queued at once, so they run in parallel across the worker threads rather than one
+		 * dependency level at a time. Resources already loaded or being loaded are returned as is, without reading their
+		 * files, and their dependencies aren't considered part of the batch.
+		 *
+		 * @param[in]	uuids		UUIDs of the resources to load.
+		 * @param[in]	async		If true the method returns as soon as all loads are queued, otherwise it blocks until
+		 *							all the resources in the batch are fully loaded.
+		 * @param[in]	loadFlags	Flags used to control the load process. Only the requested resources receive internal
+		 *							references, as with load().
+		 * @return					Handles to the requested resources, in the same order as @p uuids, followed by handles
+		 *							to all of their dependencies (if ResourceLoadFlag::LoadDependencies is set). Pass the
+		 *							handles to getLoadProgress() to track the batch progress.
+		 *
+		 * @note	
+		 * Even when not loading asynchronously, resource listeners are notified on the next frame, same as for async loads.
+		 */
+		Vector<HResource> loadBatch(const Vector<String>& uuids, bool async = true, 
+			ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
+
+		/**
+		 * Starts asynchronously loading the provided resources and their dependencies, so they are ready by the time they
+		 * are needed. Later load() calls for the same resources return the resources being (or already) loaded. 
+		 * Resources are loaded with ResourceLoadFlag::KeepInternalRef so they aren't unloaded before they are used, and 
+		 * each must be released through release() once no longer needed.
+		 *
+		 * @return	Handles to all the resources in the batch.
+		 *
+		 * @see		loadBatch
+		 */
+		Vector<HResource> prefetch(const Vector<String>& uuids);
+
+		/**
+		 * Returns the fraction of the provided resources that have finished loading, in range [0, 1]. Dependencies of the
+		 * provided resources are not considered, unless included in the list.
+		 */
+		static float getLoadProgress(const Vector<HResource>& resources);
+
 		/**
 		 * Releases an internal reference to the resource held by the resources system. This allows the resource to be 
 		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter.
@@ -185,7 +225,8 @@ namespace BansheeEngine
 		void save(const HResource& resource, const Path& filePath, bool overwrite);
 
 		/**
-		 * Saves an existing resource to its previous location.
+		 * Saves an existing resource to its previous location. Resources loaded from a resource package cannot be saved
+		 * in place, as packages are read-only.
 		 *
 		 * @param[in]	resource 	Handle to the resource.
 		 *
@@ -237,6 +278,16 @@ namespace BansheeEngine
 		/**	Unregisters a resource manifest previously registered with registerResourceManifest(). */
 		void unregisterResourceManifest(const SPtr<ResourceManifest>& manifest);
 
+		/**
+		 * Registers a resource package, allowing resources contained in it to be loaded by UUID. Resources registered in
+		 * resource manifests take priority over the ones in packages. If multiple packages contain the same resource, the
+		 * one registered last is used.
+		 */
+		void registerResourcePackage(const SPtr<ResourcePackage>& package);
+
+		/**	Unregisters a resource package previously registered with registerResourcePackage(). */
+		void unregisterResourcePackage(const SPtr<ResourcePackage>& package);
+
 		/**
 		 * Allows you to retrieve resource manifest containing UUID <-> file path mapping that is used when resolving 
 		 * resource references.
@@ -248,7 +299,10 @@ namespace BansheeEngine
 		 */
 		SPtr<ResourceManifest> getResourceManifest(const String& name) const;
 
-		/** Attempts to retrieve file path from the provided UUID. Returns true if successful, false otherwise. */
+		/** 
+		 * Attempts to retrieve file path from the provided UUID. Returns true if successful, false otherwise. Resources 
+		 * contained in resource packages have no file of their own and are not resolved by this method.
+		 */
 		bool getFilePathFromUUID(const String& uuid, Path& filePath) const;
 
 		/** Attempts to retrieve UUID from the provided file path. Returns true if successful, false otherwise. */
@@ -304,7 +358,26 @@ namespace BansheeEngine
 		HResource loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
 
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
+		SPtr<Resource> loadFromDiskAndDeserialize(const String& UUID, const Path& filePath, bool loadWithSaveData);
+
+		/**
+		 * Retrieves the path to load the resource with the specified UUID from. Same as getFilePathFromUUID() but also
+		 * resolves resources contained in registered resource packages, in which case the package path is returned.
+		 * Such a path must only be read through openResourceData().
+		 */
+		bool getLoadPathFromUUID(const String& uuid, Path& filePath) const;
+
+		/** Checks if the provided path belongs to one of the registered resource packages. */
+		bool isResourcePackagePath(const Path& filePath) const;
+
+		/** Returns the last registered resource package containing the specified resource, or null if none. */
+		SPtr<ResourcePackage> findResourcePackage(const String& UUID) const;
+
+		/** 
+		 * Opens a stream for reading the saved data of the specified resource. Data is read from a resource package if
+		 * @p filePath points to a package, or from the resource file otherwise.
+		 */
+		SPtr<DataStream> openResourceData(const String& UUID, const Path& filePath) const;
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
@@ -318,6 +391,8 @@ namespace BansheeEngine
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourcePackage>> mResourcePackages;
+		mutable Mutex mResourcePackagesMutex;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
@@ -326,6 +401,7 @@ namespace BansheeEngine
 		UnorderedMap<String, LoadedResourceData> mLoadedResources;
 		UnorderedMap<String, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<String, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+		UnorderedMap<String, SPtr<SavedResourceData>> mPrefetchedResourceData; // Dependency lists read by loadBatch(), sim thread only
 	};
 
 	/** Provides easier access to Resources manager. */
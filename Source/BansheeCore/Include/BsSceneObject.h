@@ -43,6 +43,7 @@ namespace BansheeEngine
 		};
 
 		friend class CoreSceneManager;
+		friend class SceneTransformStore;
 		friend class Prefab;
 		friend class PrefabDiff;
 		friend class PrefabUtility;
@@ -335,7 +336,7 @@ namespace BansheeEngine
 		 * Returns a hash value that changes whenever a scene objects transform gets updated. It allows you to detect 
 		 * changes with the local or world transforms without directly comparing their values with some older state.
 		 */
-		UINT32 getTransformHash() const { return mDirtyHash; }
+		UINT32 getTransformHash() const;
 
 	private:
 		Vector3 mPosition;
@@ -351,6 +352,9 @@ namespace BansheeEngine
 
 		mutable UINT32 mDirtyFlags;
 		mutable UINT32 mDirtyHash;
+		mutable UINT32 mParentTfrmHash; /**< Transform hash of the parent when the world transform was last updated. */
+
+		UINT32 mTransformId; /**< Id of the object in the scene manager's SceneTransformStore, if registered. */
 
 		/** 
 		 * Notifies components and child scene object that a transform has been changed.  
@@ -359,6 +363,19 @@ namespace BansheeEngine
 		 */
 		void notifyTransformChanged(TransformChangedFlags flags) const;
 
+		/** Notifies components of this object that a transform has been changed. Child scene objects are not notified. */
+		void notifyComponents(TransformChangedFlags flags) const;
+
+		/** 
+		 * Writes the local transform into the scene transform store, and notifies components that the transform has been
+		 * changed. Child scene objects are marked dirty and notified by the store on its next update, rather than 
+		 * immediately.
+		 */
+		void notifyLocalTransformChanged();
+
+		/** Registers a newly created object with the scene transform store, if the scene manager is running. */
+		void registerTransform();
+
 		/** Updates the local transform. Normally just reconstructs the transform matrix from the position/rotation/scale. */
 		void updateLocalTfrm() const;
 
@@ -372,8 +389,11 @@ namespace BansheeEngine
 		/**	Checks if cached local transform needs updating. */
 		bool isCachedLocalTfrmUpToDate() const { return (mDirtyFlags & DirtyFlags::LocalTfrmDirty) == 0; }
 
-		/**	Checks if cached world transform needs updating. */
-		bool isCachedWorldTfrmUpToDate() const { return (mDirtyFlags & DirtyFlags::WorldTfrmDirty) == 0; }
+		/**	
+		 * Checks if cached world transform needs updating. Parent transform changes don't mark the children dirty until
+		 * the scene transform store is updated, so until then this walks up the hierarchy to check the parents.
+		 */
+		bool isCachedWorldTfrmUpToDate() const;
 
 		/************************************************************************/
 		/* 								Hierarchy	                     		*/
@@ -489,6 +509,12 @@ namespace BansheeEngine
 		/** Changes the object active in hierarchy state, and triggers necessary events. */
 		void setActiveHierarchy(bool active, bool triggerEvents = true);
 
+		/** Registers the component for updates with the scene manager and triggers its onEnabled() event. */
+		void activateComponent(Component* component);
+
+		/** Unregisters the component from updates with the scene manager and triggers its onDisabled() event. */
+		void deactivateComponent(Component* component);
+
 		/************************************************************************/
 		/* 								Component	                     		*/
 		/************************************************************************/
@@ -516,7 +542,7 @@ namespace BansheeEngine
 				newComponent->onInitialized();
 
 				if (getActive())
-					newComponent->onEnabled();
+					activateComponent(newComponent.get());
 			}
 
 			return newComponent;
@@ -0,0 +1,109 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsMatrix4.h"
+#include "BsVector3.h"
+#include "BsQuaternion.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Scene-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Stores transforms of all scene objects in contiguous arrays, sorted so that parents always precede their children.
+	 * This allows world transforms of all dirty objects to be updated in a single linear pass, without walking the
+	 * hierarchy or dereferencing game object handles.
+	 *
+	 * Each registered object is given a stable id, while its data is kept at an index that may change whenever the
+	 * store is re-sorted or compacted.
+	 *
+	 * Changing a local transform only marks the object itself as dirty. Children are marked dirty, and their components
+	 * notified of the change, during update().
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT SceneTransformStore
+	{
+	public:
+		/** Id/index signifying an object that is not registered with the store, or that has no parent. */
+		static const UINT32 INVALID_ID = (UINT32)-1;
+
+		SceneTransformStore();
+		~SceneTransformStore();
+
+		/**
+		 * Registers a new scene object with the store, and returns the id it was assigned. Object's current local transform
+		 * is copied into the store. The object starts without a parent, use setParent() to assign one.
+		 */
+		UINT32 registerObject(SceneObject* object);
+
+		/** Removes an object previously registered with registerObject(). */
+		void unregisterObject(UINT32 id);
+
+		/** Updates the local transform of the specified object and marks it as dirty. */
+		void setLocalTransform(UINT32 id, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+		/** Changes the parent of the specified object. Provide INVALID_ID as @p parentId to remove the parent. */
+		void setParent(UINT32 id, UINT32 parentId);
+
+		/**
+		 * Recalculates world transforms of all dirty objects and their children, and writes the results into their
+		 * respective scene objects. Components of children dirtied by their parents are notified of the change.
+		 */
+		void update();
+
+		/** Checks are there any transform changes not yet processed by update(). */
+		bool isDirty() const { return mAnyDirty; }
+
+		/** Unregisters all objects. Should be called before the scene objects referenced by the store are destroyed. */
+		void clear();
+
+	private:
+		/** Removes all unregistered entries from the arrays, while maintaining the order of the remaining entries. */
+		void compact();
+
+		/** Re-orders all entries by their depth in the hierarchy, removing any unregistered entries in the process. */
+		void sortByDepth();
+
+		/** 
+		 * Moves all entries to the indices specified in mRemap, dropping entries mapped to INVALID_ID. 
+		 *
+		 * @param[in]	count	Number of entries remaining after the remap.
+		 */
+		void applyRemap(UINT32 count);
+
+		// Per-id data
+		Vector<UINT32> mIdToIndex;
+		Vector<UINT32> mFreeIds;
+
+		// Per-index data
+		Vector<SceneObject*> mObjects;
+		Vector<UINT32> mIds;
+		Vector<UINT32> mParents;
+		Vector<Vector3> mLocalPositions;
+		Vector<Quaternion> mLocalRotations;
+		Vector<Vector3> mLocalScales;
+		Vector<Vector3> mWorldPositions;
+		Vector<Quaternion> mWorldRotations;
+		Vector<Vector3> mWorldScales;
+		Vector<Matrix4> mWorldTfrms;
+		Vector<UINT8> mDirty; /**< Combination of DIRTY_SELF and DIRTY_PARENT flags. */
+
+		Vector<UINT32> mRemap; /**< Scratch buffer used during sort and compaction, kept to avoid reallocations. */
+		Vector<UINT32> mDepths; /**< Scratch buffer used during sort, kept to avoid reallocations. */
+		Vector<UINT32> mNotifyIds; /**< Scratch buffer used during update, kept to avoid reallocations. */
+
+		static const UINT8 DIRTY_SELF = 0x01; /**< Object's own transform or parent changed. */
+		static const UINT8 DIRTY_PARENT = 0x02; /**< Transform of one of the object's ancestors changed. */
+
+		UINT32 mNumUnregistered;
+		bool mOrderDirty;
+		bool mAnyDirty;
+	};
+
+	/** @} */
+}
@@ -53,6 +53,9 @@ namespace BansheeEngine
 		/** Changes the active include handler that determines how is a shader include name mapped to the actual resource. */
 		void setIncludeHandler(const SPtr<IShaderIncludeHandler>& handler) { mIncludeHandler = handler; }
 
+		/** Returns the active include handler that determines how is a shader include name mapped to the actual resource. */
+		SPtr<IShaderIncludeHandler> getIncludeHandler() const { return mIncludeHandler; }
+
 	private:
 		SPtr<IShaderIncludeHandler> mIncludeHandler;
 	};
@@ -27,7 +27,10 @@ namespace BansheeEngine
 		TechniqueBase(const StringID& renderAPI, const StringID& renderer);
 		virtual ~TechniqueBase() { }
 
-		/**	Checks if this technique is supported based on current render and other systems. */
+		/**	
+		 * Checks if this technique is supported based on current render and other systems. The null render API is
+		 * considered compatible with techniques for any render API.
+		 */
 		bool isSupported() const;
 
 	protected:
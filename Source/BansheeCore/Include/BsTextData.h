@@ -100,6 +100,7 @@ namespace BansheeEngine
 		struct PageInfo
 		{
 			UINT32 numQuads;
+			UINT32 numReusedQuads; /**< Number of leading quads belonging to lines reused from a previous layout. */
 			HTexture texture;
 		};
 
@@ -219,6 +220,19 @@ namespace BansheeEngine
 		 */
 		BS_CORE_EXPORT TextDataBase(const WString& text, const HFont& font, UINT32 fontSize,
 			UINT32 width = 0, UINT32 height = 0, bool wordWrap = false, bool wordBreak = true);
+
+		/**
+		 * Initializes a new text data by updating a previously generated one. Lines of @p previous that end with a 
+		 * newline character and come before the first character that differs between @p text and @p previousText are
+		 * reused, and only the remaining text is laid out. 
+		 *
+		 * @p previous must have been created using @p previousText and the same font, font size, width and wrap 
+		 * options, and must remain alive until construction completes.
+		 */
+		BS_CORE_EXPORT TextDataBase(const WString& text, const HFont& font, UINT32 fontSize,
+			UINT32 width, UINT32 height, bool wordWrap, bool wordBreak, const TextDataBase& previous, 
+			const WString& previousText);
+
 		BS_CORE_EXPORT virtual ~TextDataBase() { }
 
 		/**	Returns the number of lines that were generated. */
@@ -239,6 +253,18 @@ namespace BansheeEngine
 		/**	Returns the number of quads used by all the characters in the provided page. */
 		BS_CORE_EXPORT UINT32 getNumQuadsForPage(UINT32 page) const { return mPageInfos[page].numQuads; }
 
+		/** 
+		 * Returns the number of leading lines that were reused from a previous layout, rather than laid out again. Zero
+		 * if the text data wasn't created from a previous layout.
+		 */
+		BS_CORE_EXPORT UINT32 getNumReusedLines() const { return mNumReusedLines; }
+
+		/** 
+		 * Returns the number of leading quads in the provided page that belong to lines reused from a previous layout. 
+		 * These quads are identical to the ones of the previous layout.
+		 */
+		BS_CORE_EXPORT UINT32 getNumReusedQuadsForPage(UINT32 page) const { return mPageInfos[page].numReusedQuads; }
+
 		/**	Returns the width of the actual text in pixels. */
 		BS_CORE_EXPORT UINT32 getWidth() const;
 
@@ -262,6 +288,21 @@ namespace BansheeEngine
 	private:
 		friend class TextLine;
 
+		/** Finds the font bitmap to use for the provided font size. Returns false if no valid bitmap exists. */
+		bool initFont(const HFont& font, UINT32 fontSize);
+
+		/**
+		 * Registers all lines of @p previous that can be reused for @p text in the temporary buffers, and returns the 
+		 * index of the first character that needs to be laid out.
+		 */
+		UINT32 reuseLines(const WString& text, const TextDataBase& previous, const WString& previousText);
+
+		/** 
+		 * Breaks the text into words and lines and stores them in the temporary buffers, starting with the provided
+		 * character which is assumed to start a new line.
+		 */
+		void layoutText(const WString& text, UINT32 startChar, UINT32 width, bool wordWrap, bool wordBreak);
+
 		/**	Returns Y offset that determines the line on which the characters are placed. In pixels. */
 		INT32 getBaselineOffset() const;
 
@@ -290,6 +331,11 @@ namespace BansheeEngine
 		HFont mFont;
 		SPtr<const FontBitmap> mFontData;
 
+		const TextDataBase* mReusedData;
+		UINT32 mNumReusedChars;
+		UINT32 mNumReusedWords;
+		UINT32 mNumReusedLines;
+
 		// Static buffers used to reduce runtime memory allocation
 	protected:
 		/** Stores per-thread memory buffers used to reduce memory allocation. */
@@ -310,12 +356,25 @@ namespace BansheeEngine
 			/** Allocates a new line and adds it to the buffer. Returns index of the line in the line buffer. */
 			UINT32 allocLine(TextDataBase* textData);
 
+			/**
+			 * Marks the provided number of words and lines as allocated, without initializing them. Used for words and
+			 * lines reused from a previous layout, which are copied directly when generating persistent data. Must be
+			 * called before any other allocations.
+			 */
+			void reserve(UINT32 numWords, UINT32 numLines);
+
 			/**
 			 * Increments the count of characters for the referenced page, and optionally creates page info if it doesn't
 			 * already exist.
 			 */
 			void addCharToPage(UINT32 page, const FontBitmap& fontData);
 
+			/** 
+			 * Registers quads belonging to lines reused from a previous layout with the referenced page, and optionally
+			 * creates page info if it doesn't already exist.
+			 */
+			void addReusedQuadsToPage(UINT32 page, UINT32 numQuads);
+
 			/**	Resets all allocation counters, but doesn't actually release memory. */
 			void deallocAll();
 
@@ -361,6 +420,18 @@ namespace BansheeEngine
 			generatePersistentData(text, (UINT8*)mData, totalBufferSize);
 		}
 
+		/** @copydoc TextDataBase::TextDataBase(const WString&, const HFont&, UINT32, UINT32, UINT32, bool, bool, const TextDataBase&, const WString&) */
+		TextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, UINT32 height, bool wordWrap,
+			bool wordBreak, const TextDataBase& previous, const WString& previousText)
+			:TextDataBase(text, font, fontSize, width, height, wordWrap, wordBreak, previous, previousText), mData(nullptr)
+		{
+			UINT32 totalBufferSize = 0;
+			generatePersistentData(text, nullptr, totalBufferSize);
+
+			mData = (UINT8*)bs_alloc<Alloc>(totalBufferSize);
+			generatePersistentData(text, (UINT8*)mData, totalBufferSize);
+		}
+
 		~TextData()
 		{
 			if (mData != nullptr)
@@ -7,12 +7,56 @@
 
 namespace BansheeEngine
 {
+	QueuedCommandBuffer::QueuedCommandBuffer()
+		:mActiveBlock(0), mNumCommands(0)
+	{ }
+
+	QueuedCommandBuffer::~QueuedCommandBuffer()
+	{
+		clear();
+
+		for (auto& block : mBlocks)
+			bs_free(block.data);
+	}
+
+	void QueuedCommandBuffer::clear()
+	{
+		consume([](QueuedCommand& command) { });
+	}
+
+	UINT8* QueuedCommandBuffer::allocate(UINT32 size)
+	{
+		while (mActiveBlock < (UINT32)mBlocks.size())
+		{
+			Block& block = mBlocks[mActiveBlock];
+			if ((block.used + size) <= block.capacity)
+			{
+				UINT8* data = block.data + block.used;
+				block.used += size;
+
+				return data;
+			}
+
+			mActiveBlock++;
+		}
+
+		Block block;
+		block.capacity = std::max(BLOCK_SIZE, size);
+		block.data = (UINT8*)bs_alloc(block.capacity);
+		block.used = size;
+
+		mBlocks.push_back(block);
+		mActiveBlock = (UINT32)mBlocks.size() - 1;
+
+		return block.data;
+	}
+
 #if BS_DEBUG_MODE
 	CommandQueueBase::CommandQueueBase(ThreadId threadId)
-		:mMyThreadId(threadId), mMaxDebugIdx(0)
+		:mFreeBuffersHead(0), mFreeBuffersTail(0), mMyThreadId(threadId), mMaxDebugIdx(0)
 	{
 		mAsyncOpSyncData = bs_shared_ptr_new<AsyncOpSyncData>();
-		mCommands = bs_new<BansheeEngine::Queue<QueuedCommand>>();
+		mCommands = bs_new<QueuedCommandBuffer>();
 
 		{
 			Lock lock(CommandQueueBreakpointMutex);
@@ -22,10 +66,10 @@ namespace BansheeEngine
 	}
 #else
 	CommandQueueBase::CommandQueueBase(ThreadId threadId)
-		:mMyThreadId(threadId)
+		:mFreeBuffersHead(0), mFreeBuffersTail(0), mMyThreadId(threadId)
 	{
 		mAsyncOpSyncData = bs_shared_ptr_new<AsyncOpSyncData>();
-		mCommands = bs_new<BansheeEngine::Queue<QueuedCommand>>();
+		mCommands = bs_new<QueuedCommandBuffer>();
 	}
 #endif
 
@@ -34,125 +78,98 @@ namespace BansheeEngine
 		if(mCommands != nullptr)
 			bs_delete(mCommands);
 
-		while(!mEmptyCommandQueues.empty())
-		{
-			bs_delete(mEmptyCommandQueues.top());
-			mEmptyCommandQueues.pop();
-		}
+		UINT32 head = mFreeBuffersHead.load(std::memory_order_acquire);
+		for(UINT32 i = mFreeBuffersTail.load(std::memory_order_relaxed); i != head; i++)
+			bs_delete(mFreeBuffers[i % MAX_FREE_BUFFERS]);
 	}
 
-	AsyncOp CommandQueueBase::queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	void CommandQueueBase::onCommandQueued(QueuedCommand* command)
 	{
 #if BS_DEBUG_MODE
 		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
-#else
-		QueuedCommand newCommand(commandCallback, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+		command->debugId = mMaxDebugIdx++;
 #endif
 
-		mCommands->push(newCommand);
-
 #if BS_FORCE_SINGLETHREADED_RENDERING
-		Queue<QueuedCommand>* commands = flush();
+		QueuedCommandBuffer* commands = flush();
 		playback(commands);
 #endif
-
-		return newCommand.asyncOp;
 	}
 
-	void CommandQueueBase::queue(std::function<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	QueuedCommandBuffer* CommandQueueBase::flush()
 	{
-#if BS_DEBUG_MODE
-		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
+		QueuedCommandBuffer* oldCommands = mCommands;
+		mCommands = acquireBuffer();
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
-#else
-		QueuedCommand newCommand(commandCallback, _notifyWhenComplete, _callbackId);
-#endif
+		return oldCommands;
+	}
 
-		mCommands->push(newCommand);
+	QueuedCommandBuffer* CommandQueueBase::acquireBuffer()
+	{
+		UINT32 tail = mFreeBuffersTail.load(std::memory_order_relaxed);
+		if(tail == mFreeBuffersHead.load(std::memory_order_acquire))
+			return bs_new<QueuedCommandBuffer>();
 
-#if BS_FORCE_SINGLETHREADED_RENDERING
-		Queue<QueuedCommand>* commands = flush();
-		playback(commands);
-#endif
+		QueuedCommandBuffer* buffer = mFreeBuffers[tail % MAX_FREE_BUFFERS];
+		mFreeBuffersTail.store(tail + 1, std::memory_order_release);
+
+		return buffer;
 	}
 
-	BansheeEngine::Queue<QueuedCommand>* CommandQueueBase::flush()
+	void CommandQueueBase::releaseBuffer(QueuedCommandBuffer* buffer)
 	{
-		BansheeEngine::Queue<QueuedCommand>* oldCommands = mCommands;
-
-		if(!mEmptyCommandQueues.empty())
-		{
-			mCommands = mEmptyCommandQueues.top();
-			mEmptyCommandQueues.pop();
-		}
-		else
+		UINT32 head = mFreeBuffersHead.load(std::memory_order_relaxed);
+		if((head - mFreeBuffersTail.load(std::memory_order_acquire)) == MAX_FREE_BUFFERS)
 		{
-			mCommands = bs_new<BansheeEngine::Queue<QueuedCommand>>();
+			bs_delete(buffer);
+			return;
 		}
 
-		return oldCommands;
+		mFreeBuffers[head % MAX_FREE_BUFFERS] = buffer;
+		mFreeBuffersHead.store(head + 1, std::memory_order_release);
 	}
 
-	void CommandQueueBase::playbackWithNotify(BansheeEngine::Queue<QueuedCommand>* commands, std::function<void(UINT32)> notifyCallback)
+	void CommandQueueBase::playbackWithNotify(QueuedCommandBuffer* commands, std::function<void(UINT32)> notifyCallback)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		if(commands == nullptr)
 			return;
 
-		while(!commands->empty())
+		commands->consume([&](QueuedCommand& command)
 		{
-			QueuedCommand& command = commands->front();
+			command.execute(QueuedCommandBuffer::getCallable(&command), command.asyncOp);
 
-			if(command.returnsValue)
+			if(command.returnsValue && !command.asyncOp.hasCompleted())
 			{
-				AsyncOp& op = command.asyncOp;
-				command.callbackWithReturnValue(op);
-
-				if(!command.asyncOp.hasCompleted())
-				{
-					LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
-						"Make sure to complete the operation before returning from the command callback method.");
-					command.asyncOp._completeOperation(nullptr);
-				}
-			}
-			else
-			{
-				command.callback();
+				LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
+					"Make sure to complete the operation before returning from the command callback method.");
+				command.asyncOp._completeOperation(nullptr);
 			}
 
 			if(command.notifyWhenComplete && notifyCallback != nullptr)
 			{
 				notifyCallback(command.callbackId);
 			}
+		});
 
-			commands->pop();
-		}
-
-		mEmptyCommandQueues.push(commands);
+		releaseBuffer(commands);
 	}
 
-	void CommandQueueBase::playback(BansheeEngine::Queue<QueuedCommand>* commands)
+	void CommandQueueBase::playback(QueuedCommandBuffer* commands)
 	{
 		playbackWithNotify(commands, std::function<void(UINT32)>());
 	}
 
 	void CommandQueueBase::cancelAll()
 	{
-		BansheeEngine::Queue<QueuedCommand>* commands = flush();
-
-		while(!commands->empty())
-			commands->pop();
-
-		mEmptyCommandQueues.push(commands);
+		mCommands->clear();
 	}
 
 	bool CommandQueueBase::isEmpty()
 	{
-		if(mCommands != nullptr && mCommands->size() > 0)
+		if(mCommands != nullptr && !mCommands->isEmpty())
 			return false;
 
 		return true;
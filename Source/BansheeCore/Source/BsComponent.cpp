@@ -3,11 +3,12 @@
 #include "BsComponent.h"
 #include "BsSceneObject.h"
 #include "BsComponentRTTI.h"
+#include "BsCoreSceneManager.h"
 
 namespace BansheeEngine
 {
 	Component::Component(const HSceneObject& parent)
-		:mNotifyFlags(TCF_None), mParent(parent)
+		:mNotifyFlags(TCF_None), mParent(parent), mUpdateListIdx((UINT32)-1), mUpdateIdx((UINT32)-1)
 	{
 		setName("Component");
 	}
@@ -37,6 +38,10 @@ namespace BansheeEngine
 
 	void Component::destroyInternal(GameObjectHandleBase& handle, bool immediate)
 	{
+		// Stop updates right away, even if deallocation is delayed
+		if (mUpdateIdx != (UINT32)-1)
+			gCoreSceneManager()._notifyComponentDeactivated(this);
+
 		if (immediate)
 			GameObjectManager::instance().unregisterObject(handle);
 		else
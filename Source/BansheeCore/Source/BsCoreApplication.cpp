@@ -52,7 +52,7 @@ namespace BansheeEngine
 {
 	CoreApplication::CoreApplication(START_UP_DESC desc)
 		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mFrameStep(16666), mLastFrameTime(0), mRendererPlugin(nullptr)
-		, mIsFrameRenderingFinished(true), mSimThreadId(BS_THREAD_CURRENT_ID), mRunMainLoop(false)
+		, mMaxFramesInFlight(1), mNumFramesInFlight(0), mSimThreadId(BS_THREAD_CURRENT_ID), mRunMainLoop(false)
 	{ }
 
 	CoreApplication::~CoreApplication()
@@ -117,6 +117,10 @@ namespace BansheeEngine
 	{
 		UINT32 numWorkerThreads = BS_THREAD_HARDWARE_CONCURRENCY - 1; // Number of cores while excluding current thread.
 
+		// Task scheduler workers permanently hold one pool thread per hardware thread, so the pool needs room for them on
+		// top of its regular users (core thread, async resource loads, etc.)
+		UINT32 maxPoolThreads = BS_THREAD_HARDWARE_CONCURRENCY + 16;
+
 		Platform::_startUp();
 		MemStack::beginThread();
 
@@ -124,11 +128,13 @@ namespace BansheeEngine
 		MessageHandler::startUp();
 		ProfilerCPU::startUp();
 		ProfilingManager::startUp();
-		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>((numWorkerThreads));
+		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(numWorkerThreads, maxPoolThreads);
 		TaskScheduler::startUp();
 		TaskScheduler::instance().removeWorker();
+		TaskScheduler::instance().setTaskCallbacks(&ProfilerCPU::_onTaskStarted, &ProfilerCPU::_onTaskFinished);
 		RenderStats::startUp();
-		CoreThread::startUp();
+		CoreThread::startUp(mStartUpDesc.maxFramesInFlight);
+		mMaxFramesInFlight = gCoreThread().getMaxFramesInFlight();
 		StringTableManager::startUp();
 		DeferredCallManager::startUp();
 		Time::startUp();
@@ -218,6 +224,9 @@ namespace BansheeEngine
 			preUpdate();
 
 			PROFILE_CALL(gCoreSceneManager()._update(), "SceneManager");
+
+			// Propagate transform changes made by components, so physics and audio see up to date child transforms
+			gCoreSceneManager()._updateTransforms();
 			gAudio()._update();
 			gPhysics().update();
 
@@ -230,25 +239,26 @@ namespace BansheeEngine
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			gCoreSceneManager()._updateTransforms();
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
-			// Core and sim thread run in lockstep. This will result in a larger input latency than if I was 
-			// running just a single thread. Latency becomes worse if the core thread takes longer than sim 
-			// thread, in which case sim thread needs to wait. Optimal solution would be to get an average 
-			// difference between sim/core thread and start the sim thread a bit later so they finish at nearly the same time.
+			// Sim thread may run up to mMaxFramesInFlight frames ahead of the core thread. With a single frame in flight
+			// core and sim thread run in lockstep, and frame time is the sum of both if the core thread takes longer. 
+			// Allowing more frames in flight lets the threads overlap at the cost of larger input latency. Frame 
+			// allocators (and sync data allocated from them) are sized so they outlive all frames in flight.
+			UINT64 stallTime = waitForCoreThread(mMaxFramesInFlight);
 			{
 				Lock lock(mFrameRenderingFinishedMutex);
+				mNumFramesInFlight++;
+			}
 
-				while(!mIsFrameRenderingFinished)
-				{
-					TaskScheduler::instance().addWorker();
-					mFrameRenderingFinishedCondition.wait(lock);
-					TaskScheduler::instance().removeWorker();
-				}
+			mFramePipelineStats.numFrames++;
+			mFramePipelineStats.lastStallTime = stallTime;
+			mFramePipelineStats.totalStallTime += stallTime;
 
-				mIsFrameRenderingFinished = false;
-			}
+			if (stallTime > 0)
+				mFramePipelineStats.numStalls++;
 
 			gCoreThread().queueCommand(std::bind(&CoreApplication::beginCoreProfiling, this));
 			gCoreThread().queueCommand(&Platform::_coreUpdate);
@@ -266,17 +276,34 @@ namespace BansheeEngine
 			gProfiler()._update();
 		}
 
-		// Wait until last core frame is finished before exiting
-		{
-			Lock lock(mFrameRenderingFinishedMutex);
+		// Wait until last core frame is finished before exiting. Sim thread profiling has already ended at this point.
+		waitForCoreThread(1, false);
+	}
 
-			while (!mIsFrameRenderingFinished)
-			{
-				TaskScheduler::instance().addWorker();
-				mFrameRenderingFinishedCondition.wait(lock);
-				TaskScheduler::instance().removeWorker();
-			}
+	UINT64 CoreApplication::waitForCoreThread(UINT32 maxFramesInFlight, bool profile)
+	{
+		Lock lock(mFrameRenderingFinishedMutex);
+
+		if (mNumFramesInFlight < maxFramesInFlight)
+			return 0;
+
+		if (profile)
+			gProfilerCPU().beginSample("CoreThreadStall");
+
+		UINT64 stallStart = gTime().getTimePrecise();
+
+		while (mNumFramesInFlight >= maxFramesInFlight)
+		{
+			TaskScheduler::instance().addWorker();
+			mFrameRenderingFinishedCondition.wait(lock);
+			TaskScheduler::instance().removeWorker();
 		}
+
+		UINT64 stallTime = gTime().getTimePrecise() - stallStart;
+		if (profile)
+			gProfilerCPU().endSample("CoreThreadStall");
+
+		return stallTime;
 	}
 
 	void CoreApplication::preUpdate()
@@ -309,7 +336,7 @@ namespace BansheeEngine
 	{
 		Lock lock(mFrameRenderingFinishedMutex);
 
-		mIsFrameRenderingFinished = true;
+		mNumFramesInFlight--;
 		mFrameRenderingFinishedCondition.notify_one();
 	}
 
@@ -10,10 +10,20 @@
 
 namespace BansheeEngine
 {
-	CoreObjectManager::CoreObjectManager()
-		:mNextAvailableID(1)
+	/** Dirty list of the current thread, along with the id of the manager that created it. */
+	struct ThreadDirtyListData
 	{
+		UINT32 managerId;
+		void* list;
+	};
+
+	static BS_THREADLOCAL ThreadDirtyListData CurrentThreadDirtyList = { 0, nullptr };
+	static std::atomic<UINT32> NextManagerId(1);
 
+	CoreObjectManager::CoreObjectManager()
+		:mId(NextManagerId++), mNextAvailableID(1), mCoreSyncDataStart(0), mNumCoreSyncData(0)
+	{
+		mCoreSyncData.resize(CoreThread::MAX_FRAMES_IN_FLIGHT + 1);
 	} 
 
 	CoreObjectManager::~CoreObjectManager()
@@ -31,6 +41,9 @@ namespace BansheeEngine
 				"engine objects before shutdown.");
 		}
 #endif
+
+		for (auto& dirtyList : mThreadDirtyLists)
+			bs_delete(dirtyList);
 	}
 
 	UINT64 CoreObjectManager::registerObject(CoreObject* object)
@@ -39,10 +52,17 @@ namespace BansheeEngine
 
 		Lock lock(mObjectsMutex);
 
-		mObjects[mNextAvailableID] = object;
-		mDirtyObjects[mNextAvailableID] = { object, -1 };
+		UINT64 id = mNextAvailableID++;
+		mObjects[id] = object;
+
+		// Objects start out dirty
+		ThreadDirtyList* dirtyList = getThreadDirtyList();
+		{
+			ScopedSpinLock dirtyLock(dirtyList->lock);
+			dirtyList->entries.push_back({ object, id, -1 });
+		}
 
-		return mNextAvailableID++;
+		return id;
 	}
 
 	void CoreObjectManager::unregisterObject(CoreObject* object)
@@ -54,9 +74,7 @@ namespace BansheeEngine
 		// If dirty, we generate sync data before it is destroyed
 		{
 			Lock lock(mObjectsMutex);
-			bool isDirty = object->isCoreDirty() || (mDirtyObjects.find(internalId) != mDirtyObjects.end());
-
-			if (isDirty)
+			if (object->isCoreDirty())
 			{
 				SPtr<CoreObjectCore> coreObject = object->getCore();
 				if (coreObject != nullptr)
@@ -65,18 +83,13 @@ namespace BansheeEngine
 				
 					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData));
 
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
-					dirtyObjData.syncDataId = (INT32)mDestroyedSyncData.size() - 1;
-					dirtyObjData.object = nullptr;
-				}
-				else
-				{
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
-					dirtyObjData.syncDataId = -1;
-					dirtyObjData.object = nullptr;
+					INT32 syncDataId = (INT32)mDestroyedSyncData.size() - 1;
+					mDestroyedDirtyObjects.push_back({ nullptr, internalId, syncDataId });
 				}
 			}
 
+			// Object might still be referenced by a dirty list, make sure it gets skipped
+			mDestroyedObjects.insert(internalId);
 			mObjects.erase(internalId);
 		}
 
@@ -113,11 +126,51 @@ namespace BansheeEngine
 
 	void CoreObjectManager::notifyCoreDirty(CoreObject* object)
 	{
-		UINT64 id = object->getInternalID();
+		ThreadDirtyList* dirtyList = getThreadDirtyList();
 
-		Lock lock(mObjectsMutex);
+		ScopedSpinLock lock(dirtyList->lock);
+		dirtyList->entries.push_back({ object, object->getInternalID(), -1 });
+	}
+
+	CoreObjectManager::ThreadDirtyList* CoreObjectManager::getThreadDirtyList()
+	{
+		if (CurrentThreadDirtyList.managerId != mId)
+		{
+			ThreadDirtyList* dirtyList = bs_new<ThreadDirtyList>();
+
+			{
+				Lock lock(mThreadDirtyListsMutex);
+				mThreadDirtyLists.push_back(dirtyList);
+			}
+
+			CurrentThreadDirtyList.managerId = mId;
+			CurrentThreadDirtyList.list = dirtyList;
+		}
+
+		return (ThreadDirtyList*)CurrentThreadDirtyList.list;
+	}
+
+	void CoreObjectManager::collectDirtyObjects(Vector<DirtyObjectData>& output)
+	{
+		Lock lock(mThreadDirtyListsMutex);
 
-		mDirtyObjects[id] = { object, -1 };
+		for (auto& dirtyList : mThreadDirtyLists)
+		{
+			ScopedSpinLock dirtyLock(dirtyList->lock);
+
+			if (mDestroyedObjects.empty())
+				output.insert(output.end(), dirtyList->entries.begin(), dirtyList->entries.end());
+			else
+			{
+				for (auto& entry : dirtyList->entries)
+				{
+					if (mDestroyedObjects.find(entry.internalId) == mDestroyedObjects.end())
+						output.push_back(entry);
+				}
+			}
+
+			dirtyList->entries.clear();
+		}
 	}
 
 	void CoreObjectManager::notifyDependenciesDirty(CoreObject* object)
@@ -244,11 +297,11 @@ namespace BansheeEngine
 					syncObject(dependency);
 			}
 
+			// Note: Object remains in its dirty list, but will be skipped during the next sync as it is no longer dirty
 			SPtr<CoreObjectCore> objectCore = curObj->getCore();
 			if (objectCore == nullptr)
 			{
 				curObj->markCoreClean();
-				mDirtyObjects.erase(id);
 				return;
 			}
 
@@ -259,7 +312,6 @@ namespace BansheeEngine
 			data.syncData = curObj->syncToCore(allocator);
 
 			curObj->markCoreClean();
-			mDirtyObjects.erase(id);
 		};
 
 		syncObject(object);
@@ -288,18 +340,41 @@ namespace BansheeEngine
 	{
 		Lock lock(mObjectsMutex);
 
-		mCoreSyncData.push_back(CoreStoredSyncData());
-		CoreStoredSyncData& syncData = mCoreSyncData.back();
+		if (mNumCoreSyncData == (UINT32)mCoreSyncData.size())
+		{
+			// More frames queued than expected, grow the ring while keeping the queued entries in order
+			Vector<CoreStoredSyncData> newCoreSyncData(mCoreSyncData.size() * 2);
+			for (UINT32 i = 0; i < mNumCoreSyncData; i++)
+			{
+				UINT32 idx = (mCoreSyncDataStart + i) % (UINT32)mCoreSyncData.size();
+				newCoreSyncData[i] = std::move(mCoreSyncData[idx]);
+			}
+
+			mCoreSyncData = std::move(newCoreSyncData);
+			mCoreSyncDataStart = 0;
+		}
+
+		UINT32 syncDataIdx = (mCoreSyncDataStart + mNumCoreSyncData) % (UINT32)mCoreSyncData.size();
+		mNumCoreSyncData++;
+
+		CoreStoredSyncData& syncData = mCoreSyncData[syncDataIdx];
 
 		syncData.alloc = allocator;
-		
+
+		collectDirtyObjects(mDirtyObjects);
+		mDirtyObjects.insert(mDirtyObjects.end(), mDestroyedDirtyObjects.begin(), mDestroyedDirtyObjects.end());
+
 		// Add all objects dependant on the dirty objects
 		bs_frame_mark();
 		{
 			FrameSet<CoreObject*> dirtyDependants;
 			for (auto& objectData : mDirtyObjects)
 			{
-				auto iterFind = mDependants.find(objectData.first);
+				// Skip objects that were synced individually after being marked dirty
+				if (objectData.object != nullptr && !objectData.object->isCoreDirty())
+					continue;
+
+				auto iterFind = mDependants.find(objectData.internalId);
 				if (iterFind != mDependants.end())
 				{
 					const Vector<CoreObject*>& dependants = iterFind->second;
@@ -315,17 +390,16 @@ namespace BansheeEngine
 			}
 
 			for (auto& dirtyDependant : dirtyDependants)
-			{
-				UINT64 id = dirtyDependant->getInternalID();
-
-				mDirtyObjects[id] = { dirtyDependant, -1 };
-			}
+				mDirtyObjects.push_back({ dirtyDependant, dirtyDependant->getInternalID(), -1 });
 		}
 
 		bs_frame_clear();
 		
 		// Order in which objects are recursed in matters, ones with lower ID will have been created before
 		// ones with higher ones and should be updated first.
+		std::sort(mDirtyObjects.begin(), mDirtyObjects.end(), 
+			[](const DirtyObjectData& a, const DirtyObjectData& b) { return a.internalId < b.internalId; });
+
 		for (auto& objectData : mDirtyObjects)
 		{
 			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
@@ -361,18 +435,20 @@ namespace BansheeEngine
 					curObj->getInternalID(), objSyncData));
 			};
 
-			CoreObject* object = objectData.second.object;
+			CoreObject* object = objectData.object;
 			if (object != nullptr)
 				syncObject(object);
 			else
 			{
 				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				if (objectData.syncDataId != -1)
+					syncData.entries.push_back(mDestroyedSyncData[objectData.syncDataId]);
 			}
 		}
 
 		mDirtyObjects.clear();
+		mDestroyedDirtyObjects.clear();
+		mDestroyedObjects.clear();
 		mDestroyedSyncData.clear();
 	}
 
@@ -380,10 +456,10 @@ namespace BansheeEngine
 	{
 		Lock lock(mObjectsMutex);
 
-		if (mCoreSyncData.size() == 0)
+		if (mNumCoreSyncData == 0)
 			return;
 
-		CoreStoredSyncData& syncData = mCoreSyncData.front();
+		CoreStoredSyncData& syncData = mCoreSyncData[mCoreSyncDataStart];
 
 		for (auto& objSyncData : syncData.entries)
 		{
@@ -398,7 +474,9 @@ namespace BansheeEngine
 		}
 
 		syncData.entries.clear();
-		mCoreSyncData.pop_front();
+
+		mCoreSyncDataStart = (mCoreSyncDataStart + 1) % (UINT32)mCoreSyncData.size();
+		mNumCoreSyncData--;
 	}
 
 	void CoreObjectManager::clearDirty()
@@ -406,11 +484,11 @@ namespace BansheeEngine
 		Lock lock(mObjectsMutex);
 
 		FrameAlloc* allocator = gCoreThread().getFrameAlloc();
-		for (auto& objectData : mDirtyObjects)
+		for (auto& objectData : mDestroyedDirtyObjects)
 		{
-			if (objectData.second.syncDataId != -1)
+			if (objectData.syncDataId != -1)
 			{
-				CoreStoredSyncObjData& objSyncData = mDestroyedSyncData[objectData.second.syncDataId];
+				CoreStoredSyncObjData& objSyncData = mDestroyedSyncData[objectData.syncDataId];
 
 				UINT8* data = objSyncData.syncData.getBuffer();
 
@@ -419,7 +497,11 @@ namespace BansheeEngine
 			}
 		}
 
+		collectDirtyObjects(mDirtyObjects);
+
 		mDirtyObjects.clear();
+		mDestroyedDirtyObjects.clear();
+		mDestroyedObjects.clear();
 		mDestroyedSyncData.clear();
 	}
 }
\ No newline at end of file
@@ -4,20 +4,35 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsGameObjectManager.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
 	std::function<void()> SceneManagerFactory::mFactoryMethod;
 
 	CoreSceneManager::CoreSceneManager()
+		:mIsUpdating(false)
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
+		mRootNode->mTransformId = mTransformStore.registerObject(mRootNode.get());
 	}
 
 	CoreSceneManager::~CoreSceneManager()
 	{
 		if (mRootNode != nullptr && !mRootNode.isDestroyed())
 			mRootNode->destroy(true);
+
+		// Detach any objects that outlive the manager (e.g. ones not parented to the scene root)
+		mTransformStore.clear();
+
+		for (auto& updateList : mUpdateLists)
+		{
+			for (auto& component : updateList.components)
+			{
+				if (component != nullptr)
+					component->mUpdateIdx = (UINT32)-1;
+			}
+		}
 	}
 
 	void CoreSceneManager::clearScene(bool forceAll)
@@ -72,29 +87,124 @@ namespace BansheeEngine
 
 	void CoreSceneManager::_update()
 	{
-		Stack<HSceneObject> todo;
-		todo.push(mRootNode);
+		// Make sure objects destroyed since last update (and therefore no longer in the scene) don't get updated
+		GameObjectManager::instance().destroyQueuedObjects();
 
-		while(!todo.empty())
+		// Components may be activated or deactivated as a result of an update, so lists and components are always
+		// accessed by index and size is re-checked. Deactivated components are replaced by null and removed afterwards.
+		mIsUpdating = true;
+		for (UINT32 i = 0; i < (UINT32)mUpdateLists.size(); i++)
 		{
-			HSceneObject currentGO = todo.top();
-			todo.pop();
+			UINT32 numComponents = (UINT32)mUpdateLists[i].components.size();
+			if (mUpdateLists[i].threadSafe && numComponents >= PARALLEL_UPDATE_THRESHOLD)
+			{
+				Component** components = mUpdateLists[i].components.data();
+				auto updateRange = [components](UINT32 begin, UINT32 end)
+				{
+					for (UINT32 j = begin; j < end; j++)
+					{
+						if (components[j] != nullptr)
+							components[j]->update();
+					}
+				};
+
+				TaskScheduler::instance().parallelFor(0, numComponents, PARALLEL_UPDATE_THRESHOLD / 4, updateRange);
+			}
+			else
+			{
+				for (UINT32 j = 0; j < (UINT32)mUpdateLists[i].components.size(); j++)
+				{
+					Component* component = mUpdateLists[i].components[j];
+					if (component != nullptr)
+						component->update();
+				}
+			}
+		}
+		mIsUpdating = false;
+
+		compactUpdateLists();
+		GameObjectManager::instance().destroyQueuedObjects();
+	}
 
-			if (!currentGO->getActive(true))
+	void CoreSceneManager::_notifyComponentActivated(Component* component)
+	{
+		if (component->mUpdateIdx != (UINT32)-1)
+			return;
+
+		UINT32 typeId = component->getRTTI()->getRTTIId();
+
+		UINT32 listIdx;
+		auto iterFind = mUpdateListLookup.find(typeId);
+		if (iterFind != mUpdateListLookup.end())
+			listIdx = iterFind->second;
+		else
+		{
+			listIdx = (UINT32)mUpdateLists.size();
+			mUpdateListLookup[typeId] = listIdx;
+
+			mUpdateLists.push_back(ComponentUpdateList());
+			ComponentUpdateList& newList = mUpdateLists.back();
+			newList.typeId = typeId;
+			newList.threadSafe = component->isUpdateThreadSafe();
+			newList.hasRemovals = false;
+		}
+
+		ComponentUpdateList& updateList = mUpdateLists[listIdx];
+		component->mUpdateListIdx = listIdx;
+		component->mUpdateIdx = (UINT32)updateList.components.size();
+
+		updateList.components.push_back(component);
+	}
+
+	void CoreSceneManager::_notifyComponentDeactivated(Component* component)
+	{
+		if (component->mUpdateIdx == (UINT32)-1)
+			return;
+
+		ComponentUpdateList& updateList = mUpdateLists[component->mUpdateListIdx];
+		if (mIsUpdating)
+		{
+			// Removing would move other components around while they are being iterated over
+			updateList.components[component->mUpdateIdx] = nullptr;
+			updateList.hasRemovals = true;
+		}
+		else
+		{
+			Component* lastComponent = updateList.components.back();
+			lastComponent->mUpdateIdx = component->mUpdateIdx;
+
+			updateList.components[component->mUpdateIdx] = lastComponent;
+			updateList.components.pop_back();
+		}
+
+		component->mUpdateIdx = (UINT32)-1;
+	}
+
+	void CoreSceneManager::compactUpdateLists()
+	{
+		for (auto& updateList : mUpdateLists)
+		{
+			if (!updateList.hasRemovals)
 				continue;
-			                  
-			const Vector<HComponent>& components = currentGO->getComponents();
 
-			for(auto iter = components.begin(); iter != components.end(); ++iter)
+			UINT32 numComponents = 0;
+			for (auto& component : updateList.components)
 			{
-				(*iter)->update();
+				if (component == nullptr)
+					continue;
+
+				component->mUpdateIdx = numComponents;
+				updateList.components[numComponents++] = component;
 			}
 
-			for(UINT32 i = 0; i < currentGO->getNumChildren(); i++)
-				todo.push(currentGO->getChild(i));
+			updateList.components.resize(numComponents);
+			updateList.hasRemovals = false;
 		}
+	}
 
-		GameObjectManager::instance().destroyQueuedObjects();
+	void CoreSceneManager::_updateTransforms()
+	{
+		mTransformStore.update();
 	}
 
 	void CoreSceneManager::registerNewSO(const HSceneObject& node) 
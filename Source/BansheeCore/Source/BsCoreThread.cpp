@@ -5,6 +5,7 @@
 #include "BsTaskScheduler.h"
 #include "BsFrameAlloc.h"
 #include "BsCoreApplication.h"
+#include "BsMath.h"
 
 using namespace std::placeholders;
 
@@ -13,8 +14,8 @@ namespace BansheeEngine
 	CoreThread::AccessorData CoreThread::mAccessor;
 	BS_THREADLOCAL CoreThread::AccessorContainer* CoreThread::AccessorData::current = nullptr;
 
-	CoreThread::CoreThread()
-		: mActiveFrameAlloc(0)
+	CoreThread::CoreThread(UINT32 maxFramesInFlight)
+		: mNumFrameAllocs(Math::clamp(maxFramesInFlight, 1U, MAX_FRAMES_IN_FLIGHT) + 1), mActiveFrameAlloc(0)
 		, mCoreThreadShutdown(false)
 		, mCoreThreadStarted(false)
 		, mCommandQueue(nullptr)
@@ -22,6 +23,9 @@ namespace BansheeEngine
 		, mSyncedCoreAccessor(nullptr)
 	{
 		for (UINT32 i = 0; i < NUM_FRAME_ALLOCS; i++)
+			mFrameAllocs[i] = nullptr;
+
+		for (UINT32 i = 0; i < mNumFrameAllocs; i++)
 		{
 			mFrameAllocs[i] = bs_new<FrameAlloc>();
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
@@ -56,7 +60,7 @@ namespace BansheeEngine
 			mCommandQueue = nullptr;
 		}
 
-		for (UINT32 i = 0; i < NUM_FRAME_ALLOCS; i++)
+		for (UINT32 i = 0; i < mNumFrameAllocs; i++)
 		{
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 			bs_delete(mFrameAllocs[i]);
@@ -98,7 +102,7 @@ namespace BansheeEngine
 		while(true)
 		{
 			// Wait until we get some ready commands
-			Queue<QueuedCommand>* commands = nullptr;
+			QueuedCommandBuffer* commands = nullptr;
 			{
 				Lock lock(mCommandQueueMutex);
 
@@ -243,10 +247,11 @@ namespace BansheeEngine
 
 	void CoreThread::update()
 	{
-		for (UINT32 i = 0; i < NUM_FRAME_ALLOCS; i++)
+		for (UINT32 i = 0; i < mNumFrameAllocs; i++)
 			mFrameAllocs[i]->setOwnerThread(mCoreThreadId);
 
-		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % 2;
+		// Caller must ensure the core thread is done with the frame that last used this allocator
+		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % mNumFrameAllocs;
 		mFrameAllocs[mActiveFrameAlloc]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
 		mFrameAllocs[mActiveFrameAlloc]->clear();
 	}
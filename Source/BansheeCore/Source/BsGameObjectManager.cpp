@@ -6,7 +6,8 @@
 namespace BansheeEngine
 {
 	GameObjectManager::GameObjectManager()
-		:mNextAvailableID(1), mIsDeserializationActive(false), mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
+		:mActiveDeserializedObject(nullptr), mIsDeserializationActive(false)
+		, mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
 	{
 
 	}
@@ -18,21 +19,21 @@ namespace BansheeEngine
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
 	{
-		auto iterFind = mObjects.find(id);
+		UINT32 slotIdx = findSlot(id);
 
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		if (slotIdx != INVALID_SLOT)
+			return mSlots[slotIdx].handle;
 
 		return nullptr;
 	}
 
 	bool GameObjectManager::tryGetObject(UINT64 id, GameObjectHandleBase& object) const
 	{
-		auto iterFind = mObjects.find(id);
+		UINT32 slotIdx = findSlot(id);
 
-		if (iterFind != mObjects.end())
+		if (slotIdx != INVALID_SLOT)
 		{
-			object = iterFind->second;
+			object = mSlots[slotIdx].handle;
 			return true;
 		}
 
@@ -41,7 +42,7 @@ namespace BansheeEngine
 
 	bool GameObjectManager::objectExists(UINT64 id) const
 	{
-		return mObjects.find(id) != mObjects.end();
+		return findSlot(id) != INVALID_SLOT;
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -49,8 +50,17 @@ namespace BansheeEngine
 		if (oldId == newId)
 			return;
 
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+		UINT32 slotIdx = findSlot(oldId);
+		if (slotIdx == INVALID_SLOT)
+			return;
+
+		ObjectSlot& slot = mSlots[slotIdx];
+		if (oldId != makeId(slotIdx, slot.generation))
+			mRemappedIds.erase(oldId);
+
+		slot.id = newId;
+		if (newId != makeId(slotIdx, slot.generation))
+			mRemappedIds[newId] = slotIdx;
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -58,21 +68,64 @@ namespace BansheeEngine
 		if (object.isDestroyed())
 			return;
 
-		UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		mQueuedForDestroy.push_back(object);
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		// Destroying an object can queue more objects for destruction (e.g. from Component::onDestroyed()), so the queue
+		// is moved out before iterating, and the process repeats until nothing new was queued
+		Vector<GameObjectHandleBase> toDestroy;
+		while (!mQueuedForDestroy.empty())
+		{
+			std::swap(toDestroy, mQueuedForDestroy);
+
+			// Objects may have been queued multiple times, or destroyed in some other way since they were queued
+			for (auto& object : toDestroy)
+			{
+				if (!object.isDestroyed())
+					object->destroyInternal(object, true);
+			}
+
+			toDestroy.clear();
+		}
+	}
+
+	UINT32 GameObjectManager::findSlot(UINT64 id) const
+	{
+		UINT32 slotIdx = (UINT32)(id & 0xFFFFFFFF) - 1;
+		if (slotIdx < (UINT32)mSlots.size() && mSlots[slotIdx].id == id)
+			return slotIdx;
+
+		if (mRemappedIds.empty())
+			return INVALID_SLOT;
 
-		mQueuedForDestroy.clear();
+		auto iterFind = mRemappedIds.find(id);
+		if (iterFind != mRemappedIds.end())
+			return iterFind->second;
+
+		return INVALID_SLOT;
 	}
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
 	{
-		object->initialize(object, mNextAvailableID);
+		UINT32 slotIdx;
+		if (!mFreeSlots.empty())
+		{
+			slotIdx = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+		else
+		{
+			slotIdx = (UINT32)mSlots.size();
+			mSlots.push_back(ObjectSlot());
+		}
+
+		ObjectSlot& slot = mSlots[slotIdx];
+		UINT64 instanceId = makeId(slotIdx, slot.generation);
+
+		object->initialize(object, instanceId);
+		slot.id = instanceId;
 
 		// If deserialization is active we must ensure all handles pointing to the same object share GameObjectHandleData,
 		// so check if any handles referencing this object have been created. See ::registerUnresolvedHandle for
@@ -88,9 +141,8 @@ namespace BansheeEngine
 				handle.mData = iterFind->second;
 				handle._setHandleData(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
+				slot.handle = handle;
+				mIdMapping[originalId] = instanceId;
 
 				return handle;
 			}
@@ -98,24 +150,37 @@ namespace BansheeEngine
 			{
 				GameObjectHandleBase handle(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
+				slot.handle = handle;
+				mIdMapping[originalId] = instanceId;
 
 				return handle;
 			}
 		}
 
 		GameObjectHandleBase handle(object);
-		mObjects[mNextAvailableID] = handle;
-		mNextAvailableID++;
+		slot.handle = handle;
 
 		return handle;
 	}
 
 	void GameObjectManager::unregisterObject(GameObjectHandleBase& object)
 	{
-		mObjects.erase(object->getInstanceId());
+		UINT64 instanceId = object->getInstanceId();
+		UINT32 slotIdx = findSlot(instanceId);
+
+		if (slotIdx != INVALID_SLOT)
+		{
+			ObjectSlot& slot = mSlots[slotIdx];
+			if (instanceId != makeId(slotIdx, slot.generation))
+				mRemappedIds.erase(instanceId);
+
+			// Bumping the generation ensures the old ID can't resolve to a new object placed in this slot
+			slot.handle = nullptr;
+			slot.id = 0;
+			slot.generation++;
+
+			mFreeSlots.push_back(slotIdx);
+		}
 
 		onDestroyed(object);
 		object.destroy();
@@ -167,10 +232,10 @@ namespace BansheeEngine
 
 		if (isInternalReference || (!isInternalReference && (flags & GODM_RestoreExternal) != 0))
 		{
-			auto findIterObj = mObjects.find(instanceId);
+			UINT32 slotIdx = findSlot(instanceId);
 
-			if (findIterObj != mObjects.end())
-				data.handle._resolve(findIterObj->second);
+			if (slotIdx != INVALID_SLOT)
+				data.handle._resolve(mSlots[slotIdx].handle);
 			else
 			{
 				if ((flags & GODM_KeepMissing) == 0)
@@ -205,10 +270,10 @@ namespace BansheeEngine
 		auto iterFind = mIdMapping.find(originalId);
 		if (iterFind != mIdMapping.end())
 		{
-			auto iterFind2 = mObjects.find(iterFind->second);
-			if (iterFind2 != mObjects.end())
+			UINT32 slotIdx = findSlot(iterFind->second);
+			if (slotIdx != INVALID_SLOT)
 			{
-				object.mData = iterFind2->second.mData;
+				object.mData = mSlots[slotIdx].handle.mData;
 				foundHandleData = true;
 			}
 		}
@@ -56,8 +56,6 @@ namespace BansheeEngine
 			UINT32 diffSize = elementSizeBytes - sizeBytes;
 			paramBlock->zeroOut((mParamDesc->cpuMemOffset + arrayIdx * mParamDesc->arrayElementStride)  * sizeof(UINT32) + sizeBytes, diffSize);
 		}
-
-		mParent->_markCoreDirty();
 	}
 
 	template<class T, bool Core>
@@ -136,8 +134,6 @@ namespace BansheeEngine
 			UINT32 diffSize = elementSizeBytes - sizeBytes;
 			paramBlock->zeroOut((mParamDesc->cpuMemOffset + arrayIdx * mParamDesc->arrayElementStride)  * sizeof(UINT32) + sizeBytes, diffSize);
 		}
-
-		mParent->_markCoreDirty();
 	}
 
 	template<bool Core>
@@ -196,9 +192,6 @@ namespace BansheeEngine
 			return;
 
 		mParent->setTexture(mParamDesc->slot, texture);
-
-		mParent->_markResourcesDirty();
-		mParent->_markCoreDirty();
 	}
 
 	template<bool Core>
@@ -227,9 +220,6 @@ namespace BansheeEngine
 			return;
 
 		mParent->setLoadStoreTexture(mParamDesc->slot, texture, surface);
-
-		mParent->_markResourcesDirty();
-		mParent->_markCoreDirty();
 	}
 
 	template<bool Core>
@@ -258,9 +248,6 @@ namespace BansheeEngine
 			return;
 
 		mParent->setSamplerState(mParamDesc->slot, samplerState);
-
-		mParent->_markResourcesDirty();
-		mParent->_markCoreDirty();
 	}
 
 	template<bool Core>
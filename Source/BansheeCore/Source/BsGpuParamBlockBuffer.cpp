@@ -76,9 +76,13 @@ namespace BansheeEngine
 
 	void GpuParamBlockBufferCore::syncToCore(const CoreSyncData& data)
 	{
-		assert(mSize == data.getBufferSize());
+		assert(data.getBufferSize() >= sizeof(UINT32));
 
-		write(0, data.getBuffer(), data.getBufferSize());
+		UINT32 offset = *(UINT32*)data.getBuffer();
+		UINT32 size = data.getBufferSize() - sizeof(UINT32);
+
+		if (size > 0)
+			write(offset, data.getBuffer() + sizeof(UINT32), size);
 	}
 
 	SPtr<GpuParamBlockBufferCore> GpuParamBlockBufferCore::create(UINT32 size, GpuParamBlockUsage usage)
@@ -87,7 +91,7 @@ namespace BansheeEngine
 	}
 
 	GpuParamBlockBuffer::GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage)
-		:mUsage(usage), mSize(size), mCachedData(nullptr)
+		:mUsage(usage), mSize(size), mCachedData(nullptr), mDirtyStart(size), mDirtyEnd(0)
 	{
 		if (mSize > 0)
 			mCachedData = (UINT8*)bs_alloc(mSize);
@@ -113,7 +117,7 @@ namespace BansheeEngine
 #endif
 
 		memcpy(mCachedData + offset, data, size);
-		markCoreDirty();
+		markRangeDirty(offset, size);
 	}
 
 	void GpuParamBlockBuffer::read(UINT32 offset, void* data, UINT32 size)
@@ -142,6 +146,14 @@ namespace BansheeEngine
 #endif
 
 		memset(mCachedData + offset, 0, size);
+		markRangeDirty(offset, size);
+	}
+
+	void GpuParamBlockBuffer::markRangeDirty(UINT32 offset, UINT32 size)
+	{
+		mDirtyStart = std::min(mDirtyStart, offset);
+		mDirtyEnd = std::max(mDirtyEnd, offset + size);
+
 		markCoreDirty();
 	}
 
@@ -157,10 +169,27 @@ namespace BansheeEngine
 
 	CoreSyncData GpuParamBlockBuffer::syncToCore(FrameAlloc* allocator)
 	{
-		UINT8* buffer = allocator->alloc(mSize);
-		read(0, buffer, mSize);
+		// Only send the bytes modified since the last sync, so that changing a single parameter doesn't require the entire
+		// buffer to be copied
+		UINT32 offset = 0;
+		UINT32 size = 0;
+		if (mDirtyEnd > mDirtyStart)
+		{
+			offset = mDirtyStart;
+			size = mDirtyEnd - mDirtyStart;
+		}
+
+		UINT32 totalSize = sizeof(UINT32) + size;
+		UINT8* buffer = allocator->alloc(totalSize);
+		memcpy(buffer, &offset, sizeof(UINT32));
+
+		if (size > 0)
+			read(offset, buffer + sizeof(UINT32), size);
+
+		mDirtyStart = mSize;
+		mDirtyEnd = 0;
 
-		return CoreSyncData(buffer, mSize);
+		return CoreSyncData(buffer, totalSize);
 	}
 
 	SPtr<GpuParamBlockBuffer> GpuParamBlockBuffer::create(UINT32 size, GpuParamBlockUsage usage)
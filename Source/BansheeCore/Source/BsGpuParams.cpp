@@ -131,6 +131,23 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 		mLoadStoreSurfaces[slot] = surface;
 	}
 
+	UINT32 GpuParamsBase::getNumSlots(GpuParamSlotType type) const
+	{
+		switch (type)
+		{
+		case GPST_PARAM_BLOCK:
+			return mNumParamBlocks;
+		case GPST_TEXTURE:
+			return mNumTextures;
+		case GPST_LOAD_STORE_TEXTURE:
+			return mNumLoadStoreTextures;
+		case GPST_SAMPLER_STATE:
+			return mNumSamplerStates;
+		default:
+			return 0;
+		}
+	}
+
 	template<bool Core>
 	TGpuParams<Core>::TGpuParams(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices)
 		: GpuParamsBase(paramDesc, transposeMatrices), mParamBlockBuffers(nullptr), mTextures(nullptr)
@@ -176,7 +193,7 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 
 		mParamBlockBuffers[slot] = paramBlockBuffer;
 
-		_markCoreDirty();
+		_markSlotDirty(GPST_PARAM_BLOCK, slot);
 	}
 
 	template<bool Core>
@@ -192,7 +209,7 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 
 		mParamBlockBuffers[iterFind->second.slot] = paramBlockBuffer;
 
-		_markCoreDirty();
+		_markSlotDirty(GPST_PARAM_BLOCK, iterFind->second.slot);
 	}
 
 	template<bool Core>
@@ -326,7 +343,7 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 		mTextures[slot] = texture;
 
 		_markResourcesDirty();
-		_markCoreDirty();
+		_markSlotDirty(GPST_TEXTURE, slot);
 	}
 
 	template<bool Core>
@@ -339,9 +356,10 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 		}
 
 		mLoadStoreTextures[slot] = texture;
+		mLoadStoreSurfaces[slot] = surface;
 
 		_markResourcesDirty();
-		_markCoreDirty();
+		_markSlotDirty(GPST_LOAD_STORE_TEXTURE, slot);
 	}
 
 	template<bool Core>
@@ -356,7 +374,7 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 		mSamplerStates[slot] = sampler;
 
 		_markResourcesDirty();
-		_markCoreDirty();
+		_markSlotDirty(GPST_SAMPLER_STATE, slot);
 	}
 
 	template class TGpuParams < false > ;
@@ -424,56 +442,69 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 
 	void GpuParamsCore::syncToCore(const CoreSyncData& data)
 	{
-		UINT32 loadStoreSurfacesSize = mNumLoadStoreTextures * sizeof(TextureSurface);
-		UINT32 paramBufferSize = mNumParamBlocks * sizeof(SPtr<GpuParamBlockBufferCore>);
-		UINT32 textureArraySize = mNumTextures * sizeof(SPtr<TextureCore>);
-		UINT32 loadStoreTextureArraySize = mNumLoadStoreTextures * sizeof(SPtr<TextureCore>);
-		UINT32 samplerArraySize = mNumSamplerStates * sizeof(SPtr<SamplerStateCore>);
+		UINT8* dataPtr = data.getBuffer();
 
-		UINT32 totalSize = loadStoreSurfacesSize + paramBufferSize + textureArraySize + loadStoreTextureArraySize
-			+ samplerArraySize;
+		UINT32 numDirty[GPST_COUNT];
+		memcpy(numDirty, dataPtr, sizeof(numDirty));
 
-		UINT32 textureInfoOffset = 0;
-		UINT32 paramBufferOffset = textureInfoOffset + loadStoreSurfacesSize;
+		UINT32 totalNumDirty = 0;
+		for (UINT32 i = 0; i < GPST_COUNT; i++)
+			totalNumDirty += numDirty[i];
+
+		UINT32 headerSize = sizeof(numDirty);
+		UINT32 paramBufferSize = numDirty[GPST_PARAM_BLOCK] * sizeof(SPtr<GpuParamBlockBufferCore>);
+		UINT32 textureArraySize = numDirty[GPST_TEXTURE] * sizeof(SPtr<TextureCore>);
+		UINT32 loadStoreTextureArraySize = numDirty[GPST_LOAD_STORE_TEXTURE] * sizeof(SPtr<TextureCore>);
+		UINT32 samplerArraySize = numDirty[GPST_SAMPLER_STATE] * sizeof(SPtr<SamplerStateCore>);
+		UINT32 loadStoreSurfacesSize = numDirty[GPST_LOAD_STORE_TEXTURE] * sizeof(TextureSurface);
+		UINT32 slotsSize = totalNumDirty * sizeof(UINT32);
+
+		UINT32 totalSize = headerSize + paramBufferSize + textureArraySize + loadStoreTextureArraySize + samplerArraySize
+			+ loadStoreSurfacesSize + slotsSize;
+
+		UINT32 paramBufferOffset = headerSize;
 		UINT32 textureArrayOffset = paramBufferOffset + paramBufferSize;
 		UINT32 loadStoreTextureArrayOffset = textureArrayOffset + textureArraySize;
 		UINT32 samplerArrayOffset = loadStoreTextureArrayOffset + loadStoreTextureArraySize;
+		UINT32 loadStoreSurfacesOffset = samplerArrayOffset + samplerArraySize;
+		UINT32 slotsOffset = loadStoreSurfacesOffset + loadStoreSurfacesSize;
 
 		assert(data.getBufferSize() == totalSize);
 
-		UINT8* dataPtr = data.getBuffer();
-
-		TextureSurface* loadStoreSurfaces = (TextureSurface*)(dataPtr + textureInfoOffset);
 		SPtr<GpuParamBlockBufferCore>* paramBuffers = (SPtr<GpuParamBlockBufferCore>*)(dataPtr + paramBufferOffset);
 		SPtr<TextureCore>* textures = (SPtr<TextureCore>*)(dataPtr + textureArrayOffset);
 		SPtr<TextureCore>* loadStoreTextures = (SPtr<TextureCore>*)(dataPtr + loadStoreTextureArrayOffset);
 		SPtr<SamplerStateCore>* samplers = (SPtr<SamplerStateCore>*)(dataPtr + samplerArrayOffset);
+		TextureSurface* loadStoreSurfaces = (TextureSurface*)(dataPtr + loadStoreSurfacesOffset);
+		UINT32* slots = (UINT32*)(dataPtr + slotsOffset);
 
 		// Copy & destruct
-		for (UINT32 i = 0; i < mNumParamBlocks; i++)
+		for (UINT32 i = 0; i < numDirty[GPST_PARAM_BLOCK]; i++)
 		{
-			mParamBlockBuffers[i] = paramBuffers[i];
+			mParamBlockBuffers[*slots++] = paramBuffers[i];
 			paramBuffers[i].~SPtr<GpuParamBlockBufferCore>();
 		}
 
-		for (UINT32 i = 0; i < mNumTextures; i++)
+		for (UINT32 i = 0; i < numDirty[GPST_TEXTURE]; i++)
 		{
-			mTextures[i] = textures[i];
+			mTextures[*slots++] = textures[i];
 			textures[i].~SPtr<TextureCore>();
 		}
 
-		for (UINT32 i = 0; i < mNumLoadStoreTextures; i++)
+		for (UINT32 i = 0; i < numDirty[GPST_LOAD_STORE_TEXTURE]; i++)
 		{
-			mLoadStoreSurfaces[i] = loadStoreSurfaces[i];
+			UINT32 slot = *slots++;
+
+			mLoadStoreSurfaces[slot] = loadStoreSurfaces[i];
 			loadStoreSurfaces[i].~TextureSurface();
 
-			mLoadStoreTextures[i] = loadStoreTextures[i];
+			mLoadStoreTextures[slot] = loadStoreTextures[i];
 			loadStoreTextures[i].~SPtr<TextureCore>();
 		}
 
-		for (UINT32 i = 0; i < mNumSamplerStates; i++)
+		for (UINT32 i = 0; i < numDirty[GPST_SAMPLER_STATE]; i++)
 		{
-			mSamplerStates[i] = samplers[i];
+			mSamplerStates[*slots++] = samplers[i];
 			samplers[i].~SPtr<SamplerStateCore>();
 		}
 	}
@@ -490,9 +521,28 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 	const GpuDataParamInfos GpuParams::PARAM_SIZES;
 
 	GpuParams::GpuParams(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices)
-		: TGpuParams(paramDesc, transposeMatrices)
+		: TGpuParams(paramDesc, transposeMatrices), mSyncAllSlots(true)
 	{
+		for (UINT32 i = 0; i < GPST_COUNT; i++)
+		{
+			UINT32 numSlots = getNumSlots((GpuParamSlotType)i);
+			if (numSlots > 0)
+			{
+				mDirtySlots[i] = (UINT8*)bs_alloc(numSlots);
+				memset(mDirtySlots[i], 0, numSlots);
+			}
+			else
+				mDirtySlots[i] = nullptr;
+		}
+	}
 
+	GpuParams::~GpuParams()
+	{
+		for (UINT32 i = 0; i < GPST_COUNT; i++)
+		{
+			if (mDirtySlots[i] != nullptr)
+				bs_free(mDirtySlots[i]);
+		}
 	}
 
 	SPtr<GpuParams> GpuParams::_getThisPtr() const
@@ -517,6 +567,13 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 
 	void GpuParams::_markCoreDirty()
 	{
+		mSyncAllSlots = true;
+		markCoreDirty();
+	}
+
+	void GpuParams::_markSlotDirty(GpuParamSlotType type, UINT32 slot)
+	{
+		mDirtySlots[type][slot] = 1;
 		markCoreDirty();
 	}
 
@@ -537,69 +594,127 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 
 	CoreSyncData GpuParams::syncToCore(FrameAlloc* allocator)
 	{
-		UINT32 loadStoreSurfacesSize = mNumLoadStoreTextures * sizeof(TextureSurface);
-		UINT32 paramBufferSize = mNumParamBlocks * sizeof(SPtr<GpuParamBlockBufferCore>);
-		UINT32 textureArraySize = mNumTextures * sizeof(SPtr<TextureCore>);
-		UINT32 loadStoreTextureArraySize = mNumLoadStoreTextures * sizeof(SPtr<TextureCore>);
-		UINT32 samplerArraySize = mNumSamplerStates * sizeof(SPtr<SamplerStateCore>);
+		// Only the modified slots are sent, along with their indices. Data parameters are not part of the sync at all, as
+		// parameter block buffers sync their own contents.
+		UINT32 numDirty[GPST_COUNT];
+		UINT32 totalNumDirty = 0;
+		for (UINT32 i = 0; i < GPST_COUNT; i++)
+		{
+			UINT32 numSlots = getNumSlots((GpuParamSlotType)i);
+
+			numDirty[i] = 0;
+			for (UINT32 j = 0; j < numSlots; j++)
+			{
+				if (mSyncAllSlots || mDirtySlots[i][j] != 0)
+					numDirty[i]++;
+			}
+
+			totalNumDirty += numDirty[i];
+		}
 
-		UINT32 totalSize = loadStoreSurfacesSize + paramBufferSize + textureArraySize + loadStoreTextureArraySize 
-			+ samplerArraySize;
+		UINT32 headerSize = sizeof(numDirty);
+		UINT32 paramBufferSize = numDirty[GPST_PARAM_BLOCK] * sizeof(SPtr<GpuParamBlockBufferCore>);
+		UINT32 textureArraySize = numDirty[GPST_TEXTURE] * sizeof(SPtr<TextureCore>);
+		UINT32 loadStoreTextureArraySize = numDirty[GPST_LOAD_STORE_TEXTURE] * sizeof(SPtr<TextureCore>);
+		UINT32 samplerArraySize = numDirty[GPST_SAMPLER_STATE] * sizeof(SPtr<SamplerStateCore>);
+		UINT32 loadStoreSurfacesSize = numDirty[GPST_LOAD_STORE_TEXTURE] * sizeof(TextureSurface);
+		UINT32 slotsSize = totalNumDirty * sizeof(UINT32);
 
-		UINT32 textureInfoOffset = 0;
-		UINT32 paramBufferOffset = textureInfoOffset + loadStoreSurfacesSize;
+		UINT32 totalSize = headerSize + paramBufferSize + textureArraySize + loadStoreTextureArraySize + samplerArraySize
+			+ loadStoreSurfacesSize + slotsSize;
+
+		UINT32 paramBufferOffset = headerSize;
 		UINT32 textureArrayOffset = paramBufferOffset + paramBufferSize;
 		UINT32 loadStoreTextureArrayOffset = textureArrayOffset + textureArraySize;
 		UINT32 samplerArrayOffset = loadStoreTextureArrayOffset + loadStoreTextureArraySize;
+		UINT32 loadStoreSurfacesOffset = samplerArrayOffset + samplerArraySize;
+		UINT32 slotsOffset = loadStoreSurfacesOffset + loadStoreSurfacesSize;
 
 		UINT8* data = allocator->alloc(totalSize);
+		memcpy(data, numDirty, headerSize);
 
-		TextureSurface* loadStoreSurfaces = (TextureSurface*)(data + textureInfoOffset);
 		SPtr<GpuParamBlockBufferCore>* paramBuffers = (SPtr<GpuParamBlockBufferCore>*)(data + paramBufferOffset);
 		SPtr<TextureCore>* textures = (SPtr<TextureCore>*)(data + textureArrayOffset);
 		SPtr<TextureCore>* loadStoreTextures = (SPtr<TextureCore>*)(data + loadStoreTextureArrayOffset);
 		SPtr<SamplerStateCore>* samplers = (SPtr<SamplerStateCore>*)(data + samplerArrayOffset);
+		TextureSurface* loadStoreSurfaces = (TextureSurface*)(data + loadStoreSurfacesOffset);
+		UINT32* slots = (UINT32*)(data + slotsOffset);
 
 		// Construct & copy
+		UINT32 idx = 0;
 		for (UINT32 i = 0; i < mNumParamBlocks; i++)
 		{
-			new (&paramBuffers[i]) SPtr<GpuParamBlockBufferCore>();
+			if (!mSyncAllSlots && mDirtySlots[GPST_PARAM_BLOCK][i] == 0)
+				continue;
+
+			new (&paramBuffers[idx]) SPtr<GpuParamBlockBufferCore>();
 
 			if (mParamBlockBuffers[i] != nullptr)
-				paramBuffers[i] = mParamBlockBuffers[i]->getCore();
+				paramBuffers[idx] = mParamBlockBuffers[i]->getCore();
+
+			*slots++ = i;
+			idx++;
 		}
 
+		idx = 0;
 		for (UINT32 i = 0; i < mNumTextures; i++)
 		{
-			new (&textures[i]) SPtr<TextureCore>();
+			if (!mSyncAllSlots && mDirtySlots[GPST_TEXTURE][i] == 0)
+				continue;
+
+			new (&textures[idx]) SPtr<TextureCore>();
 
 			if (mTextures[i].isLoaded())
-				textures[i] = mTextures[i]->getCore();
+				textures[idx] = mTextures[i]->getCore();
 			else
-				textures[i] = nullptr;
+				textures[idx] = nullptr;
+
+			*slots++ = i;
+			idx++;
 		}
 
+		idx = 0;
 		for (UINT32 i = 0; i < mNumLoadStoreTextures; i++)
 		{
-			new (&loadStoreSurfaces[i]) TextureSurface();
-			loadStoreSurfaces[i] = mLoadStoreSurfaces[i];
+			if (!mSyncAllSlots && mDirtySlots[GPST_LOAD_STORE_TEXTURE][i] == 0)
+				continue;
+
+			new (&loadStoreSurfaces[idx]) TextureSurface();
+			loadStoreSurfaces[idx] = mLoadStoreSurfaces[i];
 
-			new (&loadStoreTextures[i]) SPtr<TextureCore>();
+			new (&loadStoreTextures[idx]) SPtr<TextureCore>();
 
 			if (mLoadStoreTextures[i].isLoaded())
-				loadStoreTextures[i] = mLoadStoreTextures[i]->getCore();
+				loadStoreTextures[idx] = mLoadStoreTextures[i]->getCore();
 			else
-				loadStoreTextures[i] = nullptr;
+				loadStoreTextures[idx] = nullptr;
+
+			*slots++ = i;
+			idx++;
 		}
 
+		idx = 0;
 		for (UINT32 i = 0; i < mNumSamplerStates; i++)
 		{
-			new (&samplers[i]) SPtr<SamplerStateCore>();
+			if (!mSyncAllSlots && mDirtySlots[GPST_SAMPLER_STATE][i] == 0)
+				continue;
+
+			new (&samplers[idx]) SPtr<SamplerStateCore>();
 
 			if (mSamplerStates[i] != nullptr)
-				samplers[i] = mSamplerStates[i]->getCore();
+				samplers[idx] = mSamplerStates[i]->getCore();
 			else
-				samplers[i] = nullptr;
+				samplers[idx] = nullptr;
+
+			*slots++ = i;
+			idx++;
+		}
+
+		mSyncAllSlots = false;
+		for (UINT32 i = 0; i < GPST_COUNT; i++)
+		{
+			if (mDirtySlots[i] != nullptr)
+				memset(mDirtySlots[i], 0, getNumSlots((GpuParamSlotType)i));
 		}
 
 		return CoreSyncData(data, totalSize);
@@ -4,6 +4,8 @@
 #include "BsGpuResourceDataRTTI.h"
 #include "BsCoreThread.h"
 #include "BsException.h"
+#include "BsDataStream.h"
+#include "BsMappedFile.h"
 
 namespace BansheeEngine
 {
@@ -18,6 +20,7 @@ namespace BansheeEngine
 		mData = copy.mData;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mMappedFile = copy.mMappedFile;
 	}
 
 	GpuResourceData::~GpuResourceData()
@@ -30,6 +33,7 @@ namespace BansheeEngine
 		mData = rhs.mData;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mMappedFile = rhs.mMappedFile;
 
 		return *this;
 	}
@@ -70,6 +74,12 @@ namespace BansheeEngine
 
 	void GpuResourceData::freeInternalBuffer()
 	{
+		if (mMappedFile != nullptr)
+		{
+			mData = nullptr;
+			mMappedFile = nullptr;
+		}
+
 		if(mData == nullptr || !mOwnsData)
 			return;
 
@@ -101,6 +111,23 @@ namespace BansheeEngine
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::readInternalBuffer(const SPtr<DataStream>& stream, UINT32 size)
+	{
+		SPtr<MappedFile> mappedFile = stream->getMappedFile();
+		if (mappedFile == nullptr || size > stream->size() - stream->tell())
+		{
+			allocateInternalBuffer(size);
+			stream->read(mData, size);
+
+			return;
+		}
+
+		setExternalBuffer(static_cast<MappedFileDataStream*>(stream.get())->getCurrentPtr());
+		mMappedFile = mappedFile;
+
+		stream->skip(size);
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
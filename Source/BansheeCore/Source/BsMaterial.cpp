@@ -1156,6 +1156,8 @@ namespace BansheeEngine
 
 	CoreSyncData Material::syncToCore(FrameAlloc* allocator)
 	{
+		// Only structural data is synced here, which changes only when the shader or technique changes. Parameter values
+		// are synced by the individual GpuParams and parameter block buffers, which send only the modified slots and bytes.
 		UINT32 numPasses = (UINT32)mParametersPerPass.size();
 
 		UINT32 size = sizeof(UINT32) + numPasses * sizeof(SPtr<PassParametersCore>)
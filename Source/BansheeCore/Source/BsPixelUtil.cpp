@@ -5,8 +5,17 @@
 #include "BsColor.h"
 #include "BsMath.h"
 #include "BsException.h"
+#include "BsTaskScheduler.h"
 #include <nvtt.h>
 
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+	// SSE2 is part of the x86-64 baseline, so no runtime detection is needed
+	#include <emmintrin.h>
+	#define BS_PIXEL_CONVERSION_SSE2 1
+#else
+	#define BS_PIXEL_CONVERSION_SSE2 0
+#endif
+
 namespace BansheeEngine 
 {
 	/**
@@ -827,49 +836,686 @@ namespace BansheeEngine
         return _pixelFormats[ord];
     }
 
-	/**	Handles compression output from NVTT library for a single image. */
-	struct NVTTCompressOutputHandler : public nvtt::OutputHandler
+	/** Number of pixels converted at once by the specialized conversion paths. */
+	static const UINT32 FAST_CONVERSION_CHUNK = 256;
+
+	/** 
+	 * Describes where the channels of a format with 8-bit components are located within a pixel. Used by the specialized
+	 * conversion paths, which produce the same results as unpackColor()/packColor() (see fastPixelConversion() for the
+	 * exceptions).
+	 */
+	struct ByteFormatLayout
 	{
-		NVTTCompressOutputHandler(UINT8* buffer, UINT32 sizeBytes)
-			:buffer(buffer), bufferWritePos(buffer), bufferEnd(buffer + sizeBytes)
-		{ }
+		UINT32 pixelSize;
+		INT32 readOffsets[4]; /**< Byte offset to read each of the RGBA channels from, or -1 if not stored. */
+		INT32 writeOffsets[4]; /**< Byte offset to write each of the RGBA channels to, or -1 if not stored. */
+		UINT32 fill; /**< Value of missing channels when unpacking (alpha reads as opaque), in RGBA8 form. */
+	};
 
-		virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel) override
-		{ }
+	/** Fills out the byte layout of the provided format. Returns false if the format doesn't have 8-bit components. */
+	static bool getByteFormatLayout(PixelFormat format, ByteFormatLayout& layout)
+	{
+		const PixelFormatDescription& desc = getDescriptionFor(format);
+		if (desc.componentType != PCT_BYTE || (desc.flags & (PFF_COMPRESSED | PFF_DEPTH)) != 0)
+			return false;
 
-		virtual bool writeData(const void* data, int size) override
+		if (desc.elemBytes == 0 || desc.elemBytes > 4)
+			return false;
+
+		UINT8 bits[4] = { desc.rbits, desc.gbits, desc.bbits, desc.abits };
+		UINT8 shifts[4] = { desc.rshift, desc.gshift, desc.bshift, desc.ashift };
+
+		layout.pixelSize = desc.elemBytes;
+		for (UINT32 i = 0; i < 4; i++)
 		{
-			assert((bufferWritePos + size) <= bufferEnd);
-			memcpy(bufferWritePos, data, size);
-			bufferWritePos += size;
+			if (bits[i] != 0 && bits[i] != 8)
+				return false;
+
+			// Channels without bits are never written by packColor(), even if they have a mask (e.g. X8 padding). On little
+			// endian platforms the shift of a channel also determines its byte offset.
+			layout.writeOffsets[i] = bits[i] == 8 ? shifts[i] / 8 : -1;
+			layout.readOffsets[i] = layout.writeOffsets[i];
+		}
+
+		// Formats flagged as having alpha but with no alpha bits (R8G8B8X8, B8G8R8X8) read alpha as zero. unpackColor()
+		// divides by zero for those instead, returning NaN or infinity.
+		layout.fill = 0;
+		if ((desc.flags & PFF_HASALPHA) == 0)
+		{
+			layout.readOffsets[3] = -1;
+			layout.fill = 0xFF000000;
+		}
+
+		return true;
+	}
+
+	/** Converts pixels in a format with 8-bit components into RGBA8 values (red in the lowest byte). */
+	static void unpackBytes(const ByteFormatLayout& layout, const UINT8* src, UINT32 count, UINT32* dst)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_CONVERSION_SSE2
+		if (layout.pixelSize == 4)
+		{
+			const __m128i byteMask = _mm_set1_epi32(0xFF);
+			const __m128i fill = _mm_set1_epi32((int)layout.fill);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i input = _mm_loadu_si128((const __m128i*)(src + i * 4));
+				__m128i output = fill;
+
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					if (layout.readOffsets[j] < 0)
+						continue;
+
+					__m128i channel = _mm_srl_epi32(input, _mm_cvtsi32_si128(layout.readOffsets[j] * 8));
+					channel = _mm_and_si128(channel, byteMask);
+					output = _mm_or_si128(output, _mm_sll_epi32(channel, _mm_cvtsi32_si128(j * 8)));
+				}
+
+				_mm_storeu_si128((__m128i*)(dst + i), output);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			const UINT8* pixel = src + i * layout.pixelSize;
+
+			UINT32 value = layout.fill;
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (layout.readOffsets[j] >= 0)
+					value |= (UINT32)pixel[layout.readOffsets[j]] << (j * 8);
+			}
+
+			dst[i] = value;
+		}
+	}
+
+	/** Converts RGBA8 values (red in the lowest byte) into pixels in a format with 8-bit components. */
+	static void packBytes(const ByteFormatLayout& layout, const UINT32* src, UINT32 count, UINT8* dst)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_CONVERSION_SSE2
+		if (layout.pixelSize == 4)
+		{
+			const __m128i byteMask = _mm_set1_epi32(0xFF);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+				__m128i output = _mm_setzero_si128();
+
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					if (layout.writeOffsets[j] < 0)
+						continue;
+
+					__m128i channel = _mm_and_si128(_mm_srl_epi32(input, _mm_cvtsi32_si128(j * 8)), byteMask);
+					output = _mm_or_si128(output, _mm_sll_epi32(channel, _mm_cvtsi32_si128(layout.writeOffsets[j] * 8)));
+				}
+
+				_mm_storeu_si128((__m128i*)(dst + i * 4), output);
+			}
+		}
+#endif
 
+		for (; i < count; i++)
+		{
+			UINT8* pixel = dst + i * layout.pixelSize;
+			for (UINT32 j = 0; j < layout.pixelSize; j++)
+				pixel[j] = 0;
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (layout.writeOffsets[j] >= 0)
+					pixel[layout.writeOffsets[j]] = (UINT8)(src[i] >> (j * 8));
+			}
+		}
+	}
+
+	/** Converts RGBA8 values into RGBA floats, same as Bitwise::fixedToFloat(). */
+	static void bytesToFloats(const UINT32* src, UINT32 count, float* dst)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_CONVERSION_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128 scale = _mm_set1_ps(255.0f);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+			__m128i low = _mm_unpacklo_epi8(input, zero);
+			__m128i high = _mm_unpackhi_epi8(input, zero);
+
+			// Division rather than multiplication by a reciprocal, so results match the scalar path exactly
+			float* output = dst + i * 4;
+			_mm_storeu_ps(output + 0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+			_mm_storeu_ps(output + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+			_mm_storeu_ps(output + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+			_mm_storeu_ps(output + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+				dst[i * 4 + j] = Bitwise::fixedToFloat((src[i] >> (j * 8)) & 0xFF, 8);
+		}
+	}
+
+	/** Converts RGBA floats into RGBA8 values, same as Bitwise::floatToFixed(). */
+	static void floatsToBytes(const float* src, UINT32 count, UINT32* dst)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_CONVERSION_SSE2
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 scale = _mm_set1_ps(256.0f);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const float* input = src + i * 4;
+
+			// Values >= 1 become 256 and negative values stay negative, both then get saturated by the packs
+			__m128i p0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(input + 0), one), scale));
+			__m128i p1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(input + 4), one), scale));
+			__m128i p2 = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(input + 8), one), scale));
+			__m128i p3 = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(input + 12), one), scale));
+
+			__m128i output = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+			_mm_storeu_si128((__m128i*)(dst + i), output);
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			UINT32 value = 0;
+			for (UINT32 j = 0; j < 4; j++)
+				value |= Bitwise::floatToFixed(src[i * 4 + j], 8) << (j * 8);
+
+			dst[i] = value;
+		}
+	}
+
+	/** Reads a single component of a floating point format. */
+	inline float readFloatComponent(float value) { return value; }
+	inline float readFloatComponent(UINT16 value) { return Bitwise::halfToFloat(value); }
+
+	/** Writes a single component of a floating point format. */
+	inline void writeFloatComponent(float value, float& output) { output = value; }
+	inline void writeFloatComponent(float value, UINT16& output) { output = Bitwise::floatToHalf(value); }
+
+	/** 
+	 * Converts pixels in a floating point format into RGBA floats. Missing channels are filled the same way as in
+	 * unpackColor().
+	 */
+	template<class T, UINT32 numChannels>
+	static void unpackFloatPixels(const UINT8* src, UINT32 count, float* dst)
+	{
+		const T* input = (const T*)src;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			float r = readFloatComponent(input[0]);
+			float g = numChannels > 1 ? readFloatComponent(input[1]) : r;
+			float b = numChannels > 2 ? readFloatComponent(input[2]) : g;
+			float a = numChannels > 3 ? readFloatComponent(input[3]) : 1.0f;
+
+			dst[0] = r;
+			dst[1] = g;
+			dst[2] = b;
+			dst[3] = a;
+
+			input += numChannels;
+			dst += 4;
+		}
+	}
+
+	/** Converts RGBA floats into pixels in a floating point format. */
+	template<class T, UINT32 numChannels>
+	static void packFloatPixels(const float* src, UINT32 count, UINT8* dst)
+	{
+		T* output = (T*)dst;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			for (UINT32 j = 0; j < numChannels; j++)
+				writeFloatComponent(src[j], output[j]);
+
+			src += 4;
+			output += numChannels;
+		}
+	}
+
+	typedef void(*UnpackFloatPixelsFunc)(const UINT8*, UINT32, float*);
+	typedef void(*PackFloatPixelsFunc)(const float*, UINT32, UINT8*);
+
+	/** Finds the specialized conversion methods for a floating point format. Returns false if there are none. */
+	static bool getFloatFormatFuncs(PixelFormat format, UnpackFloatPixelsFunc& unpack, PackFloatPixelsFunc& pack)
+	{
+		switch (format)
+		{
+		case PF_FLOAT16_R: 
+			unpack = &unpackFloatPixels<UINT16, 1>; pack = &packFloatPixels<UINT16, 1>; 
+			return true;
+		case PF_FLOAT16_RG: 
+			unpack = &unpackFloatPixels<UINT16, 2>; pack = &packFloatPixels<UINT16, 2>; 
+			return true;
+		case PF_FLOAT16_RGB: 
+			unpack = &unpackFloatPixels<UINT16, 3>; pack = &packFloatPixels<UINT16, 3>; 
+			return true;
+		case PF_FLOAT16_RGBA: 
+			unpack = &unpackFloatPixels<UINT16, 4>; pack = &packFloatPixels<UINT16, 4>; 
+			return true;
+		case PF_FLOAT32_R: 
+			unpack = &unpackFloatPixels<float, 1>; pack = &packFloatPixels<float, 1>; 
+			return true;
+		case PF_FLOAT32_RG: 
+			unpack = &unpackFloatPixels<float, 2>; pack = &packFloatPixels<float, 2>; 
 			return true;
+		case PF_FLOAT32_RGB: 
+			unpack = &unpackFloatPixels<float, 3>; pack = &packFloatPixels<float, 3>; 
+			return true;
+		case PF_FLOAT32_RGBA: 
+			unpack = &unpackFloatPixels<float, 4>; pack = &packFloatPixels<float, 4>; 
+			return true;
+		default:
+			return false;
 		}
+	}
 
-		UINT8* buffer;
-		UINT8* bufferWritePos;
-		UINT8* bufferEnd;
+	/**
+	 * Converts between formats with 8-bit components and floating point formats without going through the per-pixel
+	 * unpackColor()/packColor() path. Rows are converted in chunks, through an RGBA8 intermediate if both formats have
+	 * 8-bit components, or through an RGBA float intermediate otherwise.
+	 *
+	 * Results are identical to unpacking and packing each pixel with unpackColor()/packColor(), including clamping of
+	 * negative and larger than one float values when converting to 8-bit components, with two exceptions:
+	 *  - Alpha of R8G8B8X8 and B8G8R8X8 reads as zero. unpackColor() returns NaN or infinity for it.
+	 *  - Converting NaN float components to 8-bit components has no defined result, on either path.
+	 *
+	 * @return	True if the conversion was performed, false if the formats have no specialized path.
+	 */
+	static bool fastPixelConversion(const PixelData& src, PixelData& dst)
+	{
+		ByteFormatLayout srcLayout, dstLayout;
+		UnpackFloatPixelsFunc srcUnpack = nullptr, dstUnpack = nullptr;
+		PackFloatPixelsFunc srcPack = nullptr, dstPack = nullptr;
+
+		bool srcIsBytes = getByteFormatLayout(src.getFormat(), srcLayout);
+		if (!srcIsBytes && !getFloatFormatFuncs(src.getFormat(), srcUnpack, srcPack))
+			return false;
+
+		bool dstIsBytes = getByteFormatLayout(dst.getFormat(), dstLayout);
+		if (!dstIsBytes && !getFloatFormatFuncs(dst.getFormat(), dstUnpack, dstPack))
+			return false;
+
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
+
+		UINT32 rgba8[FAST_CONVERSION_CHUNK];
+		float rgbaFloat[FAST_CONVERSION_CHUNK * 4];
+
+		const UINT32 width = src.getWidth();
+		for (UINT32 z = 0; z < src.getDepth(); z++)
+		{
+			for (UINT32 y = 0; y < src.getHeight(); y++)
+			{
+				const UINT8* srcPtr = src.getData() + ((src.getFront() + z) * src.getSlicePitch() + 
+					(src.getTop() + y) * src.getRowPitch() + src.getLeft()) * srcPixelSize;
+				UINT8* dstPtr = dst.getData() + ((dst.getFront() + z) * dst.getSlicePitch() + 
+					(dst.getTop() + y) * dst.getRowPitch() + dst.getLeft()) * dstPixelSize;
+
+				for (UINT32 x = 0; x < width; x += FAST_CONVERSION_CHUNK)
+				{
+					UINT32 count = std::min(width - x, FAST_CONVERSION_CHUNK);
+
+					if (srcIsBytes && dstIsBytes)
+					{
+						unpackBytes(srcLayout, srcPtr, count, rgba8);
+						packBytes(dstLayout, rgba8, count, dstPtr);
+					}
+					else
+					{
+						if (srcIsBytes)
+						{
+							unpackBytes(srcLayout, srcPtr, count, rgba8);
+							bytesToFloats(rgba8, count, rgbaFloat);
+						}
+						else
+							srcUnpack(srcPtr, count, rgbaFloat);
+
+						if (dstIsBytes)
+						{
+							floatsToBytes(rgbaFloat, count, rgba8);
+							packBytes(dstLayout, rgba8, count, dstPtr);
+						}
+						else
+							dstPack(rgbaFloat, count, dstPtr);
+					}
+
+					srcPtr += count * srcPixelSize;
+					dstPtr += count * dstPixelSize;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/** Number of pixel rows processed by a single job when generating mip-maps. */
+	static const UINT32 MIP_ROW_GRAIN = 16;
+
+	/** Number of pixel rows compressed by a single job. Must be a multiple of the 4x4 block size. */
+	static const UINT32 COMPRESSION_BAND_HEIGHT = 64;
+
+	/** 
+	 * Executes @p worker over the range [@p begin, @p end) on the task scheduler workers, or on the calling thread if the
+	 * task scheduler isn't running (e.g. in tools that use PixelUtil without starting the application).
+	 */
+	static void parallelForRange(UINT32 begin, UINT32 end, UINT32 grain, const std::function<void(UINT32, UINT32)>& worker)
+	{
+		if (TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(begin, end, grain, worker);
+		else if (begin < end)
+			worker(begin, end);
+	}
+
+	/** Returns a sub-volume of the provided pixel data containing only rows in range [@p begin, @p end). */
+	static PixelData getRows(const PixelData& data, UINT32 begin, UINT32 end)
+	{
+		return data.getSubVolume(PixelVolume(data.getLeft(), data.getTop() + begin, data.getFront(), 
+			data.getRight(), data.getTop() + end, data.getFront() + 1));
+	}
+
+	/** Converts a color value from gamma (sRGB) space into linear space. */
+	static float gammaToLinear(float value)
+	{
+		if (value <= 0.04045f)
+			return value / 12.92f;
+
+		return std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	/** Converts a color value from linear space into gamma (sRGB) space. */
+	static float linearToGamma(float value)
+	{
+		if (value <= 0.0031308f)
+			return value * 12.92f;
+
+		return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	/** Returns the normalized sinc function, sin(pi * x) / (pi * x). */
+	static float sinc(float x)
+	{
+		if (std::abs(x) < 0.0001f)
+			return 1.0f;
+
+		x *= Math::PI;
+		return std::sin(x) / x;
+	}
+
+	/** Evaluates the zeroth order modified Bessel function of the first kind, used by the Kaiser window. */
+	static float besselI0(float x)
+	{
+		float sum = 1.0f;
+		float term = 1.0f;
+		float halfX = x * 0.5f;
+
+		for (UINT32 i = 1; i < 32; i++)
+		{
+			term *= halfX / i;
+
+			float termSqrd = term * term;
+			sum += termSqrd;
+
+			if (termSqrd < sum * 1e-7f)
+				break;
+		}
+
+		return sum;
+	}
+
+	/** Returns the distance from the center at which the filter falls off to zero, in destination pixels. */
+	static float getMipFilterRadius(MipMapFilter filter)
+	{
+		switch (filter)
+		{
+		case MipMapFilter::Box:
+			return 0.5f;
+		case MipMapFilter::Triangle:
+			return 1.0f;
+		case MipMapFilter::Kaiser:
+		case MipMapFilter::Lanczos:
+			return 3.0f;
+		}
+
+		return 1.0f;
+	}
+
+	/** Evaluates the filter at the provided distance from its center, in destination pixels. */
+	static float evaluateMipFilter(MipMapFilter filter, float x)
+	{
+		x = std::abs(x);
+
+		float radius = getMipFilterRadius(filter);
+		if (x > radius)
+			return 0.0f;
+
+		switch (filter)
+		{
+		case MipMapFilter::Box:
+			return 1.0f;
+		case MipMapFilter::Triangle:
+			return 1.0f - x;
+		case MipMapFilter::Kaiser:
+		{
+			const float alpha = 4.0f;
+
+			float t = x / radius;
+			return sinc(x) * besselI0(alpha * std::sqrt(1.0f - t * t)) / besselI0(alpha);
+		}
+		case MipMapFilter::Lanczos:
+			return sinc(x) * sinc(x / radius);
+		}
+
+		return 0.0f;
+	}
+
+	/** Maps a pixel coordinate that might be outside of the image into the image, according to the wrap mode. */
+	static UINT32 wrapMipCoordinate(INT32 coord, UINT32 size, MipMapWrapMode wrapMode)
+	{
+		INT32 signedSize = (INT32)size;
+
+		switch (wrapMode)
+		{
+		case MipMapWrapMode::Clamp:
+			return (UINT32)Math::clamp(coord, 0, signedSize - 1);
+		case MipMapWrapMode::Repeat:
+		{
+			INT32 wrapped = coord % signedSize;
+			return (UINT32)(wrapped < 0 ? wrapped + signedSize : wrapped);
+		}
+		case MipMapWrapMode::Mirror:
+		default:
+		{
+			INT32 period = signedSize * 2;
+
+			INT32 wrapped = coord % period;
+			wrapped = wrapped < 0 ? wrapped + period : wrapped;
+
+			return (UINT32)(wrapped >= signedSize ? period - 1 - wrapped : wrapped);
+		}
+		}
+	}
+
+	/** Pre-calculated filter taps used for downsampling a single dimension of an image. */
+	struct MipFilterTaps
+	{
+		Vector<UINT32> offsets; /**< Index of the first tap of each destination pixel, with an extra entry at the end. */
+		Vector<UINT32> indices; /**< Source pixel read by each tap. */
+		Vector<float> weights; /**< Weight of each tap. Weights of a single destination pixel add up to one. */
 	};
 
-	/**	Handles output from NVTT library for a mip-map chain. */
-	struct NVTTMipmapOutputHandler : public nvtt::OutputHandler
+	/** Calculates filter taps for downsampling an image dimension of size @p srcSize to @p dstSize. */
+	static void calcMipFilterTaps(UINT32 srcSize, UINT32 dstSize, const MipMapGenOptions& options, MipFilterTaps& taps)
 	{
-		NVTTMipmapOutputHandler(const Vector<SPtr<PixelData>>& buffers)
-			:buffers(buffers), bufferWritePos(nullptr), bufferEnd(nullptr)
-		{ }
+		taps.offsets.resize(dstSize + 1);
+
+		// Dimensions that aren't being reduced (e.g. height of a 4x1 image) are just copied
+		if (srcSize == dstSize)
+		{
+			for (UINT32 i = 0; i < dstSize; i++)
+			{
+				taps.offsets[i] = i;
+				taps.indices.push_back(i);
+				taps.weights.push_back(1.0f);
+			}
+
+			taps.offsets[dstSize] = dstSize;
+			return;
+		}
+
+		float scale = srcSize / (float)dstSize;
+		float radius = getMipFilterRadius(options.filter) * scale;
+
+		for (UINT32 i = 0; i < dstSize; i++)
+		{
+			UINT32 firstTap = (UINT32)taps.weights.size();
+			taps.offsets[i] = firstTap;
+
+			float center = (i + 0.5f) * scale;
+			INT32 first = (INT32)std::floor(center - radius);
+			INT32 last = (INT32)std::ceil(center + radius);
+
+			float totalWeight = 0.0f;
+			for (INT32 j = first; j <= last; j++)
+			{
+				float weight = evaluateMipFilter(options.filter, (j + 0.5f - center) / scale);
+				if (weight == 0.0f)
+					continue;
+
+				taps.indices.push_back(wrapMipCoordinate(j, srcSize, options.wrapMode));
+				taps.weights.push_back(weight);
+				totalWeight += weight;
+			}
+
+			for (UINT32 j = firstTap; j < (UINT32)taps.weights.size(); j++)
+				taps.weights[j] /= totalWeight;
+		}
+
+		taps.offsets[dstSize] = (UINT32)taps.weights.size();
+	}
+
+	/**
+	 * Downsamples an image using a separable filter. Both images must be in PF_FLOAT32_RGBA format and laid out 
+	 * consecutively in memory. Rows of each filter pass are processed in parallel.
+	 */
+	static void downsampleMip(const PixelData& src, PixelData& dst, const MipMapGenOptions& options)
+	{
+		UINT32 srcWidth = src.getWidth();
+		UINT32 srcHeight = src.getHeight();
+		UINT32 dstWidth = dst.getWidth();
+		UINT32 dstHeight = dst.getHeight();
+
+		MipFilterTaps horzTaps;
+		MipFilterTaps vertTaps;
+		calcMipFilterTaps(srcWidth, dstWidth, options, horzTaps);
+		calcMipFilterTaps(srcHeight, dstHeight, options, vertTaps);
+
+		const float* srcData = (const float*)src.getData();
+		float* dstData = (float*)dst.getData();
+
+		// Horizontal pass, into an intermediate image of destination width and source height
+		Vector<float> temp(dstWidth * srcHeight * 4);
+		parallelForRange(0, srcHeight, MIP_ROW_GRAIN, [&](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 y = begin; y < end; y++)
+			{
+				const float* srcRow = srcData + y * srcWidth * 4;
+				float* tempRow = temp.data() + y * dstWidth * 4;
+
+				for (UINT32 x = 0; x < dstWidth; x++)
+				{
+					float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+					for (UINT32 i = horzTaps.offsets[x]; i < horzTaps.offsets[x + 1]; i++)
+					{
+						const float* pixel = srcRow + horzTaps.indices[i] * 4;
+						float weight = horzTaps.weights[i];
+
+						sum[0] += pixel[0] * weight;
+						sum[1] += pixel[1] * weight;
+						sum[2] += pixel[2] * weight;
+						sum[3] += pixel[3] * weight;
+					}
+
+					memcpy(tempRow + x * 4, sum, sizeof(sum));
+				}
+			}
+		});
+
+		// Vertical pass, whole rows at a time
+		UINT32 numRowValues = dstWidth * 4;
+		parallelForRange(0, dstHeight, MIP_ROW_GRAIN, [&](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 y = begin; y < end; y++)
+			{
+				float* dstRow = dstData + y * numRowValues;
+				memset(dstRow, 0, numRowValues * sizeof(float));
+
+				for (UINT32 i = vertTaps.offsets[y]; i < vertTaps.offsets[y + 1]; i++)
+				{
+					const float* tempRow = temp.data() + vertTaps.indices[i] * numRowValues;
+					float weight = vertTaps.weights[i];
+
+					for (UINT32 j = 0; j < numRowValues; j++)
+						dstRow[j] += tempRow[j] * weight;
+				}
+			}
+		});
+	}
+
+	/** 
+	 * Re-normalizes normal vectors stored in the RGB channels of the provided PF_FLOAT32_RGBA pixels. If @p isEncoded
+	 * is true the vectors are assumed to be stored in [0, 1] range, as with non-floating point formats.
+	 */
+	static void normalizeMipRow(float* pixels, UINT32 count, bool isEncoded)
+	{
+		for (UINT32 i = 0; i < count; i++)
+		{
+			float* pixel = pixels + i * 4;
+
+			Vector3 normal(pixel[0], pixel[1], pixel[2]);
+			if (isEncoded)
+				normal = normal * 2.0f - 1.0f;
 
-		virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel)
-		{ 
-			assert(miplevel >= 0 && miplevel < (int)buffers.size());
-			assert(size == buffers[miplevel]->getConsecutiveSize());
+			normal.normalize();
 
-			activeBuffer = buffers[miplevel];
+			if (isEncoded)
+				normal = normal * 0.5f + 0.5f;
 
-			bufferWritePos = activeBuffer->getData();
-			bufferEnd = bufferWritePos + activeBuffer->getConsecutiveSize();
+			pixel[0] = normal.x;
+			pixel[1] = normal.y;
+			pixel[2] = normal.z;
 		}
+	}
+
+	/**	Handles compression output from NVTT library for a single image. */
+	struct NVTTCompressOutputHandler : public nvtt::OutputHandler
+	{
+		NVTTCompressOutputHandler(UINT8* buffer, UINT32 sizeBytes)
+			:buffer(buffer), bufferWritePos(buffer), bufferEnd(buffer + sizeBytes)
+		{ }
 
-		virtual bool writeData(const void* data, int size)
+		virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel) override
+		{ }
+
+		virtual bool writeData(const void* data, int size) override
 		{
 			assert((bufferWritePos + size) <= bufferEnd);
 			memcpy(bufferWritePos, data, size);
@@ -878,9 +1524,7 @@ namespace BansheeEngine
 			return true;
 		}
 
-		Vector<SPtr<PixelData>> buffers;
-		SPtr<PixelData> activeBuffer;
-
+		UINT8* buffer;
 		UINT8* bufferWritePos;
 		UINT8* bufferEnd;
 	};
@@ -940,22 +1584,6 @@ namespace BansheeEngine
 		return nvtt::AlphaMode_None;
 	}
 
-	nvtt::WrapMode toNVTTWrapMode(MipMapWrapMode wrapMode)
-	{
-		switch (wrapMode)
-		{
-		case MipMapWrapMode::Clamp:
-			return nvtt::WrapMode_Clamp;
-		case MipMapWrapMode::Mirror:
-			return nvtt::WrapMode_Mirror;
-		case MipMapWrapMode::Repeat:
-			return nvtt::WrapMode_Repeat;
-		}
-
-		// Unknown alpha mode
-		return nvtt::WrapMode_Mirror;
-	}
-
     UINT32 PixelUtil::getNumElemBytes(PixelFormat format)
     {
         return getDescriptionFor(format).elemBytes;
@@ -1440,6 +2068,11 @@ namespace BansheeEngine
             return;
         }
 
+		// Most common formats, including the X8 ones, have specialized paths that produce the same results as the generic
+		// path below (see fastPixelConversion() for the exceptions)
+		if (fastPixelConversion(src, dst))
+			return;
+
 		// Converting to PF_X8R8G8B8 is exactly the same as converting to
 		// PF_A8R8G8B8. (same with PF_X8B8G8R8 and PF_A8B8G8R8)
 		if(dst.getFormat() == PF_X8R8G8B8 || dst.getFormat() == PF_X8B8G8R8)
@@ -1661,34 +2294,59 @@ namespace BansheeEngine
 		if (isCompressed(src.getFormat()))
 			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
 
-		PixelData bgraData(src.getWidth(), src.getHeight(), 1, PF_B8G8R8A8);
+		UINT32 width = src.getWidth();
+		UINT32 height = src.getHeight();
+
+		PixelData bgraData(width, height, 1, PF_B8G8R8A8);
 		bgraData.allocateInternalBuffer();
 		bulkPixelConversion(src, bgraData);
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapData(bgraData.getData(), src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(false);
-		io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
-		io.setNormalMap(options.isNormalMap);
+		// Each 4x4 block is compressed independently, so horizontal bands of the image can be compressed in parallel, 
+		// each writing into its own part of the output
+		UINT32 numBands = (height + COMPRESSION_BAND_HEIGHT - 1) / COMPRESSION_BAND_HEIGHT;
+		std::atomic<bool> failed(false);
 
-		if (options.isSRGB)
-			io.setGamma(2.2f, 2.2f);
-		else
-			io.setGamma(1.0f, 1.0f);
+		parallelForRange(0, numBands, 1, [&](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+			{
+				UINT32 bandTop = i * COMPRESSION_BAND_HEIGHT;
+				UINT32 bandHeight = std::min(COMPRESSION_BAND_HEIGHT, height - bandTop);
 
-		nvtt::CompressionOptions co;
-		co.setFormat(toNVTTFormat(options.format));
-		co.setQuality(toNVTTQuality(options.quality));
-		
-		NVTTCompressOutputHandler outputHandler(dst.getData(), dst.getConsecutiveSize());
+				UINT32 dstOffset = getMemorySize(width, bandTop, 1, options.format);
+				UINT32 dstSize = getMemorySize(width, bandHeight, 1, options.format);
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
-		
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
+				nvtt::InputOptions io;
+				io.setTextureLayout(nvtt::TextureType_2D, width, bandHeight);
+				io.setMipmapData(bgraData.getData() + bandTop * width * 4, width, bandHeight);
+				io.setMipmapGeneration(false);
+				io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
+				io.setNormalMap(options.isNormalMap);
+
+				if (options.isSRGB)
+					io.setGamma(2.2f, 2.2f);
+				else
+					io.setGamma(1.0f, 1.0f);
+
+				nvtt::CompressionOptions co;
+				co.setFormat(toNVTTFormat(options.format));
+				co.setQuality(toNVTTQuality(options.quality));
+
+				NVTTCompressOutputHandler outputHandler(dst.getData() + dstOffset, dstSize);
+
+				nvtt::OutputOptions oo;
+				oo.setOutputHeader(false);
+				oo.setOutputHandler(&outputHandler);
+
+				nvtt::Compressor compressor;
+				if (!compressor.process(io, co, oo))
+					failed = true;
+			}
+		});
+
+		bgraData.freeInternalBuffer();
+
+		if (failed)
 			BS_EXCEPT(InternalErrorException, "Compressing failed.");
 	}
 
@@ -1697,78 +2355,98 @@ namespace BansheeEngine
 		if (src.getDepth() != 1)
 			BS_EXCEPT(InvalidParametersException, "3D textures are not supported.");
 
-		// Note: Add support for floating point mips, no reason they shouldn't be supported other than
-		// nvtt doesn't support them natively
-		if (isCompressed(src.getFormat()) || isFloatingPoint(src.getFormat()))
-			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed or in floating point format.");
+		if (isCompressed(src.getFormat()))
+			BS_EXCEPT(InvalidParametersException, "Source data cannot be compressed.");
 
-		if (!Math::isPow2(src.getWidth()) || !Math::isPow2(src.getHeight()))
-			BS_EXCEPT(InvalidParametersException, "Texture width & height must be powers of 2.");
+		PixelFormat format = src.getFormat();
+		bool isSRGB = options.isSRGB && !options.isNormalMap;
+		bool normalize = options.isNormalMap && options.normalizeMipmaps;
+		bool isEncodedNormal = !isFloatingPoint(format);
 
-		PixelData argbData(src.getWidth(), src.getHeight(), 1, PF_A8R8G8B8);
-		argbData.allocateInternalBuffer();
-		bulkPixelConversion(src, argbData);
+		UINT32 curWidth = src.getWidth();
+		UINT32 curHeight = src.getHeight();
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapData(argbData.getData(), src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(true);
-		io.setNormalMap(options.isNormalMap);
-		io.setNormalizeMipmaps(options.normalizeMipmaps);
-		io.setWrapMode(toNVTTWrapMode(options.wrapMode));
+		Vector<SPtr<PixelData>> outputMipBuffers;
 
-		nvtt::CompressionOptions co;
-		co.setFormat(nvtt::Format_RGBA);
-		
-		UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+		SPtr<PixelData> baseBuffer = bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, format);
+		baseBuffer->allocateInternalBuffer();
+		bulkPixelConversion(src, *baseBuffer);
 
-		Vector<SPtr<PixelData>> argbMipBuffers;
+		outputMipBuffers.push_back(baseBuffer);
 
-		// Note: This can be done more effectively without creating so many temp buffers
-		// and working with the original formats directly, but it would complicate the code
-		// too much at the moment.
-		UINT32 curWidth = src.getWidth();
-		UINT32 curHeight = src.getHeight();
+		// Filtering is done on floating point data in linear space, and each level is generated from the previous one
+		SPtr<PixelData> linearSrc = bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_FLOAT32_RGBA);
+		linearSrc->allocateInternalBuffer();
+
+		parallelForRange(0, curHeight, MIP_ROW_GRAIN, [&](UINT32 begin, UINT32 end)
+		{
+			PixelData linearRows = getRows(*linearSrc, begin, end);
+			bulkPixelConversion(getRows(src, begin, end), linearRows);
+
+			if (isSRGB)
+			{
+				float* pixels = (float*)linearRows.getData();
+				for (UINT32 i = 0; i < (end - begin) * curWidth; i++)
+				{
+					pixels[i * 4 + 0] = gammaToLinear(pixels[i * 4 + 0]);
+					pixels[i * 4 + 1] = gammaToLinear(pixels[i * 4 + 1]);
+					pixels[i * 4 + 2] = gammaToLinear(pixels[i * 4 + 2]);
+				}
+			}
+		});
+
+		UINT32 numMips = getMaxMipmaps(curWidth, curHeight, 1, format);
 		for (UINT32 i = 0; i < numMips; i++)
 		{
-			argbMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-			argbMipBuffers.back()->allocateInternalBuffer();
+			curWidth = std::max(curWidth / 2, 1U);
+			curHeight = std::max(curHeight / 2, 1U);
 
-			if (curWidth > 1) 
-				curWidth = curWidth / 2;
+			SPtr<PixelData> linearDst = bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_FLOAT32_RGBA);
+			linearDst->allocateInternalBuffer();
 
-			if (curHeight > 1)
-				curHeight = curHeight / 2;
-		}
+			downsampleMip(*linearSrc, *linearDst, options);
 
-		argbMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, PF_A8R8G8B8));
-		argbMipBuffers.back()->allocateInternalBuffer();
+			linearSrc->freeInternalBuffer();
+			linearSrc = linearDst;
 
-		NVTTMipmapOutputHandler outputHandler(argbMipBuffers);
+			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, format);
+			outputBuffer->allocateInternalBuffer();
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
+			// Normalization carries over to the next level, while gamma correction is only applied to a copy of each row
+			parallelForRange(0, curHeight, MIP_ROW_GRAIN, [&](UINT32 begin, UINT32 end)
+			{
+				Vector<float> rowValues(curWidth * 4);
+				PixelData rowData(curWidth, 1, 1, PF_FLOAT32_RGBA);
+				rowData.setExternalBuffer((UINT8*)rowValues.data());
 
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
-			BS_EXCEPT(InternalErrorException, "Mipmap generation failed.");
+				for (UINT32 y = begin; y < end; y++)
+				{
+					float* linearRow = (float*)linearDst->getData() + y * curWidth * 4;
+					if (normalize)
+						normalizeMipRow(linearRow, curWidth, isEncodedNormal);
 
-		argbData.freeInternalBuffer();
+					memcpy(rowValues.data(), linearRow, curWidth * 4 * sizeof(float));
 
-		Vector<SPtr<PixelData>> outputMipBuffers;
-		for (UINT32 i = 0; i < (UINT32)argbMipBuffers.size(); i++)
-		{
-			SPtr<PixelData> argbBuffer = argbMipBuffers[i];
-			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(argbBuffer->getWidth(), argbBuffer->getHeight(), 1, src.getFormat());
-			outputBuffer->allocateInternalBuffer();
+					if (isSRGB)
+					{
+						for (UINT32 x = 0; x < curWidth; x++)
+						{
+							rowValues[x * 4 + 0] = linearToGamma(rowValues[x * 4 + 0]);
+							rowValues[x * 4 + 1] = linearToGamma(rowValues[x * 4 + 1]);
+							rowValues[x * 4 + 2] = linearToGamma(rowValues[x * 4 + 2]);
+						}
+					}
 
-			bulkPixelConversion(*argbBuffer, *outputBuffer);
-			argbBuffer->freeInternalBuffer();
+					PixelData outputRow = getRows(*outputBuffer, y, y + 1);
+					bulkPixelConversion(rowData, outputRow);
+				}
+			});
 
 			outputMipBuffers.push_back(outputBuffer);
 		}
 
+		linearSrc->freeInternalBuffer();
+
 		return outputMipBuffers;
 	}
 }
@@ -3,6 +3,9 @@
 #include "BsProfilerCPU.h"
 #include "BsDebug.h"
 #include "BsPlatform.h"
+#include "BsTaskScheduler.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 #include <chrono>
 
 #if BS_COMPILER == BS_COMPILER_GNUC || BS_COMPILER == BS_COMPILER_CLANG
@@ -97,6 +100,48 @@ namespace BansheeEngine
 #endif		
 	}
 
+	/**
+	 * Queries the CPU timestamp counter. Unlike TimerPrecise::getNumCycles() this doesn't serialize the instruction 
+	 * stream, as trace events are recorded at a much higher rate and only need to be ordered relative to each other.
+	 */
+	static inline UINT64 getTraceTimestamp()
+	{
+#if BS_COMPILER == BS_COMPILER_GNUC
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+		UINT32 __a, __d;
+		__asm__ __volatile__ ("rdtsc" : "=a" (__a), "=d" (__d));
+		return (UINT64(__a) | UINT64(__d) << 32);
+#else
+		UINT64 x;
+		__asm__ volatile (".byte 0x0f, 0x31" : "=A" (x));
+		return x;
+#endif
+#elif BS_COMPILER == BS_COMPILER_CLANG || BS_COMPILER == BS_COMPILER_MSVC
+		return __rdtsc();
+#else
+		static_assert("Unsupported compiler");
+#endif
+	}
+
+	/** Name provided to the last beginThread() call on this thread, used for naming the thread in the trace. */
+	static BS_THREADLOCAL const char* TraceThreadName = nullptr;
+
+	/** Appends @p str to @p output, escaping any characters not allowed in a JSON string. */
+	static void appendJSONString(StringStream& output, const String& str)
+	{
+		output << '"';
+		for (auto& entry : str)
+		{
+			if (entry == '"' || entry == '\\')
+				output << '\\' << entry;
+			else if ((UINT8)entry < 0x20)
+				output << ' ';
+			else
+				output << entry;
+		}
+		output << '"';
+	}
+
 	ProfilerCPU::ProfileData::ProfileData(FrameAlloc* alloc)
 		:samples(alloc)
 	{ }
@@ -271,9 +316,28 @@ namespace BansheeEngine
 		return nullptr;
 	}
 
+	BS_THREADLOCAL ProfilerCPU::TraceBuffer* ProfilerCPU::TraceBuffer::activeBuffer = nullptr;
+
+	ProfilerCPU::TraceBuffer::TraceBuffer(UINT32 threadId, const String& threadName)
+		:numEvents(0), threadId(threadId), threadName(threadName)
+	{ }
+
+	void ProfilerCPU::TraceBuffer::record(TraceEventType type, UINT32 nameId)
+	{
+		// Only this thread writes the counter, the release store publishes the event to saveTrace()
+		UINT64 eventIdx = numEvents.load(std::memory_order_relaxed);
+
+		TraceEvent& event = events[eventIdx & (TRACE_BUFFER_SIZE - 1)];
+		event.timestamp = getTraceTimestamp();
+		event.nameId = nameId;
+		event.type = type;
+
+		numEvents.store(eventIdx + 1, std::memory_order_release);
+	}
+
 	ProfilerCPU::ProfilerCPU()
 		: mBasicTimerOverhead(0.0), mPreciseTimerOverhead(0), mBasicSamplingOverheadMs(0.0), mPreciseSamplingOverheadMs(0.0)
-		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0)
+		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0), mTracingEnabled(false), mTraceStartTimestamp(0)
 	{
 		// TODO - We only estimate overhead on program start. It might be better to estimate it each time beginThread is called,
 		// and keep separate values per thread.
@@ -288,6 +352,11 @@ namespace BansheeEngine
 
 		for(auto& threadInfo : mActiveThreads)
 			bs_delete<ThreadInfo, ProfilerAlloc>(threadInfo);
+
+		Lock traceLock(mTraceSync);
+
+		for (auto& traceBuffer : mTraceBuffers)
+			bs_delete<TraceBuffer, ProfilerAlloc>(traceBuffer);
 	}
 
 	void ProfilerCPU::beginThread(const char* name)
@@ -305,6 +374,7 @@ namespace BansheeEngine
 			}
 		}
 
+		TraceThreadName = name;
 		thread->begin(name);
 	}
 
@@ -342,6 +412,9 @@ namespace BansheeEngine
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		if (mTracingEnabled.load(std::memory_order_relaxed))
+			traceBegin(name);
+
 		block->basic.beginSample();
 	}
 
@@ -373,6 +446,9 @@ namespace BansheeEngine
 
 		block->basic.endSample();
 
+		if (mTracingEnabled.load(std::memory_order_relaxed))
+			traceEnd();
+
 		thread->activeBlocks->pop();
 
 		if (!thread->activeBlocks->empty())
@@ -409,6 +485,9 @@ namespace BansheeEngine
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		if (mTracingEnabled.load(std::memory_order_relaxed))
+			traceBegin(name);
+
 		block->precise.beginSample();
 	}
 
@@ -440,6 +519,9 @@ namespace BansheeEngine
 
 		block->precise.endSample();
 
+		if (mTracingEnabled.load(std::memory_order_relaxed))
+			traceEnd();
+
 		thread->activeBlocks->pop();
 
 		if (!thread->activeBlocks->empty())
@@ -756,6 +838,202 @@ namespace BansheeEngine
 		return report;
 	}
 
+	void ProfilerCPU::setTracingEnabled(bool enabled)
+	{
+		if (enabled == mTracingEnabled.load())
+			return;
+
+		if (enabled)
+		{
+			Lock lock(mTraceSync);
+
+			// Rather than clearing the buffers (which would race with their owners), events older than this are ignored
+			mTraceStartTime = steady_clock::now();
+			mTraceStartTimestamp = getTraceTimestamp();
+		}
+
+		mTracingEnabled.store(enabled);
+	}
+
+	void ProfilerCPU::saveTrace(const Path& path)
+	{
+		StringStream output;
+		output.precision(3);
+		output << std::fixed;
+
+		{
+			Lock lock(mTraceSync);
+
+			// Calibrate timestamp counter frequency against the system clock, over the entire duration of the trace
+			UINT64 elapsedTicks = getTraceTimestamp() - mTraceStartTimestamp;
+			double elapsedUs = (double)duration_cast<nanoseconds>(steady_clock::now() - mTraceStartTime).count() * 0.001;
+			double usPerTick = elapsedTicks > 0 ? elapsedUs / elapsedTicks : 0.0;
+
+			output << "{\"traceEvents\":[";
+
+			bool isFirst = true;
+			Vector<TraceEvent> events;
+			for (auto& buffer : mTraceBuffers)
+			{
+				if (!isFirst)
+					output << ",";
+
+				isFirst = false;
+				output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadId 
+					<< ",\"args\":{\"name\":";
+				appendJSONString(output, buffer->threadName);
+				output << "}}";
+
+				// Copy the events first, then discard any the owning thread might have overwritten while we were copying
+				UINT64 lastEvent = buffer->numEvents.load(std::memory_order_acquire);
+				UINT64 firstEvent = lastEvent > TRACE_BUFFER_SIZE ? lastEvent - TRACE_BUFFER_SIZE : 0;
+
+				events.clear();
+				for (UINT64 i = firstEvent; i < lastEvent; i++)
+					events.push_back(buffer->events[i & (TRACE_BUFFER_SIZE - 1)]);
+
+				// The owning thread might also be in the middle of writing the next event, so its slot is treated as 
+				// overwritten as well
+				std::atomic_thread_fence(std::memory_order_acquire);
+				UINT64 newLastEvent = buffer->numEvents.load(std::memory_order_relaxed);
+				UINT64 firstValidEvent = newLastEvent + 1 > TRACE_BUFFER_SIZE ? newLastEvent + 1 - TRACE_BUFFER_SIZE : 0;
+				UINT64 numOverwritten = 0;
+				if (firstValidEvent > firstEvent)
+					numOverwritten = std::min(firstValidEvent - firstEvent, (UINT64)events.size());
+
+				// End events whose begin event was overwritten or recorded before tracing started are skipped
+				UINT32 depth = 0;
+				for (UINT64 i = numOverwritten; i < (UINT64)events.size(); i++)
+				{
+					const TraceEvent& event = events[(size_t)i];
+					if (event.timestamp < mTraceStartTimestamp)
+						continue;
+
+					if (event.type == TraceEventType::End)
+					{
+						if (depth == 0)
+							continue;
+
+						depth--;
+					}
+					else
+						depth++;
+
+					double timeUs = (event.timestamp - mTraceStartTimestamp) * usPerTick;
+					if (event.type == TraceEventType::Begin)
+					{
+						output << ",{\"name\":";
+						appendJSONString(output, mTraceNames[event.nameId]);
+						output << ",\"ph\":\"B\"";
+					}
+					else
+						output << ",{\"ph\":\"E\"";
+
+					output << ",\"ts\":" << timeUs << ",\"pid\":0,\"tid\":" << buffer->threadId << "}";
+				}
+			}
+
+			output << "]}";
+		}
+
+		String contents = output.str();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(contents.data(), contents.size());
+		stream->close();
+	}
+
+	void ProfilerCPU::_onTaskStarted(const Task& task)
+	{
+		ProfilerCPU& profiler = ProfilerCPU::instance();
+		if (!profiler.mTracingEnabled.load(std::memory_order_relaxed))
+			return;
+
+		if (TraceThreadName == nullptr)
+			TraceThreadName = "TaskWorker";
+
+		// Task names aren't persistent so they can't be cached by address like sample names, but they can still be cached
+		// per thread to avoid locking on every task
+		TraceBuffer* buffer = profiler.getTraceBuffer();
+
+		UINT32 nameId;
+		const String& name = task.getName();
+		auto iterFind = buffer->taskNameIds.find(name);
+		if (iterFind != buffer->taskNameIds.end())
+			nameId = iterFind->second;
+		else
+		{
+			nameId = profiler.internTraceName(name.c_str());
+			buffer->taskNameIds[name] = nameId;
+		}
+
+		buffer->record(TraceEventType::Begin, nameId);
+	}
+
+	void ProfilerCPU::_onTaskFinished(const Task& task)
+	{
+		ProfilerCPU& profiler = ProfilerCPU::instance();
+		if (!profiler.mTracingEnabled.load(std::memory_order_relaxed))
+			return;
+
+		profiler.traceEnd();
+	}
+
+	ProfilerCPU::TraceBuffer* ProfilerCPU::getTraceBuffer()
+	{
+		TraceBuffer* buffer = TraceBuffer::activeBuffer;
+		if (buffer != nullptr)
+			return buffer;
+
+		Lock lock(mTraceSync);
+
+		UINT32 threadId = (UINT32)mTraceBuffers.size();
+		String threadName = TraceThreadName != nullptr ? String(TraceThreadName) : "Thread " + toString(threadId);
+
+		buffer = bs_new<TraceBuffer, ProfilerAlloc>(threadId, threadName);
+		mTraceBuffers.push_back(buffer);
+
+		TraceBuffer::activeBuffer = buffer;
+		return buffer;
+	}
+
+	UINT32 ProfilerCPU::internTraceName(const char* name)
+	{
+		Lock lock(mTraceSync);
+
+		auto iterFind = mTraceNameIds.find(name);
+		if (iterFind != mTraceNameIds.end())
+			return iterFind->second;
+
+		UINT32 nameId = (UINT32)mTraceNames.size();
+		mTraceNames.push_back(name);
+		mTraceNameIds[name] = nameId;
+
+		return nameId;
+	}
+
+	void ProfilerCPU::traceBegin(const char* name)
+	{
+		TraceBuffer* buffer = getTraceBuffer();
+
+		UINT32 nameId;
+		auto iterFind = buffer->nameIds.find(name);
+		if (iterFind != buffer->nameIds.end())
+			nameId = iterFind->second;
+		else
+		{
+			nameId = internTraceName(name);
+			buffer->nameIds[name] = nameId;
+		}
+
+		buffer->record(TraceEventType::Begin, nameId);
+	}
+
+	void ProfilerCPU::traceEnd()
+	{
+		getTraceBuffer()->record(TraceEventType::End, 0);
+	}
+
 	void ProfilerCPU::estimateTimerOverhead()
 	{
 		// Get an idea of how long timer calls and RDTSC takes
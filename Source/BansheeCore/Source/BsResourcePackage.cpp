@@ -0,0 +1,173 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsResourcePackage.h"
+#include "BsMappedFile.h"
+#include "BsDataStream.h"
+#include "BsFileSystem.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Header at the start of a package file. */
+	struct PackageHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT32 numEntries;
+		UINT32 reserved;
+	};
+
+	/** Entry in the package index. */
+	struct PackageIndexEntry
+	{
+		char uuid[36];
+		UINT32 reserved;
+		UINT64 offset;
+		UINT64 size;
+	};
+
+	ResourcePackage::ResourcePackage(const PrivatelyConstruct& dummy, const Path& path, const SPtr<MappedFile>& file)
+		:mPath(path), mFile(file)
+	{ }
+
+	bool ResourcePackage::contains(const String& uuid) const
+	{
+		return mEntries.find(uuid) != mEntries.end();
+	}
+
+	SPtr<DataStream> ResourcePackage::openResource(const String& uuid) const
+	{
+		auto iterFind = mEntries.find(uuid);
+		if (iterFind == mEntries.end())
+			return nullptr;
+
+		const Entry& entry = iterFind->second;
+		return bs_shared_ptr_new<MappedFileDataStream>(mFile, entry.offset, entry.size);
+	}
+
+	Vector<String> ResourcePackage::getResourceUUIDs() const
+	{
+		Vector<String> output;
+		for (auto& entry : mEntries)
+			output.push_back(entry.first);
+
+		return output;
+	}
+
+	SPtr<ResourcePackage> ResourcePackage::open(const Path& path)
+	{
+		SPtr<MappedFile> file = MappedFile::open(path);
+		if (file == nullptr)
+			return nullptr;
+
+		const UINT8* data = file->getData();
+		UINT64 fileSize = file->getSize();
+
+		PackageHeader header;
+		if (fileSize < sizeof(header))
+		{
+			LOGERR("Invalid resource package: \"" + path.toString() + "\".");
+			return nullptr;
+		}
+
+		memcpy(&header, data, sizeof(header));
+		if (header.magic != MAGIC || header.version != VERSION ||
+			fileSize < sizeof(header) + header.numEntries * (UINT64)sizeof(PackageIndexEntry))
+		{
+			LOGERR("Invalid resource package: \"" + path.toString() + "\".");
+			return nullptr;
+		}
+
+		SPtr<ResourcePackage> package = bs_shared_ptr_new<ResourcePackage>(PrivatelyConstruct(), path, file);
+
+		const UINT8* indexData = data + sizeof(header);
+		for (UINT32 i = 0; i < header.numEntries; i++)
+		{
+			PackageIndexEntry indexEntry;
+			memcpy(&indexEntry, indexData + i * sizeof(PackageIndexEntry), sizeof(indexEntry));
+
+			// Written so it cannot overflow regardless of the values in the index
+			if (indexEntry.offset > fileSize || indexEntry.size > fileSize - indexEntry.offset)
+			{
+				LOGERR("Invalid resource package: \"" + path.toString() + "\". Entry out of bounds.");
+				return nullptr;
+			}
+
+			UINT32 uuidLength = 0;
+			while (uuidLength < MAX_UUID_LENGTH && indexEntry.uuid[uuidLength] != '\0')
+				uuidLength++;
+
+			String uuid(indexEntry.uuid, uuidLength);
+			package->mEntries[uuid] = { indexEntry.offset, indexEntry.size };
+		}
+
+		return package;
+	}
+
+	bool ResourcePackage::create(const Path& path, const Vector<std::pair<String, Path>>& resources)
+	{
+		UINT32 numEntries = (UINT32)resources.size();
+
+		Vector<PackageIndexEntry> index(numEntries);
+		UINT64 offset = sizeof(PackageHeader) + numEntries * sizeof(PackageIndexEntry);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const String& uuid = resources[i].first;
+			if (uuid.size() > MAX_UUID_LENGTH)
+			{
+				LOGERR("Cannot create resource package. Invalid UUID: " + uuid);
+				return false;
+			}
+
+			if (!FileSystem::isFile(resources[i].second))
+			{
+				LOGERR("Cannot create resource package. File doesn't exist: " + resources[i].second.toString());
+				return false;
+			}
+
+			offset = (offset + DATA_ALIGNMENT - 1) & ~(UINT64)(DATA_ALIGNMENT - 1);
+
+			PackageIndexEntry& entry = index[i];
+			memset(&entry, 0, sizeof(entry));
+			memcpy(entry.uuid, uuid.data(), uuid.size());
+			entry.offset = offset;
+			entry.size = FileSystem::getFileSize(resources[i].second);
+
+			offset += entry.size;
+		}
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+			return false;
+
+		PackageHeader header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.numEntries = numEntries;
+		header.reserved = 0;
+
+		stream->write(&header, sizeof(header));
+		if (numEntries > 0)
+			stream->write(index.data(), numEntries * sizeof(PackageIndexEntry));
+
+		UINT8 padding[DATA_ALIGNMENT];
+		memset(padding, 0, sizeof(padding));
+
+		UINT64 curOffset = sizeof(PackageHeader) + numEntries * sizeof(PackageIndexEntry);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UINT64 paddingSize = index[i].offset - curOffset;
+			if (paddingSize > 0)
+				stream->write(padding, (size_t)paddingSize);
+
+			SPtr<DataStream> resourceStream = FileSystem::openFile(resources[i].second, true);
+			SPtr<MemoryDataStream> resourceData = bs_shared_ptr_new<MemoryDataStream>(resourceStream);
+			stream->write(resourceData->getPtr(), resourceData->size());
+
+			curOffset = index[i].offset + index[i].size;
+		}
+
+		stream->close();
+		return true;
+	}
+}
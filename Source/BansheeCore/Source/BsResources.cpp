@@ -3,6 +3,7 @@
 #include "BsResources.h"
 #include "BsResource.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
@@ -83,16 +84,131 @@ namespace BansheeEngine
 	HResource Resources::loadFromUUID(const String& uuid, bool async, ResourceLoadFlags loadFlags)
 	{
 		Path filePath;
+		getLoadPathFromUUID(uuid, filePath);
 
-		// Default manifest is at 0th index but all other take priority since Default manifest could
-		// contain obsolete data. 
-		for (auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter)
+		return loadInternal(uuid, filePath, !async, loadFlags);
+	}
+
+	Vector<HResource> Resources::loadBatch(const Vector<String>& uuids, bool async, ResourceLoadFlags loadFlags)
+	{
+		struct BatchEntry
+		{
+			String uuid;
+			Path filePath;
+			SPtr<SavedResourceData> savedResourceData;
+		};
+
+		Vector<BatchEntry> entries;
+		UnorderedSet<String> visited;
+
+		for (auto& uuid : uuids)
 		{
-			if ((*iter)->uuidToFilePath(uuid, filePath))
-				break;
+			if (visited.insert(uuid).second)
+				entries.push_back({ uuid, Path::BLANK, nullptr });
 		}
 
-		return loadInternal(uuid, filePath, !async, loadFlags);
+		UINT32 numRequested = (UINT32)entries.size();
+		bool loadDependencies = loadFlags.isSet(ResourceLoadFlag::LoadDependencies);
+
+		// Discover the entire load graph by reading just the dependency lists. All files on one level of the graph are
+		// read in parallel, and dependencies found on that level form the next one.
+		UINT32 levelStart = 0;
+		while (levelStart < (UINT32)entries.size())
+		{
+			UINT32 levelEnd = (UINT32)entries.size();
+
+			// Manifests aren't thread safe, so resolve the paths on this thread. Resources that are already loaded or being
+			// loaded had their dependencies handled by the load that started them, so their files aren't read at all.
+			for (UINT32 i = levelStart; i < levelEnd; i++)
+			{
+				if (!isLoaded(entries[i].uuid, true))
+					getLoadPathFromUUID(entries[i].uuid, entries[i].filePath);
+			}
+
+			TaskScheduler::instance().parallelFor(levelStart, levelEnd, 1,
+				[&](UINT32 begin, UINT32 end)
+			{
+				for (UINT32 i = begin; i < end; i++)
+				{
+					BatchEntry& entry = entries[i];
+					if (entry.filePath.isEmpty() || !FileSystem::isFile(entry.filePath))
+						continue;
+
+					FileDecoder fs(openResourceData(entry.uuid, entry.filePath));
+					entry.savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+				}
+			});
+
+			if (loadDependencies)
+			{
+				for (UINT32 i = levelStart; i < levelEnd; i++)
+				{
+					if (entries[i].savedResourceData == nullptr)
+						continue;
+
+					for (auto& dependency : entries[i].savedResourceData->getDependencies())
+					{
+						if (visited.insert(dependency).second)
+							entries.push_back({ dependency, Path::BLANK, nullptr });
+					}
+				}
+			}
+
+			levelStart = levelEnd;
+		}
+
+		// Provide the dependency lists to loadInternal() so it doesn't need to read them again
+		for (auto& entry : entries)
+		{
+			if (entry.savedResourceData != nullptr)
+				mPrefetchedResourceData[entry.uuid] = entry.savedResourceData;
+		}
+
+		ResourceLoadFlags depLoadFlags = ResourceLoadFlag::LoadDependencies;
+		if (loadFlags.isSet(ResourceLoadFlag::KeepSourceData))
+			depLoadFlags |= ResourceLoadFlag::KeepSourceData;
+
+		// Start from the deepest dependencies. This queues their reads first, and by the time a resource is reached all of
+		// its dependencies are already in progress, so no recursive loads are required. Loads are always started 
+		// asynchronously so they can all run in parallel, even if the caller wants to block. Resources that are already
+		// loaded or being loaded have no file path, so loadInternal() returns their existing handle without reading the file.
+		Vector<HResource> output(entries.size());
+		for (INT32 i = (INT32)entries.size() - 1; i >= 0; i--)
+		{
+			ResourceLoadFlags entryFlags = (UINT32)i < numRequested ? loadFlags : depLoadFlags;
+			output[i] = loadInternal(entries[i].uuid, entries[i].filePath, false, entryFlags);
+		}
+
+		for (auto& entry : entries)
+			mPrefetchedResourceData.erase(entry.uuid);
+
+		if (!async)
+		{
+			for (auto& resource : output)
+				resource.blockUntilLoaded();
+		}
+
+		return output;
+	}
+
+	Vector<HResource> Resources::prefetch(const Vector<String>& uuids)
+	{
+		return loadBatch(uuids, true, ResourceLoadFlag::LoadDependencies | ResourceLoadFlag::KeepInternalRef);
+	}
+
+	float Resources::getLoadProgress(const Vector<HResource>& resources)
+	{
+		if (resources.empty())
+			return 1.0f;
+
+		UINT32 numLoaded = 0;
+		for (auto& resource : resources)
+		{
+			if (resource.isLoaded(false))
+				numLoaded++;
+		}
+
+		return numLoaded / (float)resources.size();
 	}
 
 	HResource Resources::loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags)
@@ -190,8 +306,14 @@ namespace BansheeEngine
 		SPtr<SavedResourceData> savedResourceData;
 		if (!filePath.isEmpty())
 		{
-			FileDecoder fs(filePath);
-			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			auto iterFind = mPrefetchedResourceData.find(UUID);
+			if (iterFind != mPrefetchedResourceData.end())
+				savedResourceData = iterFind->second;
+			else
+			{
+				FileDecoder fs(openResourceData(UUID, filePath));
+				savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			}
 		}
 
 		// If already loading keep the old load operation active, otherwise create a new one
@@ -353,9 +475,9 @@ namespace BansheeEngine
 		return outputResource;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData)
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const String& UUID, const Path& filePath, bool loadWithSaveData)
 	{
-		FileDecoder fs(filePath);
+		FileDecoder fs(openResourceData(UUID, filePath));
 		fs.skip(); // Skipped over saved resource data
 
 		UnorderedMap<String, UINT64> loadParams;
@@ -509,6 +631,12 @@ namespace BansheeEngine
 				return; // Nothing to save
 		}
 
+		if (isResourcePackagePath(filePath))
+		{
+			BS_EXCEPT(InvalidParametersException, "Cannot save a resource over a resource package. Resources contained in "
+				"packages are read-only. File path: " + filePath.toString());
+		}
+
 		bool fileExists = FileSystem::isFile(filePath);
 		if(fileExists)
 		{
@@ -546,6 +674,11 @@ namespace BansheeEngine
 		Path path;
 		if (getFilePathFromUUID(resource.getUUID(), path))
 			save(resource, path, true);
+		else if (findResourcePackage(resource.getUUID()) != nullptr)
+		{
+			LOGWRN("Cannot save a resource contained in a resource package, as packages are read-only. Save the resource "
+				"to a separate file instead. UUID: " + resource.getUUID());
+		}
 	}
 
 	void Resources::update(HResource& handle, const SPtr<Resource>& resource)
@@ -600,6 +733,59 @@ namespace BansheeEngine
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::registerResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter == mResourcePackages.end())
+			mResourcePackages.push_back(package);
+	}
+
+	void Resources::unregisterResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter != mResourcePackages.end())
+			mResourcePackages.erase(findIter);
+	}
+
+	SPtr<ResourcePackage> Resources::findResourcePackage(const String& UUID) const
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		for (auto iter = mResourcePackages.rbegin(); iter != mResourcePackages.rend(); ++iter)
+		{
+			if ((*iter)->contains(UUID))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
+	bool Resources::isResourcePackagePath(const Path& filePath) const
+	{
+		Lock lock(mResourcePackagesMutex);
+
+		for (auto& package : mResourcePackages)
+		{
+			if (package->getPath() == filePath)
+				return true;
+		}
+
+		return false;
+	}
+
+	SPtr<DataStream> Resources::openResourceData(const String& UUID, const Path& filePath) const
+	{
+		SPtr<ResourcePackage> package = findResourcePackage(UUID);
+		if (package != nullptr && package->getPath() == filePath)
+			return package->openResource(UUID);
+
+		return FileSystem::openFile(filePath, true);
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -678,6 +864,21 @@ namespace BansheeEngine
 		return false;
 	}
 
+	bool Resources::getLoadPathFromUUID(const String& uuid, Path& filePath) const
+	{
+		if (getFilePathFromUUID(uuid, filePath))
+			return true;
+
+		SPtr<ResourcePackage> package = findResourcePackage(uuid);
+		if (package != nullptr)
+		{
+			filePath = package->getPath();
+			return true;
+		}
+
+		return false;
+	}
+
 	bool Resources::getUUIDFromFilePath(const Path& path, String& uuid) const
 	{
 		Path manifestPath = path;
@@ -757,7 +958,7 @@ namespace BansheeEngine
 
 	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(resource.getUUID(), filePath, loadWithSaveData);
 
 		{
 			Lock lock(mInProgressResourcesMutex);
@@ -3,6 +3,7 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsCoreSceneManager.h"
+#include "BsSceneTransformStore.h"
 #include "BsException.h"
 #include "BsDebug.h"
 #include "BsSceneObjectRTTI.h"
@@ -18,7 +19,8 @@ namespace BansheeEngine
 		: GameObject(), mPrefabHash(0), mFlags(flags), mPosition(Vector3::ZERO), mRotation(Quaternion::IDENTITY)
 		, mScale(Vector3::ONE), mWorldPosition(Vector3::ZERO), mWorldRotation(Quaternion::IDENTITY)
 		, mWorldScale(Vector3::ONE), mCachedLocalTfrm(Matrix4::IDENTITY), mCachedWorldTfrm(Matrix4::IDENTITY)
-		, mDirtyFlags(0xFFFFFFFF), mDirtyHash(0), mActiveSelf(true), mActiveHierarchy(true)
+		, mDirtyFlags(0xFFFFFFFF), mDirtyHash(0), mParentTfrmHash(0), mTransformId(SceneTransformStore::INVALID_ID), mActiveSelf(true)
+		, mActiveHierarchy(true)
 	{
 		setName(name);
 	}
@@ -49,6 +51,7 @@ namespace BansheeEngine
 		
 		HSceneObject sceneObject = GameObjectManager::instance().registerObject(sceneObjectPtr);
 		sceneObject->mThisHandle = sceneObject;
+		sceneObject->registerTransform();
 
 		return sceneObject;
 	}
@@ -57,6 +60,7 @@ namespace BansheeEngine
 	{
 		HSceneObject sceneObject = GameObjectManager::instance().registerObject(soPtr, originalId);
 		sceneObject->mThisHandle = sceneObject;
+		sceneObject->registerTransform();
 
 		return sceneObject;
 	}
@@ -103,6 +107,12 @@ namespace BansheeEngine
 
 			mComponents.clear();
 
+			if (mTransformId != SceneTransformStore::INVALID_ID)
+			{
+				gCoreSceneManager()._getTransformStore().unregisterObject(mTransformId);
+				mTransformId = SceneTransformStore::INVALID_ID;
+			}
+
 			GameObjectManager::instance().unregisterObject(handle);
 		}
 		else
@@ -220,7 +230,7 @@ namespace BansheeEngine
 				component->onInitialized();
 
 				if (obj->getActive())
-					component->onEnabled();
+					obj->activateComponent(component.get());
 			}
 
 			for (auto& child : obj->mChildren)
@@ -238,19 +248,19 @@ namespace BansheeEngine
 	void SceneObject::setPosition(const Vector3& position)
 	{
 		mPosition = position;
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	void SceneObject::setRotation(const Quaternion& rotation)
 	{
 		mRotation = rotation;
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	void SceneObject::setScale(const Vector3& scale)
 	{
 		mScale = scale;
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	void SceneObject::setWorldPosition(const Vector3& position)
@@ -269,7 +279,7 @@ namespace BansheeEngine
 		else
 			mPosition = position;
 
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	void SceneObject::setWorldRotation(const Quaternion& rotation)
@@ -283,7 +293,7 @@ namespace BansheeEngine
 		else
 			mRotation = rotation;
 
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	void SceneObject::setWorldScale(const Vector3& scale)
@@ -306,7 +316,7 @@ namespace BansheeEngine
 		else
 			mScale = scale;
 
-		notifyTransformChanged(TCF_Transform);
+		notifyLocalTransformChanged();
 	}
 
 	const Vector3& SceneObject::getWorldPosition() const
@@ -433,19 +443,71 @@ namespace BansheeEngine
 			updateWorldTfrm();
 	}
 
+	void SceneObject::registerTransform()
+	{
+		// Scene manager registers its own root object, as it is created before the manager is started
+		if (CoreSceneManager::isStarted())
+			mTransformId = gCoreSceneManager()._getTransformStore().registerObject(this);
+	}
+
+	void SceneObject::notifyLocalTransformChanged()
+	{
+		if (mTransformId == SceneTransformStore::INVALID_ID)
+		{
+			notifyTransformChanged(TCF_Transform);
+			return;
+		}
+
+		// Children are handled by the store in a single pass over all dirty objects, instead of recursing here
+		gCoreSceneManager()._getTransformStore().setLocalTransform(mTransformId, mPosition, mRotation, mScale);
+
+		mDirtyFlags |= DirtyFlags::LocalTfrmDirty | DirtyFlags::WorldTfrmDirty;
+		mDirtyHash++;
+
+		notifyComponents(TCF_Transform);
+	}
+
 	void SceneObject::notifyTransformChanged(TransformChangedFlags flags) const
 	{
 		mDirtyFlags |= DirtyFlags::LocalTfrmDirty | DirtyFlags::WorldTfrmDirty;
 		mDirtyHash++;
 
+		notifyComponents(flags);
+
+		for (auto& entry : mChildren)
+			entry->notifyTransformChanged(flags);
+	}
+
+	void SceneObject::notifyComponents(TransformChangedFlags flags) const
+	{
 		for(auto& entry : mComponents)
 		{
 			if (entry->supportsNotify(flags))
 				entry->onTransformChanged(flags);
 		}
+	}
 
-		for (auto& entry : mChildren)
-			entry->notifyTransformChanged(flags);
+	bool SceneObject::isCachedWorldTfrmUpToDate() const
+	{
+		if ((mDirtyFlags & DirtyFlags::WorldTfrmDirty) != 0)
+			return false;
+
+		// Once the store is updated all registered objects are up to date. Until then a parent might have changed without
+		// marking its children, in which case its hash will differ from the one we were last updated with.
+		if (mParent == nullptr || mTransformId == SceneTransformStore::INVALID_ID || 
+			!gCoreSceneManager()._getTransformStore().isDirty())
+			return true;
+
+		return mParent->mDirtyHash == mParentTfrmHash && mParent->isCachedWorldTfrmUpToDate();
+	}
+
+	UINT32 SceneObject::getTransformHash() const
+	{
+		// Make sure changes to parent transforms are reflected in the hash
+		if (!isCachedWorldTfrmUpToDate())
+			updateWorldTfrm();
+
+		return mDirtyHash;
 	}
 
 	void SceneObject::updateWorldTfrm() const
@@ -469,6 +531,7 @@ namespace BansheeEngine
 			mWorldPosition += mParent->getWorldPosition();
 
 			mCachedWorldTfrm.setTRS(mWorldPosition, mWorldRotation, mWorldScale);
+			mParentTfrmHash = mParent->mDirtyHash;
 		}
 		else
 		{
@@ -479,7 +542,9 @@ namespace BansheeEngine
 			mCachedWorldTfrm = getLocalTfrm();
 		}
 
+		// Children compare against the hash to find out they need to be updated as well
 		mDirtyFlags &= ~DirtyFlags::WorldTfrmDirty;
+		mDirtyHash++;
 	}
 
 	void SceneObject::updateLocalTfrm() const
@@ -541,6 +606,15 @@ namespace BansheeEngine
 
 			mParent = parent;
 
+			if (mTransformId != SceneTransformStore::INVALID_ID)
+			{
+				UINT32 parentId = SceneTransformStore::INVALID_ID;
+				if (parent != nullptr)
+					parentId = parent->mTransformId;
+
+				gCoreSceneManager()._getTransformStore().setParent(mTransformId, parentId);
+			}
+
 			if (keepWorldTransform)
 			{
 				setWorldPosition(worldPos);
@@ -657,12 +731,12 @@ namespace BansheeEngine
 				if (activeHierarchy)
 				{
 					for (auto& component : mComponents)
-						component->onEnabled();
+						activateComponent(component.get());
 				}
 				else
 				{
 					for (auto& component : mComponents)
-						component->onDisabled();
+						deactivateComponent(component.get());
 				}
 			}
 		}
@@ -673,6 +747,18 @@ namespace BansheeEngine
 		}
 	}
 
+	void SceneObject::activateComponent(Component* component)
+	{
+		gCoreSceneManager()._notifyComponentActivated(component);
+		component->onEnabled();
+	}
+
+	void SceneObject::deactivateComponent(Component* component)
+	{
+		gCoreSceneManager()._notifyComponentDeactivated(component);
+		component->onDisabled();
+	}
+
 	bool SceneObject::getActive(bool self)
 	{
 		if (self)
@@ -0,0 +1,327 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSceneTransformStore.h"
+#include "BsSceneObject.h"
+
+namespace BansheeEngine
+{
+	/** Moves elements of @p data to indices specified by @p remap, dropping elements mapped to an invalid index. */
+	template<class T>
+	void remapArray(Vector<T>& data, const Vector<UINT32>& remap, UINT32 count)
+	{
+		Vector<T> output(count);
+
+		UINT32 numEntries = (UINT32)data.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (remap[i] != SceneTransformStore::INVALID_ID)
+				output[remap[i]] = data[i];
+		}
+
+		data.swap(output);
+	}
+
+	SceneTransformStore::SceneTransformStore()
+		:mNumUnregistered(0), mOrderDirty(false), mAnyDirty(false)
+	{ }
+
+	SceneTransformStore::~SceneTransformStore()
+	{
+		clear();
+	}
+
+	UINT32 SceneTransformStore::registerObject(SceneObject* object)
+	{
+		UINT32 id;
+		if (!mFreeIds.empty())
+		{
+			id = mFreeIds.back();
+			mFreeIds.pop_back();
+		}
+		else
+		{
+			id = (UINT32)mIdToIndex.size();
+			mIdToIndex.push_back(INVALID_ID);
+		}
+
+		// New objects have no parent, so appending them keeps the depth ordering intact
+		UINT32 idx = (UINT32)mObjects.size();
+		mIdToIndex[id] = idx;
+
+		mObjects.push_back(object);
+		mIds.push_back(id);
+		mParents.push_back(INVALID_ID);
+		mLocalPositions.push_back(object->mPosition);
+		mLocalRotations.push_back(object->mRotation);
+		mLocalScales.push_back(object->mScale);
+		mWorldPositions.push_back(object->mPosition);
+		mWorldRotations.push_back(object->mRotation);
+		mWorldScales.push_back(object->mScale);
+		mWorldTfrms.push_back(Matrix4::IDENTITY);
+		mDirty.push_back(DIRTY_SELF);
+
+		mAnyDirty = true;
+		return id;
+	}
+
+	void SceneTransformStore::unregisterObject(UINT32 id)
+	{
+		UINT32 idx = mIdToIndex[id];
+
+		// Entry is removed at the start of next update(), when the arrays are compacted
+		mObjects[idx] = nullptr;
+		mDirty[idx] = 0;
+		mIdToIndex[id] = INVALID_ID;
+		mFreeIds.push_back(id);
+
+		mNumUnregistered++;
+	}
+
+	void SceneTransformStore::setLocalTransform(UINT32 id, const Vector3& position, const Quaternion& rotation,
+		const Vector3& scale)
+	{
+		UINT32 idx = mIdToIndex[id];
+
+		mLocalPositions[idx] = position;
+		mLocalRotations[idx] = rotation;
+		mLocalScales[idx] = scale;
+		mDirty[idx] = DIRTY_SELF;
+
+		mAnyDirty = true;
+	}
+
+	void SceneTransformStore::setParent(UINT32 id, UINT32 parentId)
+	{
+		UINT32 idx = mIdToIndex[id];
+		UINT32 parentIdx = parentId != INVALID_ID ? mIdToIndex[parentId] : INVALID_ID;
+
+		mParents[idx] = parentIdx;
+		mDirty[idx] = DIRTY_SELF;
+
+		// Linear update requires parents to be processed before their children
+		if (parentIdx != INVALID_ID && parentIdx > idx)
+			mOrderDirty = true;
+
+		mAnyDirty = true;
+	}
+
+	void SceneTransformStore::update()
+	{
+		if (mOrderDirty)
+			sortByDepth();
+		else if (mNumUnregistered > 0)
+			compact();
+
+		if (!mAnyDirty)
+			return;
+
+		// Parents always precede their children, so by the time we reach an entry its parent's world transform and dirty
+		// state are final. Dirty state propagates down the hierarchy in the same pass.
+		UINT32 numEntries = (UINT32)mObjects.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UINT32 parentIdx = mParents[i];
+			if (parentIdx != INVALID_ID && mDirty[parentIdx])
+				mDirty[i] |= DIRTY_PARENT;
+
+			if (!mDirty[i])
+				continue;
+
+			if (parentIdx != INVALID_ID)
+			{
+				const Quaternion& parentRotation = mWorldRotations[parentIdx];
+				const Vector3& parentScale = mWorldScales[parentIdx];
+
+				mWorldRotations[i] = parentRotation * mLocalRotations[i];
+				mWorldScales[i] = parentScale * mLocalScales[i];
+				mWorldPositions[i] = parentRotation.rotate(parentScale * mLocalPositions[i]) + mWorldPositions[parentIdx];
+			}
+			else
+			{
+				mWorldRotations[i] = mLocalRotations[i];
+				mWorldScales[i] = mLocalScales[i];
+				mWorldPositions[i] = mLocalPositions[i];
+			}
+
+			mWorldTfrms[i].setTRS(mWorldPositions[i], mWorldRotations[i], mWorldScales[i]);
+		}
+
+		// Write the results back into the scene objects in a separate pass, so the loop above only touches the arrays
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (!mDirty[i])
+				continue;
+
+			SceneObject* object = mObjects[i];
+			object->mWorldPosition = mWorldPositions[i];
+			object->mWorldRotation = mWorldRotations[i];
+			object->mWorldScale = mWorldScales[i];
+			object->mCachedWorldTfrm = mWorldTfrms[i];
+			object->mDirtyFlags &= ~SceneObject::DirtyFlags::WorldTfrmDirty;
+			object->mDirtyHash++;
+
+			// Parent was written earlier in this loop, so its hash is final
+			if (mParents[i] != INVALID_ID)
+				object->mParentTfrmHash = mObjects[mParents[i]]->mDirtyHash;
+
+			// Objects that changed themselves already notified their components when the change was made
+			if ((mDirty[i] & DIRTY_PARENT) != 0)
+				mNotifyIds.push_back(mIds[i]);
+
+			mDirty[i] = 0;
+		}
+
+		mAnyDirty = false;
+
+		// Notify last, as components may change transforms or destroy objects in response. Such changes are processed on
+		// the next update.
+		for (auto& id : mNotifyIds)
+		{
+			UINT32 idx = mIdToIndex[id];
+			if (idx != INVALID_ID && mObjects[idx] != nullptr)
+				mObjects[idx]->notifyComponents(TCF_Transform);
+		}
+
+		mNotifyIds.clear();
+	}
+
+	void SceneTransformStore::clear()
+	{
+		for (auto& object : mObjects)
+		{
+			if (object != nullptr)
+				object->mTransformId = INVALID_ID;
+		}
+
+		mIdToIndex.clear();
+		mFreeIds.clear();
+		mObjects.clear();
+		mIds.clear();
+		mParents.clear();
+		mLocalPositions.clear();
+		mLocalRotations.clear();
+		mLocalScales.clear();
+		mWorldPositions.clear();
+		mWorldRotations.clear();
+		mWorldScales.clear();
+		mWorldTfrms.clear();
+		mDirty.clear();
+
+		mNumUnregistered = 0;
+		mOrderDirty = false;
+		mAnyDirty = false;
+	}
+
+	void SceneTransformStore::compact()
+	{
+		UINT32 numEntries = (UINT32)mObjects.size();
+		mRemap.resize(numEntries);
+
+		UINT32 count = 0;
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (mObjects[i] != nullptr)
+				mRemap[i] = count++;
+			else
+				mRemap[i] = INVALID_ID;
+		}
+
+		applyRemap(count);
+	}
+
+	void SceneTransformStore::sortByDepth()
+	{
+		UINT32 numEntries = (UINT32)mObjects.size();
+		mDepths.assign(numEntries, INVALID_ID);
+
+		UINT32 maxDepth = 0;
+		bs_frame_mark();
+		{
+			// Calculate depths by walking up the hierarchy until an entry with a known depth (or a root) is found, then
+			// assign depths to all the entries visited along the way. This way each entry is only walked once.
+			FrameVector<UINT32> chain;
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				if (mObjects[i] == nullptr || mDepths[i] != INVALID_ID)
+					continue;
+
+				UINT32 curIdx = i;
+				while (curIdx != INVALID_ID && mObjects[curIdx] != nullptr && mDepths[curIdx] == INVALID_ID)
+				{
+					chain.push_back(curIdx);
+					curIdx = mParents[curIdx];
+				}
+
+				UINT32 depth = 0;
+				if (curIdx != INVALID_ID && mObjects[curIdx] != nullptr)
+					depth = mDepths[curIdx] + 1;
+
+				for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+					mDepths[*iter] = depth++;
+
+				maxDepth = std::max(maxDepth, depth - 1);
+				chain.clear();
+			}
+
+			// Counting sort by depth. Stable, so the relative order of siblings is preserved.
+			FrameVector<UINT32> offsets(maxDepth + 2, 0);
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				if (mObjects[i] != nullptr)
+					offsets[mDepths[i] + 1]++;
+			}
+
+			for (UINT32 i = 1; i < (UINT32)offsets.size(); i++)
+				offsets[i] += offsets[i - 1];
+
+			mRemap.resize(numEntries);
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				if (mObjects[i] != nullptr)
+					mRemap[i] = offsets[mDepths[i]]++;
+				else
+					mRemap[i] = INVALID_ID;
+			}
+
+			applyRemap(numEntries - mNumUnregistered);
+		}
+		bs_frame_clear();
+
+		mOrderDirty = false;
+	}
+
+	void SceneTransformStore::applyRemap(UINT32 count)
+	{
+		// Parent references must be translated to new indices as well. References to removed entries become roots.
+		UINT32 numEntries = (UINT32)mParents.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (mParents[i] == INVALID_ID)
+				continue;
+
+			mParents[i] = mRemap[mParents[i]];
+			if (mParents[i] == INVALID_ID)
+			{
+				mDirty[i] = DIRTY_SELF;
+				mAnyDirty = true;
+			}
+		}
+
+		remapArray(mObjects, mRemap, count);
+		remapArray(mIds, mRemap, count);
+		remapArray(mParents, mRemap, count);
+		remapArray(mLocalPositions, mRemap, count);
+		remapArray(mLocalRotations, mRemap, count);
+		remapArray(mLocalScales, mRemap, count);
+		remapArray(mWorldPositions, mRemap, count);
+		remapArray(mWorldRotations, mRemap, count);
+		remapArray(mWorldScales, mRemap, count);
+		remapArray(mWorldTfrms, mRemap, count);
+		remapArray(mDirty, mRemap, count);
+
+		for (UINT32 i = 0; i < count; i++)
+			mIdToIndex[mIds[i]] = i;
+
+		mNumUnregistered = 0;
+	}
+}
@@ -19,8 +19,11 @@ namespace BansheeEngine
 
 	bool TechniqueBase::isSupported() const
 	{
-		if ((RenderAPICore::instancePtr()->getName() == mRenderAPI ||
-			RenderAPIAny == mRenderAPI) &&
+		// Null render API doesn't compile or execute any GPU programs, so it can run techniques meant for any render API
+		const StringID& activeRenderAPI = RenderAPICore::instancePtr()->getName();
+
+		if ((activeRenderAPI == mRenderAPI ||
+			RenderAPIAny == mRenderAPI || RenderAPINull == activeRenderAPI) &&
 			(RendererManager::instance().getActive()->getName() == mRenderer ||
 			RendererAny == mRenderer))
 		{
@@ -349,11 +349,38 @@ namespace BansheeEngine
 
 	TextDataBase::TextDataBase(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, UINT32 height, bool wordWrap, bool wordBreak)
 		: mChars(nullptr), mNumChars(0), mWords(nullptr), mNumWords(0), mLines(nullptr), mNumLines(0), mPageInfos(nullptr)
-		, mNumPageInfos(0), mFont(font), mFontData(nullptr)
+		, mNumPageInfos(0), mFont(font), mFontData(nullptr), mReusedData(nullptr), mNumReusedChars(0), mNumReusedWords(0)
+		, mNumReusedLines(0)
 	{
 		// In order to reduce number of memory allocations algorithm first calculates data into temporary buffers and then copies the results
 		initAlloc();
 
+		if (!initFont(font, fontSize))
+			return;
+
+		layoutText(text, 0, width, wordWrap, wordBreak);
+	}
+
+	TextDataBase::TextDataBase(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, UINT32 height, 
+		bool wordWrap, bool wordBreak, const TextDataBase& previous, const WString& previousText)
+		: mChars(nullptr), mNumChars(0), mWords(nullptr), mNumWords(0), mLines(nullptr), mNumLines(0), mPageInfos(nullptr)
+		, mNumPageInfos(0), mFont(font), mFontData(nullptr), mReusedData(nullptr), mNumReusedChars(0), mNumReusedWords(0)
+		, mNumReusedLines(0)
+	{
+		initAlloc();
+
+		if (!initFont(font, fontSize))
+			return;
+
+		UINT32 startChar = 0;
+		if (previous.mFontData == mFontData && previous.mNumLines > 0)
+			startChar = reuseLines(text, previous, previousText);
+
+		layoutText(text, startChar, width, wordWrap, wordBreak);
+	}
+
+	bool TextDataBase::initFont(const HFont& font, UINT32 fontSize)
+	{
 		if(font != nullptr)
 		{
 			UINT32 nearestSize = font->getClosestSize(fontSize);
@@ -361,19 +388,114 @@ namespace BansheeEngine
 		}
 
 		if(mFontData == nullptr || mFontData->texturePages.size() == 0)
-			return;
+			return false;
 
 		if(mFontData->size != fontSize)
 		{
 			LOGWRN("Unable to find font with specified size (" + toString(fontSize) + "). Using nearest available size: " + toString(mFontData->size));
 		}
 
-		bool widthIsLimited = width > 0;
 		mFont = font;
+		return true;
+	}
+
+	UINT32 TextDataBase::reuseLines(const WString& text, const TextDataBase& previous, const WString& previousText)
+	{
+		UINT32 numSameChars = 0;
+		UINT32 maxSameChars = (UINT32)std::min(text.size(), previousText.size());
+		while (numSameChars < maxSameChars && text[numSameChars] == previousText[numSameChars])
+			numSameChars++;
+
+		// A newline character always starts a fresh line, so lines ending with one don't depend on anything after them. 
+		// Find the last such line that only contains unchanged characters. The character following the newline must
+		// also be unchanged, since a following '\n' is consumed together with the newline (see layoutText()).
+		UINT32 startChar = 0;
+		UINT32 numReusedLines = 0;
+		UINT32 lineIdx = 0;
+		UINT32 charIdx = 0;
+		while (charIdx < numSameChars)
+		{
+			WString::value_type curChar = previousText[charIdx++];
+			if (curChar != '\n' && curChar != '\r')
+				continue;
+
+			if (charIdx < previousText.size() && previousText[charIdx] == '\n')
+				charIdx++;
+
+			if (charIdx >= numSameChars)
+				break;
+
+			while (!previous.mLines[lineIdx].hasNewlineChar())
+				lineIdx++;
+
+			lineIdx++;
+
+			startChar = charIdx;
+			numReusedLines = lineIdx;
+		}
+
+		if (numReusedLines == 0)
+			return 0;
+
+		// Words are allocated sequentially, so all words up to the last one of the last non-empty line are reused
+		UINT32 numReusedWords = 0;
+		for (UINT32 i = numReusedLines; i > 0; i--)
+		{
+			const TextLine& line = previous.mLines[i - 1];
+			if (!line.isEmpty())
+			{
+				numReusedWords = line.mWordsEnd + 1;
+				break;
+			}
+		}
+
+		MemBuffer->reserve(numReusedWords, numReusedLines);
+
+		// Quads of reused characters are found by removing the ones of the characters that aren't reused
+		UINT32 numPages = previous.mNumPageInfos;
+		UINT32* numReusedQuads = bs_stack_new<UINT32>(numPages);
+		for (UINT32 i = 0; i < numPages; i++)
+			numReusedQuads[i] = previous.mPageInfos[i].numQuads;
+
+		for (UINT32 i = startChar; i < (UINT32)previousText.size(); i++)
+		{
+			WString::value_type curChar = previousText[i];
+			if (curChar == '\n' || curChar == '\r')
+				continue;
+
+			if (curChar == SPACE_CHAR || curChar == TAB_CHAR)
+				numReusedQuads[0]--;
+			else
+				numReusedQuads[previous.mChars[i]->page]--;
+		}
+
+		UINT32 numUsedPages = 0;
+		for (UINT32 i = 0; i < numPages; i++)
+		{
+			if (numReusedQuads[i] > 0)
+				numUsedPages = i + 1;
+		}
+
+		for (UINT32 i = 0; i < numUsedPages; i++)
+			MemBuffer->addReusedQuadsToPage(i, numReusedQuads[i]);
+
+		bs_stack_delete(numReusedQuads, numPages);
+
+		mReusedData = &previous;
+		mNumReusedChars = startChar;
+		mNumReusedWords = numReusedWords;
+		mNumReusedLines = numReusedLines;
+
+		return startChar;
+	}
+
+	void TextDataBase::layoutText(const WString& text, UINT32 startChar, UINT32 width, bool wordWrap, bool wordBreak)
+	{
+		bool widthIsLimited = width > 0;
 
 		UINT32 curLineIdx = MemBuffer->allocLine(this);
 		UINT32 curHeight = mFontData->fontDesc.lineHeight;
-		UINT32 charIdx = 0;
+		UINT32 charIdx = startChar;
 
 		while(true)
 		{
@@ -521,7 +643,11 @@ namespace BansheeEngine
 		UINT8* dataPtr = (UINT8*)buffer;
 		mChars = (const CHAR_DESC**)dataPtr;
 
-		for (UINT32 i = 0; i < mNumChars; i++)
+		// Data of the reused lines is copied from the previous layout, the rest is in the temporary buffers
+		if (mReusedData != nullptr)
+			memcpy(mChars, mReusedData->mChars, mNumReusedChars * sizeof(const CHAR_DESC*));
+
+		for (UINT32 i = mNumReusedChars; i < mNumChars; i++)
 		{
 			UINT32 charId = text[i];
 			const CHAR_DESC& charDesc = mFontData->getCharDesc(charId);
@@ -531,18 +657,34 @@ namespace BansheeEngine
 
 		dataPtr += charArraySize;
 		mWords = (TextWord*)dataPtr;
-		memcpy(mWords, &MemBuffer->WordBuffer[0], wordArraySize);
+
+		if (mReusedData != nullptr)
+			memcpy(mWords, mReusedData->mWords, mNumReusedWords * sizeof(TextWord));
+
+		memcpy(mWords + mNumReusedWords, &MemBuffer->WordBuffer[mNumReusedWords], (mNumWords - mNumReusedWords) * sizeof(TextWord));
 
 		dataPtr += wordArraySize;
 		mLines = (TextLine*)dataPtr;
-		memcpy(mLines, &MemBuffer->LineBuffer[0], lineArraySize);
+
+		if (mReusedData != nullptr)
+		{
+			memcpy(mLines, mReusedData->mLines, mNumReusedLines * sizeof(TextLine));
+
+			for (UINT32 i = 0; i < mNumReusedLines; i++)
+				mLines[i].mTextData = this;
+		}
+
+		memcpy(mLines + mNumReusedLines, &MemBuffer->LineBuffer[mNumReusedLines], (mNumLines - mNumReusedLines) * sizeof(TextLine));
 
 		dataPtr += lineArraySize;
 		mPageInfos = (PageInfo*)dataPtr;
 		memcpy((void*)mPageInfos, (void*)&MemBuffer->PageBuffer[0], pageInfoArraySize);
 
 		if (freeTemporary)
+		{
 			MemBuffer->deallocAll();
+			mReusedData = nullptr;
+		}
 	}
 
 	const HTexture& TextDataBase::getTextureForPage(UINT32 page) const 
@@ -601,7 +743,7 @@ namespace BansheeEngine
 		{
 			UINT32 newBufferSize = WordBufferSize * 2;
 			TextWord* newBuffer = bs_newN<TextWord>(newBufferSize);
-			memcpy(WordBuffer, newBuffer, WordBufferSize);
+			memcpy(newBuffer, WordBuffer, WordBufferSize * sizeof(TextWord));
 
 			bs_deleteN(WordBuffer, WordBufferSize);
 			WordBuffer = newBuffer;
@@ -619,7 +761,7 @@ namespace BansheeEngine
 		{
 			UINT32 newBufferSize = LineBufferSize * 2;
 			TextLine* newBuffer = bs_newN<TextLine>(newBufferSize);
-			memcpy(LineBuffer, newBuffer, LineBufferSize);
+			memcpy(newBuffer, LineBuffer, LineBufferSize * sizeof(TextLine));
 
 			bs_deleteN(LineBuffer, LineBufferSize);
 			LineBuffer = newBuffer;
@@ -631,6 +773,36 @@ namespace BansheeEngine
 		return NextFreeLine++;
 	}
 
+	void TextDataBase::BufferData::reserve(UINT32 numWords, UINT32 numLines)
+	{
+		assert(NextFreeWord == 0 && NextFreeLine == 0);
+
+		if (numWords > WordBufferSize)
+		{
+			UINT32 newBufferSize = WordBufferSize;
+			while (newBufferSize < numWords)
+				newBufferSize *= 2;
+
+			bs_deleteN(WordBuffer, WordBufferSize);
+			WordBuffer = bs_newN<TextWord>(newBufferSize);
+			WordBufferSize = newBufferSize;
+		}
+
+		if (numLines > LineBufferSize)
+		{
+			UINT32 newBufferSize = LineBufferSize;
+			while (newBufferSize < numLines)
+				newBufferSize *= 2;
+
+			bs_deleteN(LineBuffer, LineBufferSize);
+			LineBuffer = bs_newN<TextLine>(newBufferSize);
+			LineBufferSize = newBufferSize;
+		}
+
+		NextFreeWord = numWords;
+		NextFreeLine = numLines;
+	}
+
 	void TextDataBase::BufferData::deallocAll()
 	{
 		NextFreeWord = 0;
@@ -644,7 +816,7 @@ namespace BansheeEngine
 		{
 			UINT32 newBufferSize = PageBufferSize * 2;
 			PageInfo* newBuffer = bs_newN<PageInfo>(newBufferSize);
-			memcpy((void*)PageBuffer, (void*)newBuffer, PageBufferSize);
+			memcpy((void*)newBuffer, (void*)PageBuffer, PageBufferSize * sizeof(PageInfo));
 
 			bs_deleteN(PageBuffer, PageBufferSize);
 			PageBuffer = newBuffer;
@@ -654,6 +826,7 @@ namespace BansheeEngine
 		while(page >= NextFreePageInfo)
 		{
 			PageBuffer[NextFreePageInfo].numQuads = 0;
+			PageBuffer[NextFreePageInfo].numReusedQuads = 0;
 
 			NextFreePageInfo++;
 		}
@@ -661,6 +834,31 @@ namespace BansheeEngine
 		PageBuffer[page].numQuads++;
 	}
 
+	void TextDataBase::BufferData::addReusedQuadsToPage(UINT32 page, UINT32 numQuads)
+	{
+		if(NextFreePageInfo >= PageBufferSize)
+		{
+			UINT32 newBufferSize = PageBufferSize * 2;
+			PageInfo* newBuffer = bs_newN<PageInfo>(newBufferSize);
+			memcpy((void*)newBuffer, (void*)PageBuffer, PageBufferSize * sizeof(PageInfo));
+
+			bs_deleteN(PageBuffer, PageBufferSize);
+			PageBuffer = newBuffer;
+			PageBufferSize = newBufferSize;
+		}
+
+		while(page >= NextFreePageInfo)
+		{
+			PageBuffer[NextFreePageInfo].numQuads = 0;
+			PageBuffer[NextFreePageInfo].numReusedQuads = 0;
+
+			NextFreePageInfo++;
+		}
+
+		PageBuffer[page].numQuads += numQuads;
+		PageBuffer[page].numReusedQuads += numQuads;
+	}
+
 	UINT32 TextDataBase::getWidth() const
 	{
 		UINT32 width = 0;
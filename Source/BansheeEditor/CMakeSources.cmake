@@ -184,6 +184,7 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
 	"Source/BsEditorTestSuite.cpp"
+	"Source/BsEditorBenchmarkSuite.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_SETTINGS
@@ -233,6 +234,7 @@ set(BS_BANSHEEEDITOR_SRC_HANDLES
 
 set(BS_BANSHEEEDITOR_INC_TESTING
 	"Include/BsEditorTestSuite.h"
+	"Include/BsEditorBenchmarkSuite.h"
 )
 
 source_group("Header Files\\Settings" FILES ${BS_BANSHEEEDITOR_INC_SETTINGS})
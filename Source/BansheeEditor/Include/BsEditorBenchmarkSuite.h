@@ -0,0 +1,76 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "BsTestSuite.h"
+
+/** Set to 1 to run the benchmarks along with the editor unit tests when the editor starts. */
+#ifndef BS_EDITOR_BENCHMARKS
+#define BS_EDITOR_BENCHMARKS 0
+#endif
+
+namespace BansheeEngine
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of performance benchmarks for engine systems. Each benchmark logs its results as a debug message, and
+	 * also asserts the work it measured produced correct results.
+	 */
+	class EditorBenchmarkSuite : public TestSuite
+	{
+	public:
+		EditorBenchmarkSuite();
+
+	private:
+		/** Measures the per-job overhead of queuing tasks, and of parallelFor() chunks, in the task scheduler. */
+		void TaskSchedulerOverhead();
+
+		/** 
+		 * Measures binary serialization throughput for an object containing a large plain array, and the per-object cost
+		 * of encoding and decoding many small objects.
+		 */
+		void SerializationThroughput();
+
+		/** 
+		 * Measures PixelUtil::bulkPixelConversion() throughput for common pairs of formats, compared to converting each 
+		 * pixel separately.
+		 */
+		void PixelConversionThroughput();
+
+		/** 
+		 * Measures the cost of a scene manager update for a scene with many active components of a few types, and an 
+		 * inactive hierarchy of the same size.
+		 */
+		void SceneUpdate();
+
+		/** 
+		 * Measures the cost of moving the roots of large scene object hierarchies, and of the scene transform update that
+		 * propagates the changes to their children.
+		 */
+		void SceneTransformUpdate();
+
+		/** 
+		 * Compares frustum culling through VisibilityTree against testing every object's bounds, for scenes of various 
+		 * sizes.
+		 */
+		void VisibilityTreeCull();
+
+		/** 
+		 * Compares ConvexVolume::intersectsBatch() against testing the box and sphere of each entry with the scalar
+		 * intersection methods.
+		 */
+		void ConvexVolumeIntersects();
+
+		/** 
+		 * Measures the cost of marking 100k core objects dirty, from a single thread and from all worker threads at once, 
+		 * and of syncing them to the core thread.
+		 */
+		void CoreObjectDirtyTracking();
+	};
+
+	/** @} */
+}
@@ -223,6 +223,12 @@ namespace BansheeEngine
 		TID_Settings = 40019,
 		TID_ProjectSettings = 40020,
 		TID_WindowFrameWidget = 40021,
-		TID_ProjectResourceMeta = 40022
+		TID_ProjectResourceMeta = 40022,
+		TID_TestObjectC = 40023,
+		TID_TestObjectD = 40024,
+		TID_BenchmarkComponentA = 40025,
+		TID_BenchmarkComponentB = 40026,
+		TID_TestComponentE = 40027,
+		TID_TestComponentF = 40028
 	};
 }
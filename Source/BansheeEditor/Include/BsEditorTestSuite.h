@@ -67,6 +67,50 @@ namespace BansheeEngine
 		TestComponentB() {} // Serialization only
 	};
 
+	/** Object with plain fields and a plain array of fixed-size elements, used for testing serialization. */
+	struct TestObjectC : IReflectable
+	{
+		UINT32 intA = 5;
+		String strA = "5";
+		float floatA = 5.0f;
+		Vector<UINT32> arrIntA;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestObjectCRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** 
+	 * Newer version of TestObjectC, used for testing schema evolution. Field with ID 0 was removed, a field with ID 4
+	 * was added, and the remaining fields are registered in a different order.
+	 */
+	struct TestObjectD : IReflectable
+	{
+		String strA = "6";
+		float floatA = 6.0f;
+		Vector<UINT32> arrIntA;
+		UINT32 intB = 6;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestObjectDRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** 
+	 * Converts pixels by unpacking and packing each one with PixelUtil::unpackColor()/PixelUtil::packColor(), the way
+	 * PixelUtil::bulkPixelConversion() does for formats with no specialized conversion. Alpha of R8G8B8X8 and B8G8R8X8 is 
+	 * treated as zero, same as in bulkPixelConversion(). Both objects must have consecutive buffers.
+	 */
+	void convertPixelsPerPixel(const PixelData& src, PixelData& dst);
+
 	/** @endcond */
 
 	/**	Contains a set of unit tests for the editor. */
@@ -90,6 +134,93 @@ namespace BansheeEngine
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests that the slot of a destroyed game object is reused, with a different instance ID. */
+		void TestGameObjectIdReuse();
+
+		/** Tests that instance IDs and handles of destroyed game objects don't resolve to objects reusing their slot. */
+		void TestGameObjectStaleIds();
+
+		/** Tests that objects keep their instance IDs, and remain resolvable by them, after a prefab revert. */
+		void TestGameObjectPrefabRevertIds();
+
+		/** Tests that objects queued for destruction while queued objects are being destroyed get destroyed as well. */
+		void TestGameObjectDestroyFromOnDestroyed();
+
+		/** 
+		 * Tests that world transforms and components of children reflect changes to their parent transforms, both before
+		 * and after the scene transforms are updated.
+		 */
+		void TestSceneTransformPropagation();
+
+		/** 
+		 * Tests that GUIHitTestGrid finds the same elements as testing the bounds of every element, including after
+		 * elements are moved or removed.
+		 */
+		void TestGUIHitTestGrid();
+
+		/** Tests that objects encoded with the binary serializer decode back to the same values. */
+		void TestSerializationRoundTrip();
+
+		/** 
+		 * Tests decoding of data encoded with an older or newer version of a type, with fields missing, added or 
+		 * registered in a different order.
+		 */
+		void TestSerializationSchemaEvolution();
+
+		/** 
+		 * Tests that objects written with FileEncoder decode back to the same values, and that corrupt objects are
+		 * detected.
+		 */
+		void TestFileSerializerRoundTrip();
+
+		/** Tests that FileDecoder can read files written in the older format, with no file header or checksums. */
+		void TestFileSerializerLegacyFormat();
+
+		/** 
+		 * Tests creating, opening and reading from a resource package, that pixel data is read from the mapped package 
+		 * without a copy, and that packages with an out of bounds index are rejected.
+		 */
+		void TestResourcePackage();
+
+		/** 
+		 * Tests loading resources through Resources::loadBatch() and prefetch(), including duplicate and already loaded
+		 * resources, and tracking their progress through Resources::getLoadProgress().
+		 */
+		void TestResourceLoadBatch();
+
+		/** 
+		 * Tests that PixelUtil::bulkPixelConversion() produces the same results as converting each pixel separately, for
+		 * every pair of formats with a specialized conversion.
+		 */
+		void TestPixelConversion();
+
+		/** Tests mip-map generation for a source whose dimensions aren't powers of two. */
+		void TestGenMipmapsNonPow2();
+
+		/** 
+		 * Tests that ConvexVolume::intersectsBatch() agrees with testing the box and sphere of each entry separately, for
+		 * random bounds, bounds exactly touching the volume and entry counts that don't fill a whole batch.
+		 */
+		void TestConvexVolumeIntersectsBatch();
+
+		/** 
+		 * Tests that text layouts updated from a previous layout after inserting or removing text, and text sprites updated
+		 * the same way, match a layout of the new text created from scratch.
+		 */
+		void TestIncrementalTextLayout();
+
+		/** 
+		 * Tests that syncing GpuParams and GpuParamBlockBuffer objects to the core thread only sends the modified slots
+		 * and the modified byte range, and that the core thread objects match afterwards.
+		 */
+		void TestGpuParamsSyncDelta();
+
+		/** 
+		 * Tests that shaders compiled through BSL are found in the shader cache when compiled again, and that the cache
+		 * entry is ignored after one of the shader's includes changes.
+		 */
+		void TestBSLFXCache();
 	};
 
 	/** @} */
@@ -0,0 +1,718 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsEditorBenchmarkSuite.h"
+#include "BsEditorTestSuite.h"
+#include "BsTaskScheduler.h"
+#include "BsMemorySerializer.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsCoreSceneManager.h"
+#include "BsSceneObject.h"
+#include "BsComponent.h"
+#include "BsRTTIType.h"
+#include "BsGameObjectRTTI.h"
+#include "BsTimer.h"
+#include "BsMath.h"
+#include "BsVisibilityTree.h"
+#include "BsCoreObject.h"
+#include "BsCoreObjectManager.h"
+#include "BsCoreThread.h"
+#include "BsConvexVolume.h"
+#include "BsPlane.h"
+#include "BsBoundsArray.h"
+#include <random>
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Component that counts its updates. */
+	class BenchmarkComponentA : public Component
+	{
+	public:
+		UINT32 numUpdates = 0;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+		void update() override { numUpdates++; }
+
+	protected:
+		friend class SceneObject;
+
+		BenchmarkComponentA(const HSceneObject& parent)
+			:Component(parent)
+		{}
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkComponentARTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		BenchmarkComponentA() {} // Serialization only
+	};
+
+	/** Component that counts its updates, and allows them to run in parallel. */
+	class BenchmarkComponentB : public Component
+	{
+	public:
+		UINT32 numUpdates = 0;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+		void update() override { numUpdates++; }
+		bool isUpdateThreadSafe() const override { return true; }
+
+	protected:
+		friend class SceneObject;
+
+		BenchmarkComponentB(const HSceneObject& parent)
+			:Component(parent)
+		{}
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkComponentBRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		BenchmarkComponentB() {} // Serialization only
+	};
+
+	class BenchmarkComponentARTTI : public RTTIType<BenchmarkComponentA, Component, BenchmarkComponentARTTI>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "BenchmarkComponentA";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_BenchmarkComponentA;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<BenchmarkComponentA>();
+		}
+	};
+
+	class BenchmarkComponentBRTTI : public RTTIType<BenchmarkComponentB, Component, BenchmarkComponentBRTTI>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "BenchmarkComponentB";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_BenchmarkComponentB;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<BenchmarkComponentB>();
+		}
+	};
+
+	RTTITypeBase* BenchmarkComponentA::getRTTIStatic()
+	{
+		return BenchmarkComponentARTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkComponentA::getRTTI() const
+	{
+		return BenchmarkComponentA::getRTTIStatic();
+	}
+
+	RTTITypeBase* BenchmarkComponentB::getRTTIStatic()
+	{
+		return BenchmarkComponentBRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkComponentB::getRTTI() const
+	{
+		return BenchmarkComponentB::getRTTIStatic();
+	}
+
+	/** Core object without a core thread counterpart, so syncing it only measures the cost of dirty tracking. */
+	class BenchmarkCoreObject : public CoreObject
+	{
+	public:
+		BenchmarkCoreObject()
+			:CoreObject(false)
+		{ }
+
+		/** Marks the object as dirty, queuing it for the next sync. */
+		void markDirty() { markCoreDirty(); }
+
+		/** Checks is the object waiting to be synced. */
+		bool isDirty() const { return isCoreDirty(); }
+
+		/** Creates a new initialized object. */
+		static SPtr<BenchmarkCoreObject> create()
+		{
+			SPtr<BenchmarkCoreObject> object = bs_core_ptr_new<BenchmarkCoreObject>();
+			object->_setThisPtr(object);
+			object->initialize();
+
+			return object;
+		}
+	};
+
+	EditorBenchmarkSuite::EditorBenchmarkSuite()
+	{
+		BS_ADD_TEST(EditorBenchmarkSuite::TaskSchedulerOverhead);
+		BS_ADD_TEST(EditorBenchmarkSuite::SerializationThroughput);
+		BS_ADD_TEST(EditorBenchmarkSuite::PixelConversionThroughput);
+		BS_ADD_TEST(EditorBenchmarkSuite::SceneUpdate);
+		BS_ADD_TEST(EditorBenchmarkSuite::SceneTransformUpdate);
+		BS_ADD_TEST(EditorBenchmarkSuite::VisibilityTreeCull);
+		BS_ADD_TEST(EditorBenchmarkSuite::ConvexVolumeIntersects);
+		BS_ADD_TEST(EditorBenchmarkSuite::CoreObjectDirtyTracking);
+	}
+
+	void EditorBenchmarkSuite::TaskSchedulerOverhead()
+	{
+		const UINT32 NUM_JOBS = 20000;
+
+		TaskScheduler& scheduler = TaskScheduler::instance();
+		std::atomic<UINT32> counter(0);
+
+		// Tasks with an empty body, so only the cost of creating, queuing, executing and waiting on them is measured
+		Vector<SPtr<Task>> tasks(NUM_JOBS);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_JOBS; i++)
+		{
+			tasks[i] = Task::create("Benchmark", [&counter]() { counter++; });
+			scheduler.addTask(tasks[i]);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		UINT64 taskTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(counter.load() == NUM_JOBS);
+
+		counter = 0;
+		timer.reset();
+
+		scheduler.parallelFor(0, NUM_JOBS, 1, [&counter](UINT32 begin, UINT32 end) { counter += end - begin; });
+
+		UINT64 chunkTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(counter.load() == NUM_JOBS);
+
+		LOGDBG("TaskScheduler benchmark (" + toString(scheduler.getNumWorkers()) + " workers): " + 
+			toString(taskTime * 1000.0f / NUM_JOBS) + " ns per task, " + 
+			toString(chunkTime * 1000.0f / NUM_JOBS) + " ns per parallelFor chunk.");
+	}
+
+	void EditorBenchmarkSuite::SerializationThroughput()
+	{
+		const UINT32 NUM_ARRAY_ELEMENTS = 4 * 1024 * 1024;
+		const UINT32 NUM_OBJECTS = 10000;
+
+		MemorySerializer ms;
+
+		// Single object with a large array of fixed size elements
+		SPtr<TestObjectC> largeObj = bs_shared_ptr_new<TestObjectC>();
+		largeObj->arrIntA.resize(NUM_ARRAY_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_ARRAY_ELEMENTS; i++)
+			largeObj->arrIntA[i] = i;
+
+		Timer timer;
+		UINT32 largeSize = 0;
+		UINT8* largeData = ms.encode(largeObj.get(), largeSize);
+		UINT64 largeEncodeTime = timer.getMicroseconds();
+
+		timer.reset();
+		SPtr<TestObjectC> largeDecoded = std::static_pointer_cast<TestObjectC>(ms.decode(largeData, largeSize));
+		UINT64 largeDecodeTime = timer.getMicroseconds();
+
+		bs_free(largeData);
+		BS_TEST_ASSERT(largeDecoded != nullptr && largeDecoded->arrIntA == largeObj->arrIntA);
+
+		// Many small objects, measuring the fixed per-object cost
+		SPtr<TestObjectC> smallObj = bs_shared_ptr_new<TestObjectC>();
+		smallObj->arrIntA = { 1, 2, 3, 4 };
+
+		UINT64 smallEncodeTime = 0;
+		UINT64 smallDecodeTime = 0;
+		bool smallValid = true;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			timer.reset();
+			UINT32 smallSize = 0;
+			UINT8* smallData = ms.encode(smallObj.get(), smallSize);
+			smallEncodeTime += timer.getMicroseconds();
+
+			timer.reset();
+			SPtr<TestObjectC> smallDecoded = std::static_pointer_cast<TestObjectC>(ms.decode(smallData, smallSize));
+			smallDecodeTime += timer.getMicroseconds();
+
+			bs_free(smallData);
+			smallValid &= smallDecoded != nullptr && smallDecoded->arrIntA == smallObj->arrIntA;
+		}
+
+		BS_TEST_ASSERT(smallValid);
+
+		auto toMBps = [](UINT32 numBytes, UINT64 timeUs)
+		{
+			return timeUs > 0 ? (numBytes / (1024.0f * 1024.0f)) / (timeUs / 1000000.0f) : 0.0f;
+		};
+
+		LOGDBG("Serialization benchmark: Large object (" + toString(largeSize / 1024) + " KB) encode " + 
+			toString(toMBps(largeSize, largeEncodeTime)) + " MB/s, decode " + toString(toMBps(largeSize, largeDecodeTime)) +
+			" MB/s. Small objects: encode " + toString(smallEncodeTime / (float)NUM_OBJECTS) + " us, decode " + 
+			toString(smallDecodeTime / (float)NUM_OBJECTS) + " us per object.");
+	}
+
+	void EditorBenchmarkSuite::PixelConversionThroughput()
+	{
+		const UINT32 SIZE = 1024;
+
+		std::pair<PixelFormat, PixelFormat> formatPairs[] = 
+		{
+			{ PF_R8G8B8A8, PF_B8G8R8A8 },
+			{ PF_R8G8B8, PF_R8G8B8A8 },
+			{ PF_B8G8R8A8, PF_R8 },
+			{ PF_R8G8B8A8, PF_FLOAT32_RGBA },
+			{ PF_FLOAT32_RGBA, PF_R8G8B8A8 },
+			{ PF_R8G8B8A8, PF_FLOAT16_RGBA },
+			{ PF_FLOAT16_RGBA, PF_FLOAT32_RGBA },
+			{ PF_FLOAT32_RGB, PF_FLOAT16_RGBA }
+		};
+
+		auto toMBps = [](UINT32 numBytes, UINT64 timeUs)
+		{
+			return timeUs > 0 ? (numBytes / (1024.0f * 1024.0f)) / (timeUs / 1000000.0f) : 0.0f;
+		};
+
+		for (auto& formatPair : formatPairs)
+		{
+			SPtr<PixelData> src = PixelData::create(SIZE, SIZE, 1, formatPair.first);
+			SPtr<PixelData> dst = PixelData::create(SIZE, SIZE, 1, formatPair.second);
+			SPtr<PixelData> expected = PixelData::create(SIZE, SIZE, 1, formatPair.second);
+
+			UINT8* srcData = src->getData();
+			if (PixelUtil::isFloatingPoint(formatPair.first))
+			{
+				const UINT32 pixelSize = PixelUtil::getNumElemBytes(formatPair.first);
+				for (UINT32 i = 0; i < SIZE * SIZE; i++)
+				{
+					float value = (i % 1024) / 1023.0f;
+					PixelUtil::packColor(value, 1.0f - value, value * 0.5f, 1.0f, formatPair.first, srcData + i * pixelSize);
+				}
+			}
+			else
+			{
+				for (UINT32 i = 0; i < src->getConsecutiveSize(); i++)
+					srcData[i] = (UINT8)(i * 37 + 11);
+			}
+
+			Timer timer;
+			convertPixelsPerPixel(*src, *expected);
+			UINT64 perPixelTime = timer.getMicroseconds();
+
+			timer.reset();
+			PixelUtil::bulkPixelConversion(*src, *dst);
+			UINT64 bulkTime = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(memcmp(dst->getData(), expected->getData(), dst->getConsecutiveSize()) == 0);
+
+			UINT32 srcSize = src->getConsecutiveSize();
+			LOGDBG("Pixel conversion benchmark: " + PixelUtil::getFormatName(formatPair.first) + " to " + 
+				PixelUtil::getFormatName(formatPair.second) + " " + toString(toMBps(srcSize, bulkTime)) + " MB/s, " +
+				"per-pixel " + toString(toMBps(srcSize, perPixelTime)) + " MB/s.");
+		}
+	}
+
+	void EditorBenchmarkSuite::SceneUpdate()
+	{
+		const UINT32 NUM_PARENTS = 1000;
+		const UINT32 NUM_CHILDREN = 10;
+		const UINT32 NUM_UPDATES = 100;
+
+		// Active and inactive hierarchies of the same shape. Each child has a component of each type.
+		HSceneObject activeRoot = SceneObject::create("BenchmarkActive");
+		HSceneObject inactiveRoot = SceneObject::create("BenchmarkInactive");
+
+		Vector<GameObjectHandle<BenchmarkComponentA>> componentsA;
+		Vector<GameObjectHandle<BenchmarkComponentB>> componentsB;
+
+		HSceneObject roots[] = { activeRoot, inactiveRoot };
+		for (auto& root : roots)
+		{
+			for (UINT32 i = 0; i < NUM_PARENTS; i++)
+			{
+				HSceneObject parent = SceneObject::create("Parent");
+				parent->setParent(root);
+
+				for (UINT32 j = 0; j < NUM_CHILDREN; j++)
+				{
+					HSceneObject child = SceneObject::create("Child");
+					child->setParent(parent);
+
+					GameObjectHandle<BenchmarkComponentA> componentA = child->addComponent<BenchmarkComponentA>();
+					GameObjectHandle<BenchmarkComponentB> componentB = child->addComponent<BenchmarkComponentB>();
+
+					if (root == activeRoot)
+					{
+						componentsA.push_back(componentA);
+						componentsB.push_back(componentB);
+					}
+				}
+			}
+		}
+
+		inactiveRoot->setActive(false);
+
+		// Other components in the scene are updated as well, so their cost is measured separately and subtracted
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_UPDATES; i++)
+			gCoreSceneManager()._update();
+
+		UINT64 totalTime = timer.getMicroseconds();
+
+		bool allUpdated = true;
+		for (UINT32 i = 0; i < (UINT32)componentsA.size(); i++)
+			allUpdated &= componentsA[i]->numUpdates == NUM_UPDATES && componentsB[i]->numUpdates == NUM_UPDATES;
+
+		BS_TEST_ASSERT(allUpdated);
+
+		activeRoot->destroy();
+		inactiveRoot->destroy();
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_UPDATES; i++)
+			gCoreSceneManager()._update();
+
+		UINT64 baseTime = timer.getMicroseconds();
+		UINT64 sceneTime = totalTime > baseTime ? totalTime - baseTime : 0;
+
+		UINT32 numComponents = NUM_PARENTS * NUM_CHILDREN * 2;
+		LOGDBG("Scene update benchmark (" + toString(numComponents) + " active and " + toString(numComponents) + 
+			" inactive components): " + toString(sceneTime / (float)NUM_UPDATES) + " us per update, " + 
+			toString(sceneTime * 1000.0f / (NUM_UPDATES * numComponents)) + " ns per active component.");
+	}
+
+	void EditorBenchmarkSuite::SceneTransformUpdate()
+	{
+		const UINT32 NUM_ROOTS = 100;
+		const UINT32 NUM_CHILDREN = 10;
+		const UINT32 NUM_GRANDCHILDREN = 10;
+		const UINT32 NUM_UPDATES = 100;
+
+		HSceneObject sceneRoot = SceneObject::create("BenchmarkTransforms");
+
+		Vector<HSceneObject> roots;
+		Vector<HSceneObject> leaves;
+		for (UINT32 i = 0; i < NUM_ROOTS; i++)
+		{
+			HSceneObject root = SceneObject::create("Root");
+			root->setParent(sceneRoot);
+			roots.push_back(root);
+
+			for (UINT32 j = 0; j < NUM_CHILDREN; j++)
+			{
+				HSceneObject child = SceneObject::create("Child");
+				child->setParent(root);
+				child->setPosition(Vector3(1.0f, 0.0f, 0.0f));
+
+				for (UINT32 k = 0; k < NUM_GRANDCHILDREN; k++)
+				{
+					HSceneObject grandchild = SceneObject::create("Grandchild");
+					grandchild->setParent(child);
+					grandchild->setPosition(Vector3(0.0f, 1.0f, 0.0f));
+
+					leaves.push_back(grandchild);
+				}
+			}
+		}
+
+		gCoreSceneManager()._updateTransforms();
+
+		// Moving a root only marks the root itself, so its cost should not depend on the size of the hierarchy below it
+		UINT64 rootSetTime = 0;
+		UINT64 leafSetTime = 0;
+		UINT64 propagateTime = 0;
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_UPDATES; i++)
+		{
+			Vector3 offset((float)i, 0.0f, 0.0f);
+
+			timer.reset();
+			for (auto& root : roots)
+				root->setPosition(offset);
+
+			rootSetTime += timer.getMicroseconds();
+
+			timer.reset();
+			gCoreSceneManager()._updateTransforms();
+			propagateTime += timer.getMicroseconds();
+
+			timer.reset();
+			for (UINT32 j = 0; j < NUM_ROOTS; j++)
+				leaves[j]->setPosition(Vector3(0.0f, 1.0f, 0.0f));
+
+			leafSetTime += timer.getMicroseconds();
+			gCoreSceneManager()._updateTransforms();
+		}
+
+		Vector3 expected((float)(NUM_UPDATES - 1) + 1.0f, 1.0f, 0.0f);
+
+		bool allMoved = true;
+		for (auto& leaf : leaves)
+			allMoved &= Math::approxEquals(leaf->getWorldPosition(), expected);
+
+		BS_TEST_ASSERT(allMoved);
+
+		sceneRoot->destroy();
+
+		UINT32 numObjects = NUM_ROOTS * (1 + NUM_CHILDREN * (1 + NUM_GRANDCHILDREN));
+		LOGDBG("Scene transform benchmark (" + toString(numObjects) + " objects): " + 
+			toString(rootSetTime * 1000.0f / (NUM_UPDATES * NUM_ROOTS)) + " ns per root move, " +
+			toString(leafSetTime * 1000.0f / (NUM_UPDATES * NUM_ROOTS)) + " ns per leaf move, " +
+			toString(propagateTime / (float)NUM_UPDATES) + " us per transform update.");
+	}
+
+	void EditorBenchmarkSuite::VisibilityTreeCull()
+	{
+		const UINT32 NUM_QUERIES = 10;
+		const float WORLD_SIZE = 1000.0f;
+		const UINT32 objectCounts[] = { 10000, 100000, 1000000 };
+
+		// Volume in the middle of the world, covering roughly 5% of it. Plane normals point inwards.
+		const Vector3 volumeMin(300.0f, 300.0f, 400.0f);
+		const Vector3 volumeMax(700.0f, 700.0f, 700.0f);
+
+		Vector<Plane> planes;
+		planes.push_back(Plane(Vector3::UNIT_X, volumeMin.x));
+		planes.push_back(Plane(Vector3::UNIT_Y, volumeMin.y));
+		planes.push_back(Plane(Vector3::UNIT_Z, volumeMin.z));
+		planes.push_back(Plane(-Vector3::UNIT_X, -volumeMax.x));
+		planes.push_back(Plane(-Vector3::UNIT_Y, -volumeMax.y));
+		planes.push_back(Plane(-Vector3::UNIT_Z, -volumeMax.z));
+
+		ConvexVolume volume(planes);
+
+		std::mt19937 generator(1234);
+		std::uniform_real_distribution<float> positionDist(0.0f, WORLD_SIZE);
+		std::uniform_real_distribution<float> sizeDist(0.5f, 5.0f);
+
+		for (auto numObjects : objectCounts)
+		{
+			Vector<AABox> bounds(numObjects);
+			for (auto& entry : bounds)
+			{
+				Vector3 min(positionDist(generator), positionDist(generator), positionDist(generator));
+				Vector3 size(sizeDist(generator), sizeDist(generator), sizeDist(generator));
+
+				entry = AABox(min, min + size);
+			}
+
+			Timer timer;
+			VisibilityTree tree;
+			for (UINT32 i = 0; i < numObjects; i++)
+				tree.add(i, bounds[i], 1);
+
+			UINT64 buildTime = timer.getMicroseconds();
+
+			// Tree query, including the precise test of partially intersecting leaves, same as the renderer does
+			Vector<UINT32> inside;
+			Vector<UINT32> intersecting;
+			Vector<UINT32> scratch;
+			Vector<UINT32> treeVisible;
+
+			timer.reset();
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				inside.clear();
+				intersecting.clear();
+				treeVisible.clear();
+
+				tree.query(volume, 1, inside, intersecting, scratch);
+
+				treeVisible.insert(treeVisible.end(), inside.begin(), inside.end());
+				for (auto& id : intersecting)
+				{
+					if (volume.intersects(bounds[id]))
+						treeVisible.push_back(id);
+				}
+			}
+
+			UINT64 treeTime = timer.getMicroseconds();
+
+			Vector<UINT32> linearVisible;
+			timer.reset();
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				linearVisible.clear();
+				for (UINT32 j = 0; j < numObjects; j++)
+				{
+					if (volume.intersects(bounds[j]))
+						linearVisible.push_back(j);
+				}
+			}
+
+			UINT64 linearTime = timer.getMicroseconds();
+
+			std::sort(treeVisible.begin(), treeVisible.end());
+			BS_TEST_ASSERT(treeVisible == linearVisible);
+
+			LOGDBG("Visibility tree benchmark (" + toString(numObjects) + " objects, " + 
+				toString((UINT32)linearVisible.size()) + " visible): " + toString(treeTime / (float)NUM_QUERIES) + 
+				" us per tree query, " + toString(linearTime / (float)NUM_QUERIES) + " us per linear scan, " +
+				toString(buildTime / 1000.0f) + " ms to build the tree.");
+		}
+	}
+
+	void EditorBenchmarkSuite::ConvexVolumeIntersects()
+	{
+		const UINT32 NUM_QUERIES = 10;
+		const float WORLD_SIZE = 1000.0f;
+		const UINT32 objectCounts[] = { 10000, 100000, 1000000 };
+
+		// Same volume as the visibility tree benchmark. Plane normals point inwards.
+		const Vector3 volumeMin(300.0f, 300.0f, 400.0f);
+		const Vector3 volumeMax(700.0f, 700.0f, 700.0f);
+
+		Vector<Plane> planes;
+		planes.push_back(Plane(Vector3::UNIT_X, volumeMin.x));
+		planes.push_back(Plane(Vector3::UNIT_Y, volumeMin.y));
+		planes.push_back(Plane(Vector3::UNIT_Z, volumeMin.z));
+		planes.push_back(Plane(-Vector3::UNIT_X, -volumeMax.x));
+		planes.push_back(Plane(-Vector3::UNIT_Y, -volumeMax.y));
+		planes.push_back(Plane(-Vector3::UNIT_Z, -volumeMax.z));
+
+		ConvexVolume volume(planes);
+
+		std::mt19937 generator(1234);
+		std::uniform_real_distribution<float> positionDist(0.0f, WORLD_SIZE);
+		std::uniform_real_distribution<float> sizeDist(0.5f, 5.0f);
+
+		for (auto numObjects : objectCounts)
+		{
+			Vector<Bounds> bounds(numObjects);
+			BoundsArray boundsArray;
+			for (auto& entry : bounds)
+			{
+				Vector3 min(positionDist(generator), positionDist(generator), positionDist(generator));
+				Vector3 size(sizeDist(generator), sizeDist(generator), sizeDist(generator));
+
+				AABox box(min, min + size);
+				entry = Bounds(box, Sphere(box.getCenter(), box.getRadius()));
+
+				boundsArray.add(entry);
+			}
+
+			UINT32 numWords = (numObjects + 31) / 32;
+			Vector<UINT32> scalarOutput(numWords);
+
+			Timer timer;
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				memset(scalarOutput.data(), 0, numWords * sizeof(UINT32));
+				for (UINT32 j = 0; j < numObjects; j++)
+				{
+					if (volume.intersects(bounds[j].getBox()) && volume.intersects(bounds[j].getSphere()))
+						scalarOutput[j / 32] |= 1U << (j % 32);
+				}
+			}
+
+			UINT64 scalarTime = timer.getMicroseconds();
+
+			Vector<UINT32> batchOutput;
+			timer.reset();
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+				volume.intersectsBatch(boundsArray, batchOutput);
+
+			UINT64 batchTime = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(batchOutput == scalarOutput);
+
+			LOGDBG("Convex volume intersection benchmark (" + toString(numObjects) + " objects): " + 
+				toString(scalarTime / (float)NUM_QUERIES) + " us per scalar pass, " + 
+				toString(batchTime / (float)NUM_QUERIES) + " us per batch pass.");
+		}
+	}
+
+	void EditorBenchmarkSuite::CoreObjectDirtyTracking()
+	{
+		const UINT32 NUM_OBJECTS = 100000;
+
+		CoreObjectManager& manager = CoreObjectManager::instance();
+		TaskScheduler& scheduler = TaskScheduler::instance();
+
+		Vector<SPtr<BenchmarkCoreObject>> objects(NUM_OBJECTS);
+		for (auto& object : objects)
+			object = BenchmarkCoreObject::create();
+
+		// Objects start out dirty
+		manager.syncToCore(gCoreAccessor());
+
+		auto allClean = [&]()
+		{
+			bool clean = true;
+			for (auto& object : objects)
+				clean &= !object->isDirty();
+
+			return clean;
+		};
+
+		BS_TEST_ASSERT(allClean());
+
+		// Marking from a single thread
+		Timer timer;
+		for (auto& object : objects)
+			object->markDirty();
+
+		UINT64 markTime = timer.getMicroseconds();
+
+		timer.reset();
+		manager.syncToCore(gCoreAccessor());
+		UINT64 syncTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(allClean());
+
+		// Marking from all worker threads at once, each appending to its own list
+		timer.reset();
+		scheduler.parallelFor(0, NUM_OBJECTS, 1024, [&objects](UINT32 begin, UINT32 end)
+		{
+			for (UINT32 i = begin; i < end; i++)
+				objects[i]->markDirty();
+		});
+
+		UINT64 parallelMarkTime = timer.getMicroseconds();
+
+		timer.reset();
+		manager.syncToCore(gCoreAccessor());
+		UINT64 parallelSyncTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(allClean());
+
+		for (auto& object : objects)
+			object->destroy();
+
+		LOGDBG("Core object dirty tracking benchmark (" + toString(NUM_OBJECTS) + " objects): " + 
+			toString(markTime * 1000.0f / NUM_OBJECTS) + " ns per mark, " + toString(syncTime / 1000.0f) + 
+			" ms per sync. From " + toString(scheduler.getNumWorkers()) + " workers: " + 
+			toString(parallelMarkTime * 1000.0f / NUM_OBJECTS) + " ns per mark, " + 
+			toString(parallelSyncTime / 1000.0f) + " ms per sync.");
+	}
+}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsEditorTestSuite.h"
 #include "BsSceneObject.h"
+#include "BsCoreSceneManager.h"
 #include "BsCmdRecordSO.h"
 #include "BsCmdDeleteSO.h"
 #include "BsUndoRedo.h"
@@ -15,6 +16,35 @@
 #include "BsPrefabDiff.h"
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
+#include "BsGameObjectManager.h"
+#include "BsPrefabUtility.h"
+#include "BsFileSerializer.h"
+#include "BsDataStream.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsMath.h"
+#include "BsGUIHitTestGrid.h"
+#include "BsGUITexture.h"
+#include "BsGUILayoutData.h"
+#include "BsConvexVolume.h"
+#include "BsBoundsArray.h"
+#include "BsPlane.h"
+#include "BsResourcePackage.h"
+#include "BsMappedFile.h"
+#include "BsFont.h"
+#include "BsTextData.h"
+#include "BsTextSprite.h"
+#include "BsGpuParams.h"
+#include "BsGpuParam.h"
+#include "BsGpuParamDesc.h"
+#include "BsGpuParamBlockBuffer.h"
+#include "BsCoreThread.h"
+#include "BsShader.h"
+#include "BsShaderManager.h"
+#include "BsShaderInclude.h"
+#include "BsImporter.h"
+#include "BsUUID.h"
+#include <random>
 
 namespace BansheeEngine
 {
@@ -271,6 +301,103 @@ namespace BansheeEngine
 		return TestObjectA::getRTTIStatic();
 	}
 
+	class TestObjectCRTTI : public RTTIType < TestObjectC, IReflectable, TestObjectCRTTI >
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intA, 0)
+			BS_RTTI_MEMBER_PLAIN(strA, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(arrIntA, 2)
+			BS_RTTI_MEMBER_PLAIN(floatA, 3)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		TestObjectCRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "TestObjectC";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestObjectC;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestObjectC>();
+		}
+	};
+
+	class TestObjectDRTTI : public RTTIType < TestObjectD, IReflectable, TestObjectDRTTI >
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intB, 4)
+			BS_RTTI_MEMBER_PLAIN(floatA, 3)
+			BS_RTTI_MEMBER_PLAIN(strA, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(arrIntA, 2)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		TestObjectDRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "TestObjectD";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestObjectD;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestObjectD>();
+		}
+	};
+
+	RTTITypeBase* TestObjectC::getRTTIStatic()
+	{
+		return TestObjectCRTTI::instance();
+	}
+
+	RTTITypeBase* TestObjectC::getRTTI() const
+	{
+		return TestObjectC::getRTTIStatic();
+	}
+
+	RTTITypeBase* TestObjectD::getRTTIStatic()
+	{
+		return TestObjectDRTTI::instance();
+	}
+
+	RTTITypeBase* TestObjectD::getRTTI() const
+	{
+		return TestObjectD::getRTTIStatic();
+	}
+
+	/** 
+	 * Replaces the type ID of all objects of one type in a binary serialized buffer with a different type ID. Used for
+	 * decoding data as if it was written by a different version of the type.
+	 */
+	static void replaceSerializedTypeId(UINT8* data, UINT32 size, UINT32 oldTypeId, UINT32 newTypeId)
+	{
+		for (UINT32 i = 0; (i + sizeof(UINT32)) <= size; i++)
+		{
+			if (memcmp(data + i, &oldTypeId, sizeof(UINT32)) == 0)
+				memcpy(data + i, &newTypeId, sizeof(UINT32));
+		}
+	}
+
 	class TestComponentC : public Component
 	{
 	public:
@@ -327,6 +454,136 @@ namespace BansheeEngine
 		TestComponentD() {} // Serialization only
 	};
 
+	/** Component that destroys another scene object when it is destroyed. */
+	class TestComponentE : public Component
+	{
+	public:
+		HSceneObject target;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+	protected:
+		friend class SceneObject;
+
+		TestComponentE(const HSceneObject& parent)
+			:Component(parent)
+		{}
+
+		void onDestroyed() override
+		{
+			if (target != nullptr && !target.isDestroyed())
+				target->destroy();
+		}
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestComponentERTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		TestComponentE() {} // Serialization only
+	};
+
+	class TestComponentERTTI : public RTTIType<TestComponentE, Component, TestComponentERTTI>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "TestComponentE";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestComponentE;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<TestComponentE>();
+		}
+	};
+
+	RTTITypeBase* TestComponentE::getRTTIStatic()
+	{
+		return TestComponentERTTI::instance();
+	}
+
+	RTTITypeBase* TestComponentE::getRTTI() const
+	{
+		return TestComponentE::getRTTIStatic();
+	}
+
+	class TestComponentF : public Component
+	{
+	public:
+		UINT32 numTransformChanges = 0;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+	protected:
+		friend class SceneObject;
+
+		TestComponentF(const HSceneObject& parent)
+			:Component(parent)
+		{
+			setNotifyFlags(TCF_Transform);
+		}
+
+		void onTransformChanged(TransformChangedFlags flags) override
+		{
+			numTransformChanges++;
+		}
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestComponentFRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		TestComponentF() {} // Serialization only
+	};
+
+	class TestComponentFRTTI : public RTTIType<TestComponentF, Component, TestComponentFRTTI>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "TestComponentF";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestComponentF;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return GameObjectRTTI::createGameObject<TestComponentF>();
+		}
+	};
+
+	RTTITypeBase* TestComponentF::getRTTIStatic()
+	{
+		return TestComponentFRTTI::instance();
+	}
+
+	RTTITypeBase* TestComponentF::getRTTI() const
+	{
+		return TestComponentF::getRTTIStatic();
+	}
+
 	class TestComponentCRTTI : public RTTIType < TestComponentC, Component, TestComponentCRTTI >
 	{
 	private:
@@ -412,6 +669,24 @@ namespace BansheeEngine
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc)
+		BS_ADD_TEST(EditorTestSuite::TestGameObjectIdReuse);
+		BS_ADD_TEST(EditorTestSuite::TestGameObjectStaleIds);
+		BS_ADD_TEST(EditorTestSuite::TestGameObjectPrefabRevertIds);
+		BS_ADD_TEST(EditorTestSuite::TestGameObjectDestroyFromOnDestroyed);
+		BS_ADD_TEST(EditorTestSuite::TestSceneTransformPropagation);
+		BS_ADD_TEST(EditorTestSuite::TestGUIHitTestGrid);
+		BS_ADD_TEST(EditorTestSuite::TestSerializationRoundTrip);
+		BS_ADD_TEST(EditorTestSuite::TestSerializationSchemaEvolution);
+		BS_ADD_TEST(EditorTestSuite::TestFileSerializerRoundTrip);
+		BS_ADD_TEST(EditorTestSuite::TestFileSerializerLegacyFormat);
+		BS_ADD_TEST(EditorTestSuite::TestResourcePackage);
+		BS_ADD_TEST(EditorTestSuite::TestResourceLoadBatch);
+		BS_ADD_TEST(EditorTestSuite::TestPixelConversion);
+		BS_ADD_TEST(EditorTestSuite::TestGenMipmapsNonPow2);
+		BS_ADD_TEST(EditorTestSuite::TestConvexVolumeIntersectsBatch);
+		BS_ADD_TEST(EditorTestSuite::TestIncrementalTextLayout);
+		BS_ADD_TEST(EditorTestSuite::TestGpuParamsSyncDelta);
+		BS_ADD_TEST(EditorTestSuite::TestBSLFXCache);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -732,4 +1007,1536 @@ namespace BansheeEngine
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestGameObjectIdReuse()
+	{
+		GameObjectManager& gom = GameObjectManager::instance();
+
+		HSceneObject so0 = SceneObject::create("so0");
+		UINT64 id0 = so0->getInstanceId();
+		BS_TEST_ASSERT(gom.objectExists(id0));
+
+		so0->destroy(true);
+		BS_TEST_ASSERT(!gom.objectExists(id0));
+
+		// Most recently freed slot is reused first
+		HSceneObject so1 = SceneObject::create("so1");
+		UINT64 id1 = so1->getInstanceId();
+
+		BS_TEST_ASSERT((id0 & 0xFFFFFFFF) == (id1 & 0xFFFFFFFF));
+		BS_TEST_ASSERT(id0 != id1);
+		BS_TEST_ASSERT(gom.objectExists(id1));
+
+		GameObjectHandleBase found;
+		BS_TEST_ASSERT(gom.tryGetObject(id1, found));
+		BS_TEST_ASSERT(found->getName() == "so1");
+
+		so1->destroy(true);
+		BS_TEST_ASSERT(!gom.objectExists(id1));
+	}
+
+	void EditorTestSuite::TestGameObjectStaleIds()
+	{
+		GameObjectManager& gom = GameObjectManager::instance();
+
+		HSceneObject so0 = SceneObject::create("so0");
+		GameObjectHandle<TestComponentA> cmp0 = so0->addComponent<TestComponentA>();
+
+		HSceneObject staleSO = so0;
+		GameObjectHandle<TestComponentA> staleCmp = cmp0;
+		UINT64 soId = so0->getInstanceId();
+		UINT64 cmpId = cmp0->getInstanceId();
+
+		so0->destroy(true);
+
+		// Fill the freed slots with new objects
+		HSceneObject so1 = SceneObject::create("so1");
+		GameObjectHandle<TestComponentA> cmp1 = so1->addComponent<TestComponentA>();
+
+		BS_TEST_ASSERT(staleSO.isDestroyed());
+		BS_TEST_ASSERT(staleCmp.isDestroyed());
+
+		BS_TEST_ASSERT(!gom.objectExists(soId));
+		BS_TEST_ASSERT(!gom.objectExists(cmpId));
+		BS_TEST_ASSERT(gom.getObject(soId).isDestroyed());
+		BS_TEST_ASSERT(gom.getObject(cmpId).isDestroyed());
+
+		GameObjectHandleBase found;
+		BS_TEST_ASSERT(!gom.tryGetObject(soId, found));
+		BS_TEST_ASSERT(!gom.tryGetObject(cmpId, found));
+
+		BS_TEST_ASSERT(gom.objectExists(so1->getInstanceId()));
+		BS_TEST_ASSERT(gom.objectExists(cmp1->getInstanceId()));
+
+		so1->destroy(true);
+	}
+
+	void EditorTestSuite::TestGameObjectPrefabRevertIds()
+	{
+		GameObjectManager& gom = GameObjectManager::instance();
+
+		HSceneObject root = SceneObject::create("root");
+		HSceneObject so0 = SceneObject::create("so0");
+		so0->setParent(root);
+
+		GameObjectHandle<TestComponentA> cmp0 = so0->addComponent<TestComponentA>();
+		cmp0->ref1 = root;
+
+		Path prefabPath = Path::combine(FileSystem::getTempDirectoryPath(), "testprefabids.asset");
+		HPrefab prefab = Prefab::create(root);
+		gResources().save(prefab, prefabPath, true);
+
+		HSceneObject instance = prefab->instantiate();
+		HSceneObject instanceSO0 = instance->getChild(0);
+		GameObjectHandle<TestComponentA> instanceCmp0 = instanceSO0->getComponent<TestComponentA>();
+
+		UINT64 rootId = instance->getInstanceId();
+		UINT64 so0Id = instanceSO0->getInstanceId();
+		UINT64 cmp0Id = instanceCmp0->getInstanceId();
+
+		instance->setName("modified");
+		instanceSO0->setName("modified");
+
+		// Destroys the instance and creates a new one, which takes over the IDs of the original objects
+		PrefabUtility::revertToPrefab(instance);
+
+		BS_TEST_ASSERT(!instance.isDestroyed());
+		BS_TEST_ASSERT(!instanceSO0.isDestroyed());
+		BS_TEST_ASSERT(!instanceCmp0.isDestroyed());
+
+		BS_TEST_ASSERT(instance->getInstanceId() == rootId);
+		BS_TEST_ASSERT(instanceSO0->getInstanceId() == so0Id);
+		BS_TEST_ASSERT(instanceCmp0->getInstanceId() == cmp0Id);
+
+		BS_TEST_ASSERT(instance->getName() == "root");
+		BS_TEST_ASSERT(instanceSO0->getName() == "so0");
+
+		GameObjectHandleBase found;
+		BS_TEST_ASSERT(gom.tryGetObject(rootId, found));
+		BS_TEST_ASSERT(found->getName() == "root");
+
+		BS_TEST_ASSERT(gom.tryGetObject(so0Id, found));
+		BS_TEST_ASSERT(found->getName() == "so0");
+
+		BS_TEST_ASSERT(gom.objectExists(cmp0Id));
+		BS_TEST_ASSERT(instanceCmp0->ref1 == instance);
+
+		// Remapped IDs must stop resolving once their objects are destroyed
+		instance->destroy(true);
+
+		BS_TEST_ASSERT(!gom.objectExists(rootId));
+		BS_TEST_ASSERT(!gom.objectExists(so0Id));
+		BS_TEST_ASSERT(!gom.objectExists(cmp0Id));
+
+		root->destroy();
+	}
+
+	void EditorTestSuite::TestGameObjectDestroyFromOnDestroyed()
+	{
+		const UINT32 NUM_OBJECTS = 50;
+
+		// Chain of objects, each destroying the next one when destroyed. Long enough that the destroy queue has to grow
+		// while it is being processed.
+		Vector<HSceneObject> objects;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+			objects.push_back(SceneObject::create("so" + toString(i)));
+
+		for (UINT32 i = 0; i < NUM_OBJECTS - 1; i++)
+		{
+			GameObjectHandle<TestComponentE> cmp = objects[i]->addComponent<TestComponentE>();
+			cmp->target = objects[i + 1];
+		}
+
+		objects[0]->destroy();
+		BS_TEST_ASSERT(!objects[0].isDestroyed());
+
+		GameObjectManager::instance().destroyQueuedObjects();
+
+		bool allDestroyed = true;
+		for (auto& object : objects)
+			allDestroyed &= object.isDestroyed();
+
+		BS_TEST_ASSERT(allDestroyed);
+	}
+
+	void EditorTestSuite::TestSceneTransformPropagation()
+	{
+		HSceneObject root = SceneObject::create("root");
+		HSceneObject child = SceneObject::create("child");
+		HSceneObject grandchild = SceneObject::create("grandchild");
+
+		child->setParent(root);
+		grandchild->setParent(child);
+		child->setPosition(Vector3(0.0f, 1.0f, 0.0f));
+		grandchild->setPosition(Vector3(0.0f, 0.0f, 1.0f));
+
+		GameObjectHandle<TestComponentF> rootCmp = root->addComponent<TestComponentF>();
+		GameObjectHandle<TestComponentF> grandchildCmp = grandchild->addComponent<TestComponentF>();
+
+		gCoreSceneManager()._updateTransforms();
+
+		// Read the grandchild first, so its cached transform must be detected as stale once the root moves
+		BS_TEST_ASSERT(Math::approxEquals(grandchild->getWorldPosition(), Vector3(0.0f, 1.0f, 1.0f)));
+		UINT32 hash = grandchild->getTransformHash();
+
+		root->setPosition(Vector3(1.0f, 0.0f, 0.0f));
+		BS_TEST_ASSERT(rootCmp->numTransformChanges == 1);
+		BS_TEST_ASSERT(grandchildCmp->numTransformChanges == 0);
+
+		// World transform read before the update must already reflect the change
+		BS_TEST_ASSERT(Math::approxEquals(grandchild->getWorldPosition(), Vector3(1.0f, 1.0f, 1.0f)));
+		BS_TEST_ASSERT(grandchild->getTransformHash() != hash);
+
+		gCoreSceneManager()._updateTransforms();
+		BS_TEST_ASSERT(rootCmp->numTransformChanges == 1);
+		BS_TEST_ASSERT(grandchildCmp->numTransformChanges == 1);
+		BS_TEST_ASSERT(Math::approxEquals(grandchild->getWorldPosition(), Vector3(1.0f, 1.0f, 1.0f)));
+
+		// Same, except that the change is only read after the update
+		root->setRotation(Quaternion(Vector3::UNIT_Y, Degree(90.0f)));
+		gCoreSceneManager()._updateTransforms();
+
+		BS_TEST_ASSERT(grandchildCmp->numTransformChanges == 2);
+		BS_TEST_ASSERT(Math::approxEquals(grandchild->getWorldPosition(), 
+			root->getWorldPosition() + root->getWorldRotation().rotate(Vector3(0.0f, 1.0f, 1.0f))));
+
+		root->destroy();
+	}
+
+	void EditorTestSuite::TestGUIHitTestGrid()
+	{
+		const UINT32 NUM_ELEMENTS = 200;
+		const INT32 AREA_SIZE = 1024;
+
+		std::mt19937 generator(1234);
+		std::uniform_int_distribution<INT32> positionDist(-128, AREA_SIZE);
+		std::uniform_int_distribution<INT32> sizeDist(0, 256);
+
+		// Every twentieth element covers the entire area, so it ends up in the grid's list of large elements. Elements
+		// partially outside the area get clipped.
+		auto setRandomLayout = [&](GUIElement* element, UINT32 idx)
+		{
+			GUILayoutData data;
+			if ((idx % 20) == 0)
+				data.area = Rect2I(0, 0, AREA_SIZE, AREA_SIZE);
+			else
+				data.area = Rect2I(positionDist(generator), positionDist(generator), sizeDist(generator), sizeDist(generator));
+
+			data.clipRect = Rect2I(0, 0, AREA_SIZE, AREA_SIZE);
+			element->_setLayoutData(data);
+		};
+
+		GUIHitTestGrid grid;
+		Vector<GUIElement*> allElements;
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			GUIElement* element = GUITexture::create(HSpriteTexture(), GUIImageScaleMode::StretchToFit);
+			setRandomLayout(element, i);
+			grid.markDirty(element);
+
+			allElements.push_back(element);
+		}
+
+		Vector<GUIElement*> elements = allElements;
+		auto matchesLinearScan = [&]()
+		{
+			Vector<GUIElement*> gridResults;
+			Vector<GUIElement*> linearResults;
+			for (INT32 y = -32; y < AREA_SIZE + 32; y += 13)
+			{
+				for (INT32 x = -32; x < AREA_SIZE + 32; x += 13)
+				{
+					Vector2I position(x, y);
+
+					gridResults.clear();
+					grid.findCandidates(position, gridResults);
+
+					linearResults.clear();
+					for (auto& element : elements)
+					{
+						if (element->_getClippedBounds().contains(position))
+							linearResults.push_back(element);
+					}
+
+					// Grid returns candidates in no particular order
+					std::sort(gridResults.begin(), gridResults.end());
+					std::sort(linearResults.begin(), linearResults.end());
+
+					if (gridResults != linearResults)
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+		BS_TEST_ASSERT_MSG(matchesLinearScan(), "Hit test grid results don't match after insertion.");
+
+		// Move every other element, and remove every fourth one
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i += 2)
+		{
+			setRandomLayout(allElements[i], i + 1);
+			grid.markDirty(allElements[i]);
+		}
+
+		elements.clear();
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			if ((i % 4) == 1)
+				grid.remove(allElements[i]);
+			else
+				elements.push_back(allElements[i]);
+		}
+
+		BS_TEST_ASSERT_MSG(matchesLinearScan(), "Hit test grid results don't match after moving and removing elements.");
+
+		grid.clear();
+		for (auto& element : allElements)
+			GUIElement::destroy(element);
+	}
+
+	void EditorTestSuite::TestSerializationRoundTrip()
+	{
+		MemorySerializer ms;
+
+		// Object with nested objects, pointers and arrays of dynamically sized elements
+		SPtr<TestObjectA> orgObjA = bs_shared_ptr_new<TestObjectA>();
+		orgObjA->intA = 995;
+		orgObjA->strA = "potato";
+		orgObjA->arrStrB = { "orange", "carrot" };
+		orgObjA->objB.intA = 9940;
+		orgObjA->objPtrB->strA = "kiwi";
+		orgObjA->objPtrC = nullptr;
+		orgObjA->arrObjB[1].strA = "strawberry";
+		orgObjA->arrObjPtrB[0]->intA = 99100;
+
+		UINT32 sizeA = 0;
+		UINT8* dataA = ms.encode(orgObjA.get(), sizeA);
+		SPtr<TestObjectA> newObjA = std::static_pointer_cast<TestObjectA>(ms.decode(dataA, sizeA));
+		bs_free(dataA);
+
+		BS_TEST_ASSERT(newObjA != nullptr);
+		BS_TEST_ASSERT(newObjA->intA == orgObjA->intA);
+		BS_TEST_ASSERT(newObjA->strA == orgObjA->strA);
+		BS_TEST_ASSERT(newObjA->objB.intA == orgObjA->objB.intA);
+		BS_TEST_ASSERT(newObjA->objPtrB->strA == orgObjA->objPtrB->strA);
+		BS_TEST_ASSERT(newObjA->objPtrC == nullptr);
+		BS_TEST_ASSERT(newObjA->objPtrD == nullptr);
+
+		BS_TEST_ASSERT(newObjA->arrStrB.size() == orgObjA->arrStrB.size());
+		for (UINT32 i = 0; i < (UINT32)orgObjA->arrStrB.size(); i++)
+			BS_TEST_ASSERT(newObjA->arrStrB[i] == orgObjA->arrStrB[i]);
+
+		BS_TEST_ASSERT(newObjA->arrObjB.size() == orgObjA->arrObjB.size());
+		for (UINT32 i = 0; i < (UINT32)orgObjA->arrObjB.size(); i++)
+			BS_TEST_ASSERT(newObjA->arrObjB[i].strA == orgObjA->arrObjB[i].strA);
+
+		BS_TEST_ASSERT(newObjA->arrObjPtrB.size() == orgObjA->arrObjPtrB.size());
+		for (UINT32 i = 0; i < (UINT32)orgObjA->arrObjPtrB.size(); i++)
+			BS_TEST_ASSERT(newObjA->arrObjPtrB[i]->intA == orgObjA->arrObjPtrB[i]->intA);
+
+		// Arrays of fixed size elements, both small ones and ones larger than the serializer's write buffer
+		UINT32 arraySizes[] = { 0, 1, 100, 100000 };
+		for (auto arraySize : arraySizes)
+		{
+			SPtr<TestObjectC> orgObjC = bs_shared_ptr_new<TestObjectC>();
+			orgObjC->intA = 12;
+			orgObjC->strA = "apple";
+			orgObjC->floatA = -3.5f;
+
+			orgObjC->arrIntA.resize(arraySize);
+			for (UINT32 i = 0; i < arraySize; i++)
+				orgObjC->arrIntA[i] = i * 7;
+
+			UINT32 sizeC = 0;
+			UINT8* dataC = ms.encode(orgObjC.get(), sizeC);
+			SPtr<TestObjectC> newObjC = std::static_pointer_cast<TestObjectC>(ms.decode(dataC, sizeC));
+			bs_free(dataC);
+
+			BS_TEST_ASSERT(newObjC != nullptr);
+			BS_TEST_ASSERT(newObjC->intA == orgObjC->intA);
+			BS_TEST_ASSERT(newObjC->strA == orgObjC->strA);
+			BS_TEST_ASSERT(newObjC->floatA == orgObjC->floatA);
+			BS_TEST_ASSERT(newObjC->arrIntA == orgObjC->arrIntA);
+		}
+	}
+
+	void EditorTestSuite::TestSerializationSchemaEvolution()
+	{
+		MemorySerializer ms;
+
+		// Old data read by the new version of the type. Removed field is skipped, added field keeps its default value.
+		{
+			SPtr<TestObjectC> orgObj = bs_shared_ptr_new<TestObjectC>();
+			orgObj->intA = 12;
+			orgObj->strA = "apple";
+			orgObj->floatA = -3.5f;
+			orgObj->arrIntA = { 1, 2, 3 };
+
+			UINT32 size = 0;
+			UINT8* data = ms.encode(orgObj.get(), size);
+			replaceSerializedTypeId(data, size, TID_TestObjectC, TID_TestObjectD);
+
+			SPtr<IReflectable> decoded = ms.decode(data, size);
+			bs_free(data);
+
+			BS_TEST_ASSERT(decoded != nullptr && decoded->getTypeId() == TID_TestObjectD);
+
+			SPtr<TestObjectD> newObj = std::static_pointer_cast<TestObjectD>(decoded);
+			BS_TEST_ASSERT(newObj->strA == orgObj->strA);
+			BS_TEST_ASSERT(newObj->floatA == orgObj->floatA);
+			BS_TEST_ASSERT(newObj->arrIntA == orgObj->arrIntA);
+			BS_TEST_ASSERT(newObj->intB == TestObjectD().intB);
+		}
+
+		// New data read by the old version of the type. Unknown field is skipped, missing field keeps its default value.
+		{
+			SPtr<TestObjectD> orgObj = bs_shared_ptr_new<TestObjectD>();
+			orgObj->strA = "pear";
+			orgObj->floatA = 8.25f;
+			orgObj->arrIntA = { 4, 5 };
+			orgObj->intB = 77;
+
+			UINT32 size = 0;
+			UINT8* data = ms.encode(orgObj.get(), size);
+			replaceSerializedTypeId(data, size, TID_TestObjectD, TID_TestObjectC);
+
+			SPtr<IReflectable> decoded = ms.decode(data, size);
+			bs_free(data);
+
+			BS_TEST_ASSERT(decoded != nullptr && decoded->getTypeId() == TID_TestObjectC);
+
+			SPtr<TestObjectC> newObj = std::static_pointer_cast<TestObjectC>(decoded);
+			BS_TEST_ASSERT(newObj->strA == orgObj->strA);
+			BS_TEST_ASSERT(newObj->floatA == orgObj->floatA);
+			BS_TEST_ASSERT(newObj->arrIntA == orgObj->arrIntA);
+			BS_TEST_ASSERT(newObj->intA == TestObjectC().intA);
+		}
+	}
+
+	void EditorTestSuite::TestFileSerializerRoundTrip()
+	{
+		Path filePath = Path::combine(FileSystem::getTempDirectoryPath(), "testfileserializer.asset");
+
+		// One object smaller and one larger than the encoder's write buffer, and one larger than the block size of the
+		// file stream, so its header is filled out after the start of the object was already queued for writing
+		Vector<SPtr<TestObjectC>> orgObjects;
+		UINT32 arraySizes[] = { 10, 100000, 1000000 };
+		for (auto arraySize : arraySizes)
+		{
+			SPtr<TestObjectC> orgObj = bs_shared_ptr_new<TestObjectC>();
+			orgObj->intA = arraySize;
+			orgObj->strA = "banana";
+			orgObj->floatA = 1.5f;
+
+			orgObj->arrIntA.resize(arraySize);
+			for (UINT32 i = 0; i < arraySize; i++)
+				orgObj->arrIntA[i] = i * 3;
+
+			orgObjects.push_back(orgObj);
+		}
+
+		{
+			FileEncoder fe(filePath);
+			for (auto& orgObj : orgObjects)
+				fe.encode(orgObj.get());
+		}
+
+		{
+			FileDecoder fd(filePath, true);
+			for (auto& orgObj : orgObjects)
+			{
+				SPtr<TestObjectC> newObj = std::static_pointer_cast<TestObjectC>(fd.decode());
+
+				BS_TEST_ASSERT(newObj != nullptr);
+				BS_TEST_ASSERT(newObj->intA == orgObj->intA);
+				BS_TEST_ASSERT(newObj->strA == orgObj->strA);
+				BS_TEST_ASSERT(newObj->floatA == orgObj->floatA);
+				BS_TEST_ASSERT(newObj->arrIntA == orgObj->arrIntA);
+			}
+
+			BS_TEST_ASSERT(fd.decode() == nullptr);
+		}
+
+		// Corrupt the last byte of the first object. It must fail to decode, while the second one must be unaffected.
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(filePath, false);
+
+			// File header (magic and version), followed by the object header (64-bit size and checksum)
+			UINT32 fileHeaderSize = sizeof(UINT32) * 2;
+			stream->seek(fileHeaderSize);
+
+			UINT64 firstObjectSize = 0;
+			stream->read(&firstObjectSize, sizeof(firstObjectSize));
+
+			size_t corruptPos = fileHeaderSize + sizeof(UINT64) + sizeof(UINT32) + (size_t)firstObjectSize - 1;
+			stream->seek(corruptPos);
+
+			UINT8 value = 0;
+			stream->read(&value, sizeof(value));
+			value = ~value;
+
+			stream->seek(corruptPos);
+			stream->write(&value, sizeof(value));
+			stream->close();
+		}
+
+		{
+			FileDecoder fd(filePath, true);
+			BS_TEST_ASSERT(fd.decode() == nullptr);
+
+			SPtr<TestObjectC> newObj = std::static_pointer_cast<TestObjectC>(fd.decode());
+			BS_TEST_ASSERT(newObj != nullptr && newObj->arrIntA == orgObjects[1]->arrIntA);
+		}
+
+		FileSystem::remove(filePath);
+	}
+
+	void EditorTestSuite::TestResourcePackage()
+	{
+		Path tempFolder = FileSystem::getTempDirectoryPath();
+		Path objectPath = Path::combine(tempFolder, "testpackageobject.asset");
+		Path pixelsPath = Path::combine(tempFolder, "testpackagepixels.asset");
+		Path packagePath = Path::combine(tempFolder, "testpackage.package");
+		Path invalidPackagePath = Path::combine(tempFolder, "testpackageinvalid.package");
+
+		String objectUUID = "11111111-2222-3333-4444-555555555555";
+		String pixelsUUID = "66666666-7777-8888-9999-000000000000";
+
+		SPtr<TestObjectC> orgObj = bs_shared_ptr_new<TestObjectC>();
+		orgObj->intA = 123;
+		orgObj->strA = "banana";
+		orgObj->arrIntA.resize(1000);
+		for (UINT32 i = 0; i < 1000; i++)
+			orgObj->arrIntA[i] = i * 3;
+
+		SPtr<PixelData> orgPixels = PixelData::create(64, 32, 1, PF_R8G8B8A8);
+		UINT8* orgPixelData = orgPixels->getData();
+		for (UINT32 i = 0; i < orgPixels->getConsecutiveSize(); i++)
+			orgPixelData[i] = (UINT8)(i * 7);
+
+		{
+			FileEncoder fe(objectPath);
+			fe.encode(orgObj.get());
+		}
+
+		{
+			FileEncoder fe(pixelsPath);
+			fe.encode(orgPixels.get());
+		}
+
+		Vector<std::pair<String, Path>> entries = { { objectUUID, objectPath }, { pixelsUUID, pixelsPath } };
+		BS_TEST_ASSERT(ResourcePackage::create(packagePath, entries));
+
+		{
+			SPtr<ResourcePackage> package = ResourcePackage::open(packagePath);
+			BS_TEST_ASSERT(package != nullptr);
+			if (package == nullptr)
+				return;
+
+			BS_TEST_ASSERT(package->contains(objectUUID));
+			BS_TEST_ASSERT(package->contains(pixelsUUID));
+			BS_TEST_ASSERT(!package->contains("00000000-0000-0000-0000-000000000000"));
+			BS_TEST_ASSERT(package->getResourceUUIDs().size() == 2);
+			BS_TEST_ASSERT(package->openResource("00000000-0000-0000-0000-000000000000") == nullptr);
+
+			// Data of each entry must be identical to the file it was created from
+			for (auto& entry : entries)
+			{
+				SPtr<DataStream> packageStream = package->openResource(entry.first);
+				SPtr<MemoryDataStream> fileData = bs_shared_ptr_new<MemoryDataStream>(
+					FileSystem::openFile(entry.second, true));
+
+				BS_TEST_ASSERT(packageStream != nullptr && packageStream->size() == fileData->size());
+				if (packageStream == nullptr || packageStream->size() != fileData->size())
+					continue;
+
+				SPtr<MappedFile> mappedFile = packageStream->getMappedFile();
+				BS_TEST_ASSERT(mappedFile != nullptr);
+
+				const UINT8* entryData = static_cast<MemoryDataStream*>(packageStream.get())->getPtr();
+				BS_TEST_ASSERT(memcmp(entryData, fileData->getPtr(), fileData->size()) == 0);
+			}
+
+			{
+				FileDecoder fd(package->openResource(objectUUID));
+				SPtr<TestObjectC> newObj = std::static_pointer_cast<TestObjectC>(fd.decode());
+
+				BS_TEST_ASSERT(newObj != nullptr);
+				BS_TEST_ASSERT(newObj->intA == orgObj->intA);
+				BS_TEST_ASSERT(newObj->strA == orgObj->strA);
+				BS_TEST_ASSERT(newObj->arrIntA == orgObj->arrIntA);
+			}
+
+			SPtr<PixelData> newPixels;
+			const UINT8* mappedStart = nullptr;
+			const UINT8* mappedEnd = nullptr;
+			{
+				SPtr<DataStream> pixelsStream = package->openResource(pixelsUUID);
+				mappedStart = pixelsStream->getMappedFile()->getData();
+				mappedEnd = mappedStart + pixelsStream->getMappedFile()->getSize();
+
+				FileDecoder fd(pixelsStream);
+				newPixels = std::static_pointer_cast<PixelData>(fd.decode());
+			}
+
+			BS_TEST_ASSERT(newPixels != nullptr);
+			if (newPixels != nullptr)
+			{
+				BS_TEST_ASSERT(newPixels->getWidth() == 64 && newPixels->getHeight() == 32);
+				BS_TEST_ASSERT(newPixels->getFormat() == PF_R8G8B8A8);
+				BS_TEST_ASSERT(memcmp(newPixels->getData(), orgPixelData, orgPixels->getConsecutiveSize()) == 0);
+
+				// Pixels must be referenced directly from the mapped package, which must stay mapped after both the 
+				// package and the stream are released
+				const UINT8* newPixelData = newPixels->getData();
+				BS_TEST_ASSERT(newPixelData >= mappedStart && newPixelData < mappedEnd);
+
+				package = nullptr;
+				BS_TEST_ASSERT(memcmp(newPixels->getData(), orgPixelData, orgPixels->getConsecutiveSize()) == 0);
+
+				// Mapping is copy-on-write, so the pixels can be modified without affecting the package
+				newPixels->getData()[0] = (UINT8)~orgPixelData[0];
+				newPixels = nullptr;
+
+				SPtr<ResourcePackage> reopenedPackage = ResourcePackage::open(packagePath);
+				FileDecoder fd(reopenedPackage->openResource(pixelsUUID));
+				SPtr<PixelData> reloadedPixels = std::static_pointer_cast<PixelData>(fd.decode());
+
+				BS_TEST_ASSERT(reloadedPixels != nullptr && reloadedPixels->getData()[0] == orgPixelData[0]);
+			}
+		}
+
+		// Package with an index entry pointing past the end of the file, with an offset large enough for the end of the
+		// entry to wrap around
+		{
+			UINT32 header[4] = { 0x4B505342, 1, 1, 0 }; // Magic, version, number of entries, reserved
+
+			UINT8 indexEntry[56]; // UUID, reserved, offset, size
+			memset(indexEntry, 0, sizeof(indexEntry));
+			memcpy(indexEntry, objectUUID.data(), objectUUID.size());
+
+			UINT64 offset = std::numeric_limits<UINT64>::max() - 15;
+			UINT64 size = 32;
+			memcpy(indexEntry + 40, &offset, sizeof(offset));
+			memcpy(indexEntry + 48, &size, sizeof(size));
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(invalidPackagePath);
+			stream->write(header, sizeof(header));
+			stream->write(indexEntry, sizeof(indexEntry));
+			stream->close();
+
+			BS_TEST_ASSERT(ResourcePackage::open(invalidPackagePath) == nullptr);
+		}
+
+		// Truncated package, with the index extending past the end of the file
+		{
+			UINT32 header[4] = { 0x4B505342, 1, 100, 0 };
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(invalidPackagePath);
+			stream->write(header, sizeof(header));
+			stream->close();
+
+			BS_TEST_ASSERT(ResourcePackage::open(invalidPackagePath) == nullptr);
+		}
+
+		FileSystem::remove(objectPath);
+		FileSystem::remove(pixelsPath);
+		FileSystem::remove(packagePath);
+		FileSystem::remove(invalidPackagePath);
+	}
+
+	void EditorTestSuite::TestResourceLoadBatch()
+	{
+		const UINT32 NUM_RESOURCES = 5;
+
+		BS_TEST_ASSERT(Resources::getLoadProgress(Vector<HResource>()) == 1.0f);
+
+		Vector<String> uuids;
+		Vector<Path> paths;
+		for (UINT32 i = 0; i < NUM_RESOURCES; i++)
+		{
+			HSceneObject root = SceneObject::create("root" + toString(i));
+			HPrefab prefab = Prefab::create(root);
+
+			Path path = Path::combine(FileSystem::getTempDirectoryPath(), "testloadbatch" + toString(i) + ".asset");
+			gResources().save(prefab, path, true);
+
+			uuids.push_back(prefab.getUUID());
+			paths.push_back(path);
+
+			// Prefab gets unloaded once its handle goes out of scope, so it must be loaded from the saved file
+			root->destroy();
+		}
+
+		for (auto& uuid : uuids)
+			BS_TEST_ASSERT(!gResources().isLoaded(uuid));
+
+		// Synchronous load, with a duplicate entry which must only be loaded once
+		Vector<String> batchUUIDs = uuids;
+		batchUUIDs.push_back(uuids[0]);
+
+		Vector<HResource> resources = gResources().loadBatch(batchUUIDs, false);
+		BS_TEST_ASSERT(resources.size() == NUM_RESOURCES);
+
+		for (UINT32 i = 0; i < (UINT32)resources.size(); i++)
+		{
+			BS_TEST_ASSERT(resources[i].getUUID() == uuids[i]);
+			BS_TEST_ASSERT(resources[i].isLoaded());
+		}
+
+		BS_TEST_ASSERT(Resources::getLoadProgress(resources) == 1.0f);
+
+		// Already loaded resources must be returned as they are
+		Vector<HResource> loadedResources = gResources().loadBatch(uuids, false);
+		BS_TEST_ASSERT(loadedResources.size() == NUM_RESOURCES);
+
+		for (UINT32 i = 0; i < (UINT32)loadedResources.size(); i++)
+			BS_TEST_ASSERT(loadedResources[i].getInternalPtr() == resources[i].getInternalPtr());
+
+		// Progress of a partially loaded set, with a resource that doesn't exist
+		Vector<HResource> partialResources = resources;
+		partialResources.push_back(gResources().loadFromUUID("00000000-0000-0000-0000-000000000000"));
+
+		BS_TEST_ASSERT(Resources::getLoadProgress(partialResources) == NUM_RESOURCES / (float)(NUM_RESOURCES + 1));
+
+		partialResources.clear();
+		loadedResources.clear();
+		resources.clear();
+
+		for (auto& uuid : uuids)
+			BS_TEST_ASSERT(!gResources().isLoaded(uuid));
+
+		// Asynchronous load, keeping internal references
+		Vector<HResource> prefetched = gResources().prefetch(uuids);
+		BS_TEST_ASSERT(prefetched.size() == NUM_RESOURCES);
+
+		float progress = Resources::getLoadProgress(prefetched);
+		BS_TEST_ASSERT(progress >= 0.0f && progress <= 1.0f);
+
+		for (auto& resource : prefetched)
+			resource.blockUntilLoaded();
+
+		BS_TEST_ASSERT(Resources::getLoadProgress(prefetched) == 1.0f);
+
+		// Later loads must return the prefetched resources
+		HResource loaded = gResources().loadFromUUID(uuids[1]);
+		BS_TEST_ASSERT(loaded.getInternalPtr() == prefetched[1].getInternalPtr());
+
+		for (auto& resource : prefetched)
+			gResources().release(resource);
+
+		loaded = nullptr;
+		prefetched.clear();
+
+		for (auto& uuid : uuids)
+			BS_TEST_ASSERT(!gResources().isLoaded(uuid));
+
+		for (auto& path : paths)
+			FileSystem::remove(path);
+	}
+
+	void convertPixelsPerPixel(const PixelData& src, PixelData& dst)
+	{
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
+		const bool paddedAlpha = src.getFormat() == PF_R8G8B8X8 || src.getFormat() == PF_B8G8R8X8;
+
+		const UINT8* srcPtr = src.getData();
+		UINT8* dstPtr = dst.getData();
+
+		UINT32 numPixels = src.getWidth() * src.getHeight() * src.getDepth();
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			float r, g, b, a;
+			PixelUtil::unpackColor(&r, &g, &b, &a, src.getFormat(), srcPtr);
+
+			if (paddedAlpha)
+				a = 0.0f;
+
+			PixelUtil::packColor(r, g, b, a, dst.getFormat(), dstPtr);
+
+			srcPtr += srcPixelSize;
+			dstPtr += dstPixelSize;
+		}
+	}
+
+	void EditorTestSuite::TestFileSerializerLegacyFormat()
+	{
+		Path filePath = Path::combine(FileSystem::getTempDirectoryPath(), "testfileserializerlegacy.asset");
+		MemorySerializer ms;
+
+		SPtr<TestObjectC> orgObjC = bs_shared_ptr_new<TestObjectC>();
+		orgObjC->intA = 33;
+		orgObjC->strA = "plum";
+		orgObjC->floatA = 2.25f;
+		orgObjC->arrIntA = { 9, 8, 7 };
+
+		SPtr<TestObjectD> orgObjD = bs_shared_ptr_new<TestObjectD>();
+		orgObjD->strA = "grape";
+		orgObjD->intB = 44;
+
+		// Older format has no file header, and each object is only prefixed with its 32-bit size
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(filePath);
+
+			IReflectable* objects[] = { orgObjC.get(), orgObjD.get() };
+			for (auto& object : objects)
+			{
+				UINT32 size = 0;
+				UINT8* data = ms.encode(object, size);
+
+				stream->write(&size, sizeof(size));
+				stream->write(data, size);
+				bs_free(data);
+			}
+
+			stream->close();
+		}
+
+		FileDecoder fd(filePath);
+
+		SPtr<IReflectable> decodedC = fd.decode();
+		BS_TEST_ASSERT(decodedC != nullptr && decodedC->getTypeId() == TID_TestObjectC);
+
+		SPtr<TestObjectC> newObjC = std::static_pointer_cast<TestObjectC>(decodedC);
+		BS_TEST_ASSERT(newObjC->intA == orgObjC->intA);
+		BS_TEST_ASSERT(newObjC->strA == orgObjC->strA);
+		BS_TEST_ASSERT(newObjC->floatA == orgObjC->floatA);
+		BS_TEST_ASSERT(newObjC->arrIntA == orgObjC->arrIntA);
+
+		SPtr<IReflectable> decodedD = fd.decode();
+		BS_TEST_ASSERT(decodedD != nullptr && decodedD->getTypeId() == TID_TestObjectD);
+
+		SPtr<TestObjectD> newObjD = std::static_pointer_cast<TestObjectD>(decodedD);
+		BS_TEST_ASSERT(newObjD->strA == orgObjD->strA);
+		BS_TEST_ASSERT(newObjD->intB == orgObjD->intB);
+
+		BS_TEST_ASSERT(fd.decode() == nullptr);
+
+		FileSystem::remove(filePath);
+	}
+
+	void EditorTestSuite::TestPixelConversion()
+	{
+		PixelFormat formats[] = 
+		{ 
+			PF_R8, PF_R8G8, PF_R8G8B8, PF_B8G8R8, PF_A8R8G8B8, PF_A8B8G8R8, PF_B8G8R8A8, PF_R8G8B8A8, PF_X8R8G8B8,
+			PF_X8B8G8R8, PF_R8G8B8X8, PF_B8G8R8X8, PF_FLOAT16_R, PF_FLOAT16_RG, PF_FLOAT16_RGB, PF_FLOAT16_RGBA, 
+			PF_FLOAT32_R, PF_FLOAT32_RG, PF_FLOAT32_RGB, PF_FLOAT32_RGBA
+		};
+
+		// Includes values outside of [0, 1], which must be clamped when converting to 8-bit components
+		float floatValues[] = { -2.5f, -0.001f, 0.0f, 0.25f, 0.5f, 0.999f, 1.0f, 1.001f, 3.75f, 1000.0f };
+		const UINT32 numFloatValues = sizeof(floatValues) / sizeof(floatValues[0]);
+
+		// Width that isn't a multiple of four, so the non-vectorized tails are also tested
+		const UINT32 width = 37;
+		const UINT32 height = 3;
+
+		for (auto srcFormat : formats)
+		{
+			SPtr<PixelData> src = PixelData::create(width, height, 1, srcFormat);
+			UINT8* srcData = src->getData();
+
+			if (PixelUtil::isFloatingPoint(srcFormat))
+			{
+				const UINT32 pixelSize = PixelUtil::getNumElemBytes(srcFormat);
+				for (UINT32 i = 0; i < width * height; i++)
+				{
+					float r = floatValues[i % numFloatValues];
+					float g = floatValues[(i + 3) % numFloatValues];
+					float b = floatValues[(i + 5) % numFloatValues];
+					float a = floatValues[(i + 7) % numFloatValues];
+
+					PixelUtil::packColor(r, g, b, a, srcFormat, srcData + i * pixelSize);
+				}
+			}
+			else
+			{
+				// Every byte value, including in padding bytes
+				for (UINT32 i = 0; i < src->getConsecutiveSize(); i++)
+					srcData[i] = (UINT8)(i * 37 + 11);
+			}
+
+			for (auto dstFormat : formats)
+			{
+				SPtr<PixelData> dst = PixelData::create(width, height, 1, dstFormat);
+				SPtr<PixelData> expected = PixelData::create(width, height, 1, dstFormat);
+
+				memset(dst->getData(), 0, dst->getConsecutiveSize());
+				memset(expected->getData(), 0, expected->getConsecutiveSize());
+
+				PixelUtil::bulkPixelConversion(*src, *dst);
+				convertPixelsPerPixel(*src, *expected);
+
+				BS_TEST_ASSERT_MSG(memcmp(dst->getData(), expected->getData(), dst->getConsecutiveSize()) == 0,
+					"Conversion from " + PixelUtil::getFormatName(srcFormat) + " to " + 
+					PixelUtil::getFormatName(dstFormat) + " doesn't match per-pixel conversion.");
+			}
+		}
+	}
+
+	void EditorTestSuite::TestGenMipmapsNonPow2()
+	{
+		const UINT32 width = 13;
+		const UINT32 height = 5;
+
+		// Image of a single color, which every level must keep regardless of how the filter taps are placed
+		SPtr<PixelData> src = PixelData::create(width, height, 1, PF_FLOAT32_RGBA);
+		float* srcPixels = (float*)src->getData();
+		for (UINT32 i = 0; i < width * height; i++)
+		{
+			srcPixels[i * 4 + 0] = 0.25f;
+			srcPixels[i * 4 + 1] = 0.5f;
+			srcPixels[i * 4 + 2] = 0.75f;
+			srcPixels[i * 4 + 3] = 1.0f;
+		}
+
+		MipMapGenOptions options;
+		Vector<SPtr<PixelData>> mips = PixelUtil::genMipmaps(*src, options);
+
+		UINT32 numMips = PixelUtil::getMaxMipmaps(width, height, 1, PF_FLOAT32_RGBA);
+		BS_TEST_ASSERT(mips.size() == numMips + 1);
+
+		UINT32 mipWidth = width;
+		UINT32 mipHeight = height;
+		for (auto& mip : mips)
+		{
+			BS_TEST_ASSERT(mip->getWidth() == mipWidth && mip->getHeight() == mipHeight);
+			BS_TEST_ASSERT(mip->getFormat() == PF_FLOAT32_RGBA);
+
+			const float* pixels = (const float*)mip->getData();
+			bool matches = true;
+			for (UINT32 i = 0; i < mipWidth * mipHeight; i++)
+			{
+				matches &= Math::approxEquals(pixels[i * 4 + 0], 0.25f, 0.001f);
+				matches &= Math::approxEquals(pixels[i * 4 + 1], 0.5f, 0.001f);
+				matches &= Math::approxEquals(pixels[i * 4 + 2], 0.75f, 0.001f);
+				matches &= Math::approxEquals(pixels[i * 4 + 3], 1.0f, 0.001f);
+			}
+
+			BS_TEST_ASSERT(matches);
+
+			mipWidth = std::max(mipWidth / 2, 1U);
+			mipHeight = std::max(mipHeight / 2, 1U);
+		}
+	}
+
+	/** Creates a font with a single size and two texture pages, with characters of varying widths spread over both pages. */
+	HFont createTestFont()
+	{
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = 10;
+		bitmap->texturePages.resize(2);
+
+		FONT_DESC& fontDesc = bitmap->fontDesc;
+		fontDesc.baselineOffset = 8;
+		fontDesc.lineHeight = 12;
+		fontDesc.spaceWidth = 4;
+
+		auto createChar = [](UINT32 charId)
+		{
+			CHAR_DESC charDesc;
+			charDesc.charId = charId;
+			charDesc.page = charId % 2;
+			charDesc.uvX = (charId % 16) / 16.0f;
+			charDesc.uvY = (charId / 16 % 16) / 16.0f;
+			charDesc.uvWidth = 1.0f / 16.0f;
+			charDesc.uvHeight = 1.0f / 16.0f;
+			charDesc.width = 4 + charId % 5;
+			charDesc.height = 10;
+			charDesc.xOffset = charId % 2;
+			charDesc.yOffset = 0;
+			charDesc.xAdvance = charDesc.width + 1;
+			charDesc.yAdvance = 0;
+
+			return charDesc;
+		};
+
+		for (UINT32 i = 33; i < 127; i++)
+			fontDesc.characters[i] = createChar(i);
+
+		KerningPair kerning;
+		kerning.otherCharId = 'V';
+		kerning.amount = -2;
+		fontDesc.characters['A'].kerningPairs.push_back(kerning);
+
+		fontDesc.missingGlyph = createChar('?');
+
+		return Font::create({ bitmap });
+	}
+
+	/** Text data that can compare its words and characters with another, for testing. */
+	class TestTextData : public TextData<>
+	{
+	public:
+		using TextData<>::TextData;
+
+		/** Checks if both layouts have the same words and characters. */
+		bool hasSameWords(const TestTextData& other) const
+		{
+			if (mNumChars != other.mNumChars || mNumWords != other.mNumWords)
+				return false;
+
+			for (UINT32 i = 0; i < mNumChars; i++)
+			{
+				if (mChars[i] != other.mChars[i])
+					return false;
+			}
+
+			for (UINT32 i = 0; i < mNumWords; i++)
+			{
+				const TextWord& word = mWords[i];
+				const TextWord& otherWord = other.mWords[i];
+
+				if (word.isSpacer() != otherWord.isSpacer() || word.getWidth() != otherWord.getWidth() ||
+					word.getHeight() != otherWord.getHeight() || word.getNumChars() != otherWord.getNumChars())
+					return false;
+
+				if (word.getNumChars() > 0 && 
+					(word.getCharsStart() != otherWord.getCharsStart() || word.getCharsEnd() != otherWord.getCharsEnd()))
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	/** Checks if the two text layouts have the same lines, and the lines generate the same quads. */
+	bool hasSameLines(const TextDataBase& a, const TextDataBase& b)
+	{
+		if (a.getNumLines() != b.getNumLines() || a.getNumPages() != b.getNumPages())
+			return false;
+
+		for (UINT32 i = 0; i < a.getNumPages(); i++)
+		{
+			if (a.getNumQuadsForPage(i) != b.getNumQuadsForPage(i))
+				return false;
+		}
+
+		for (UINT32 i = 0; i < a.getNumLines(); i++)
+		{
+			const TextDataBase::TextLine& lineA = a.getLine(i);
+			const TextDataBase::TextLine& lineB = b.getLine(i);
+
+			if (lineA.getWidth() != lineB.getWidth() || lineA.getHeight() != lineB.getHeight() ||
+				lineA.getNumChars() != lineB.getNumChars() || lineA.hasNewlineChar() != lineB.hasNewlineChar())
+				return false;
+
+			for (UINT32 j = 0; j < a.getNumPages(); j++)
+			{
+				UINT32 numQuads = a.getNumQuadsForPage(j);
+
+				Vector<Vector2> verticesA(numQuads * 4), verticesB(numQuads * 4);
+				Vector<Vector2> uvsA(numQuads * 4), uvsB(numQuads * 4);
+				Vector<UINT32> indicesA(numQuads * 6), indicesB(numQuads * 6);
+
+				UINT32 numQuadsA = lineA.fillBuffer(j, verticesA.data(), uvsA.data(), indicesA.data(), 0, numQuads);
+				UINT32 numQuadsB = lineB.fillBuffer(j, verticesB.data(), uvsB.data(), indicesB.data(), 0, numQuads);
+
+				if (numQuadsA != numQuadsB || verticesA != verticesB || uvsA != uvsB || indicesA != indicesB)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Checks if the two sprites have the same render elements, with the same quads. */
+	bool hasSameQuads(const TextSprite& a, const TextSprite& b)
+	{
+		if (a.getNumRenderElements() != b.getNumRenderElements())
+			return false;
+
+		for (UINT32 i = 0; i < a.getNumRenderElements(); i++)
+		{
+			UINT32 numQuads = a.getNumQuads(i);
+			if (numQuads != b.getNumQuads(i))
+				return false;
+
+			Vector<Vector2> verticesA(numQuads * 4), verticesB(numQuads * 4);
+			Vector<Vector2> uvsA(numQuads * 4), uvsB(numQuads * 4);
+			Vector<UINT32> indicesA(numQuads * 6), indicesB(numQuads * 6);
+
+			a.fillBuffer((UINT8*)verticesA.data(), (UINT8*)uvsA.data(), indicesA.data(), 0, numQuads, sizeof(Vector2),
+				sizeof(UINT32), i, Vector2I(), Rect2I(), false);
+			b.fillBuffer((UINT8*)verticesB.data(), (UINT8*)uvsB.data(), indicesB.data(), 0, numQuads, sizeof(Vector2),
+				sizeof(UINT32), i, Vector2I(), Rect2I(), false);
+
+			if (verticesA != verticesB || uvsA != uvsB || indicesA != indicesB)
+				return false;
+		}
+
+		return true;
+	}
+
+	void EditorTestSuite::TestIncrementalTextLayout()
+	{
+		HFont font = createTestFont();
+
+		const WString baseText = L"First line of text\nSecond line, a bit longer than the first one\n\nAVAVA fourth\nlast";
+
+		struct Edit
+		{
+			WString text;
+			bool reusesLines; /**< True if the edit is after a newline, so a part of the previous layout can be reused. */
+		};
+
+		Vector<Edit> edits =
+		{
+			{ baseText + L" appended", true },
+			{ L"First line of text\nSecond line, a bit longer than the first one\n\nAVAVA fourth\nl", true },
+			{ L"First line of text\nSecond line, a bit longer than the first one\n\nAVAVA fourth\n", true },
+			{ L"First line of text\nSecond line, a bit much longer than the first one\n\nAVAVA fourth\nlast", true },
+			{ L"First line of text\nSecond line, a bit longer than the first one\nAVAVA fourth\nlast", true },
+			{ L"First line of text\nSecond line, a bit longer\n than the first one\n\nAVAVA fourth\nlast", true },
+			{ L"First line of textSecond line, a bit longer than the first one\n\nAVAVA fourth\nlast", false },
+			{ L"Changed first line\nSecond line, a bit longer than the first one\n\nAVAVA fourth\nlast", false },
+			{ L"", false }
+		};
+
+		struct LayoutOptions
+		{
+			UINT32 width;
+			bool wordWrap;
+			bool wordBreak;
+		};
+
+		LayoutOptions layoutOptions[] = { { 0, false, true }, { 100, true, false }, { 60, true, true } };
+		TextVertAlign vertAligns[] = { TVA_Top, TVA_Center };
+
+		for (auto& options : layoutOptions)
+		{
+			for (auto& edit : edits)
+			{
+				// Edit in both directions, inserting and removing the same text
+				WString texts[] = { baseText, edit.text };
+				for (UINT32 i = 0; i < 2; i++)
+				{
+					const WString& prevText = texts[i];
+					const WString& newText = texts[1 - i];
+
+					TestTextData prevData(prevText, font, 10, options.width, 0, options.wordWrap, options.wordBreak);
+					TestTextData incrementalData(newText, font, 10, options.width, 0, options.wordWrap, options.wordBreak,
+						prevData, prevText);
+					TestTextData freshData(newText, font, 10, options.width, 0, options.wordWrap, options.wordBreak);
+
+					String msg = "Incremental layout doesn't match when changing \"" + toString(prevText) + "\" to \"" +
+						toString(newText) + "\".";
+
+					BS_TEST_ASSERT_MSG(incrementalData.hasSameWords(freshData), msg);
+					BS_TEST_ASSERT_MSG(hasSameLines(incrementalData, freshData), msg);
+
+					if (i == 0 && edit.reusesLines)
+						BS_TEST_ASSERT_MSG(incrementalData.getNumReusedLines() > 0, msg);
+
+					for (auto& vertAlign : vertAligns)
+					{
+						TEXT_SPRITE_DESC desc;
+						desc.font = font;
+						desc.fontSize = 10;
+						desc.width = options.width;
+						desc.height = 200;
+						desc.wordWrap = options.wordWrap;
+						desc.wordBreak = options.wordBreak;
+						desc.vertAlign = vertAlign;
+
+						TextSprite incrementalSprite;
+						desc.text = prevText;
+						incrementalSprite.update(desc, 0);
+
+						desc.text = newText;
+						incrementalSprite.update(desc, 0);
+
+						TextSprite freshSprite;
+						freshSprite.update(desc, 0);
+
+						BS_TEST_ASSERT_MSG(hasSameQuads(incrementalSprite, freshSprite), msg);
+
+						// Updating with an unchanged description must keep the same quads
+						incrementalSprite.update(desc, 0);
+						BS_TEST_ASSERT_MSG(hasSameQuads(incrementalSprite, freshSprite), msg);
+					}
+				}
+			}
+		}
+	}
+
+	void EditorTestSuite::TestConvexVolumeIntersectsBatch()
+	{
+		// Box from -10 to 10 on each axis, with one corner cut off by a diagonal plane. Plane normals point inwards.
+		Vector<Plane> planes;
+		planes.push_back(Plane(Vector3::UNIT_X, -10.0f));
+		planes.push_back(Plane(Vector3::UNIT_Y, -10.0f));
+		planes.push_back(Plane(Vector3::UNIT_Z, -10.0f));
+		planes.push_back(Plane(-Vector3::UNIT_X, -10.0f));
+		planes.push_back(Plane(-Vector3::UNIT_Y, -10.0f));
+		planes.push_back(Plane(-Vector3::UNIT_Z, -10.0f));
+		planes.push_back(Plane(Vector3::normalize(Vector3(1.0f, 1.0f, 0.0f)), -12.0f));
+
+		ConvexVolume volume(planes);
+
+		Vector<Bounds> pool;
+
+		// Boundary cases, using values exactly representable so both paths see exactly the same distances
+		auto addBounds = [&](const Vector3& boxMin, const Vector3& boxMax, const Vector3& sphereCenter, float radius)
+		{
+			pool.push_back(Bounds(AABox(boxMin, boxMax), Sphere(sphereCenter, radius)));
+		};
+
+		// Touching the +X face from outside
+		addBounds(Vector3(10.0f, 0.0f, 0.0f), Vector3(12.0f, 1.0f, 1.0f), Vector3(11.0f, 0.0f, 0.0f), 1.0f);
+
+		// Just outside the +X face
+		addBounds(Vector3(10.5f, 0.0f, 0.0f), Vector3(12.5f, 1.0f, 1.0f), Vector3(11.5f, 0.0f, 0.0f), 1.0f);
+
+		// Zero size, on the -Z face and just outside of it
+		addBounds(Vector3(0.0f, 0.0f, -10.0f), Vector3(0.0f, 0.0f, -10.0f), Vector3(0.0f, 0.0f, -10.0f), 0.0f);
+		addBounds(Vector3(0.0f, 0.0f, -10.5f), Vector3(0.0f, 0.0f, -10.5f), Vector3(0.0f, 0.0f, -10.5f), 0.0f);
+
+		// Box inside but sphere outside, and the other way around
+		addBounds(Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f), Vector3(0.0f, 20.0f, 0.0f), 1.0f);
+		addBounds(Vector3(0.0f, 20.0f, 0.0f), Vector3(1.0f, 21.0f, 1.0f), Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+
+		// Enclosing the whole volume
+		addBounds(Vector3(-100.0f, -100.0f, -100.0f), Vector3(100.0f, 100.0f, 100.0f), Vector3::ZERO, 200.0f);
+
+		// In the cut-off corner, and outside every plane
+		addBounds(Vector3(-10.0f, -10.0f, 0.0f), Vector3(-9.0f, -9.0f, 1.0f), Vector3(-9.5f, -9.5f, 0.5f), 0.5f);
+		addBounds(Vector3(-30.0f, -30.0f, -30.0f), Vector3(-20.0f, -20.0f, -20.0f), Vector3(-25.0f, -25.0f, -25.0f), 1.0f);
+
+		// Random bounds around the volume. Sphere is placed independently of the box so entries where only one of them 
+		// intersects are common.
+		std::mt19937 generator(1234);
+		std::uniform_real_distribution<float> positionDist(-20.0f, 20.0f);
+		std::uniform_real_distribution<float> sizeDist(0.0f, 5.0f);
+
+		for (UINT32 i = 0; i < 1000; i++)
+		{
+			Vector3 boxMin(positionDist(generator), positionDist(generator), positionDist(generator));
+			Vector3 boxSize(sizeDist(generator), sizeDist(generator), sizeDist(generator));
+			Vector3 sphereCenter(positionDist(generator), positionDist(generator), positionDist(generator));
+
+			addBounds(boxMin, boxMin + boxSize, sphereCenter, sizeDist(generator));
+		}
+
+		auto expectedIntersects = [&](const Bounds& bounds)
+		{
+			return volume.intersects(bounds.getBox()) && volume.intersects(bounds.getSphere());
+		};
+
+		BS_TEST_ASSERT(expectedIntersects(pool[0]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[1]));
+		BS_TEST_ASSERT(expectedIntersects(pool[2]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[3]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[4]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[5]));
+		BS_TEST_ASSERT(expectedIntersects(pool[6]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[7]));
+		BS_TEST_ASSERT(!expectedIntersects(pool[8]));
+
+		// Tests the first or the last numEntries bounds of the pool, so boundary cases end up both at the start of the
+		// array and in the last, partially filled, batch
+		auto testEntries = [&](UINT32 numEntries, bool fromStart)
+		{
+			UINT32 start = fromStart ? 0 : (UINT32)pool.size() - numEntries;
+
+			BoundsArray boundsArray;
+			for (UINT32 i = 0; i < numEntries; i++)
+				boundsArray.add(pool[start + i]);
+
+			Vector<UINT32> output;
+			volume.intersectsBatch(boundsArray, output);
+
+			BS_TEST_ASSERT(output.size() == (numEntries + 31) / 32);
+
+			bool matches = true;
+			for (UINT32 i = 0; i < (UINT32)output.size() * 32; i++)
+			{
+				bool isSet = (output[i / 32] & (1U << (i % 32))) != 0;
+				bool expected = i < numEntries && expectedIntersects(pool[start + i]);
+
+				matches &= isSet == expected;
+			}
+
+			BS_TEST_ASSERT_MSG(matches, "Batch intersection doesn't match for " + toString(numEntries) + " entries.");
+		};
+
+		const UINT32 entryCounts[] = { 0, 1, 3, 4, 5, 9, 31, 32, 33, 64, 65, 1009 };
+		for (auto numEntries : entryCounts)
+		{
+			testEntries(numEntries, true);
+			testEntries(numEntries, false);
+		}
+
+		// Padding left behind by removed and overwritten entries must not be reported
+		BoundsArray boundsArray;
+		for (UINT32 i = 0; i < 9; i++)
+			boundsArray.add(pool[i]);
+
+		boundsArray.swap(0, 8);
+		boundsArray.removeLast();
+		boundsArray.set(1, pool[6]);
+
+		Vector<UINT32> output;
+		volume.intersectsBatch(boundsArray, output);
+
+		BS_TEST_ASSERT(output.size() == 1);
+		BS_TEST_ASSERT(output[0] == ((1U << 1) | (1U << 2) | (1U << 6)));
+	}
+	void EditorTestSuite::TestGpuParamsSyncDelta()
+	{
+		const UINT32 BLOCK_SIZE = 12; // In multiples of 4 bytes
+		const UINT32 BLOCK_SIZE_BYTES = BLOCK_SIZE * sizeof(UINT32);
+		const UINT8 SENTINEL = 0xCD;
+
+		SPtr<GpuParamDesc> paramDesc = bs_shared_ptr_new<GpuParamDesc>();
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			GpuParamBlockDesc& blockDesc = paramDesc->paramBlocks["Block" + toString(i)];
+			blockDesc.name = "Block" + toString(i);
+			blockDesc.slot = i;
+			blockDesc.blockSize = BLOCK_SIZE;
+			blockDesc.isShareable = false;
+		}
+
+		// Three consecutive float4 parameters in the first block
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			GpuParamDataDesc& dataDesc = paramDesc->params["Param" + toString(i)];
+			dataDesc.name = "Param" + toString(i);
+			dataDesc.elementSize = 4;
+			dataDesc.arraySize = 1;
+			dataDesc.arrayElementStride = 4;
+			dataDesc.type = GPDT_FLOAT4;
+			dataDesc.paramBlockSlot = 0;
+			dataDesc.gpuMemOffset = i * 4;
+			dataDesc.cpuMemOffset = i * 4;
+		}
+
+		SPtr<GpuParamBlockBuffer> buffers[2];
+		for (UINT32 i = 0; i < 2; i++)
+			buffers[i] = GpuParamBlockBuffer::create(BLOCK_SIZE_BYTES);
+
+		SPtr<GpuParams> params = GpuParams::create(paramDesc, false);
+		params->setParamBlockBuffer("Block0", buffers[0]);
+		params->setParamBlockBuffer("Block1", buffers[1]);
+
+		// Initial sync sends all slots
+		params->CoreObject::syncToCore(gCoreAccessor());
+		gCoreAccessor().submitToCoreThread(true);
+
+		SPtr<GpuParamsCore> paramsCore = params->getCore();
+		SPtr<GpuParamBlockBufferCore> bufferCores[2] = { buffers[0]->getCore(), buffers[1]->getCore() };
+		SPtr<GpuParamBlockBufferCore> coreOnlyBuffer;
+
+		bool slotsMatch = false;
+		gCoreAccessor().queueCommand([&]()
+		{
+			slotsMatch = paramsCore->getParamBlockBuffer(0) == bufferCores[0] &&
+				paramsCore->getParamBlockBuffer(1) == bufferCores[1];
+
+			// Fill the core buffer with a pattern that only a sync can overwrite, and replace the second slot directly
+			// on the core thread, so we can tell which parts of the objects the next sync touches
+			UINT8 pattern[BLOCK_SIZE_BYTES];
+			memset(pattern, SENTINEL, sizeof(pattern));
+			bufferCores[0]->write(0, pattern, sizeof(pattern));
+
+			coreOnlyBuffer = GpuParamBlockBufferCore::create(BLOCK_SIZE_BYTES);
+			paramsCore->setParamBlockBuffer(1, coreOnlyBuffer);
+		});
+		gCoreAccessor().submitToCoreThread(true);
+
+		BS_TEST_ASSERT(slotsMatch);
+
+		// Dirty a single data parameter
+		GpuParamVec4 param1;
+		params->getParam("Param1", param1);
+		param1.set(Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+
+		UINT8 simData[BLOCK_SIZE_BYTES];
+		buffers[0]->read(0, simData, BLOCK_SIZE_BYTES);
+
+		params->CoreObject::syncToCore(gCoreAccessor());
+		buffers[0]->CoreObject::syncToCore(gCoreAccessor());
+		gCoreAccessor().submitToCoreThread(true);
+
+		UINT8 coreData[BLOCK_SIZE_BYTES];
+		bool slot1Kept = false;
+		gCoreAccessor().queueCommand([&]()
+		{
+			bufferCores[0]->read(0, coreData, BLOCK_SIZE_BYTES);
+			slot1Kept = paramsCore->getParamBlockBuffer(1) == coreOnlyBuffer;
+		});
+		gCoreAccessor().submitToCoreThread(true);
+
+		// Only the bytes of the modified parameter are sent, and they match the sim thread buffer
+		UINT32 paramStart = 4 * sizeof(UINT32);
+		UINT32 paramEnd = 8 * sizeof(UINT32);
+		for (UINT32 i = 0; i < BLOCK_SIZE_BYTES; i++)
+		{
+			if (i >= paramStart && i < paramEnd)
+			{
+				BS_TEST_ASSERT_MSG(coreData[i] == simData[i], "Modified byte " + toString(i) + " wasn't synced.");
+			}
+			else
+			{
+				BS_TEST_ASSERT_MSG(coreData[i] == SENTINEL, "Unmodified byte " + toString(i) + " was synced.");
+			}
+		}
+
+		// Modifying the data of a parameter doesn't resend the parameter block slots
+		BS_TEST_ASSERT(slot1Kept);
+
+		// Replacing a parameter block only sends that slot
+		SPtr<GpuParamBlockBuffer> newBuffer = GpuParamBlockBuffer::create(BLOCK_SIZE_BYTES);
+		params->setParamBlockBuffer(0, newBuffer);
+
+		params->CoreObject::syncToCore(gCoreAccessor());
+		gCoreAccessor().submitToCoreThread(true);
+
+		SPtr<GpuParamBlockBufferCore> newBufferCore = newBuffer->getCore();
+		bool slot0Replaced = false;
+		gCoreAccessor().queueCommand([&]()
+		{
+			slot0Replaced = paramsCore->getParamBlockBuffer(0) == newBufferCore;
+			slot1Kept = paramsCore->getParamBlockBuffer(1) == coreOnlyBuffer;
+
+			// Release core objects on the core thread
+			paramsCore = nullptr;
+			bufferCores[0] = nullptr;
+			bufferCores[1] = nullptr;
+			coreOnlyBuffer = nullptr;
+			newBufferCore = nullptr;
+		});
+		gCoreAccessor().submitToCoreThread(true);
+
+		BS_TEST_ASSERT(slot0Replaced);
+		BS_TEST_ASSERT(slot1Kept);
+	}
+	/** Include handler that maps include names to shader includes provided by the test. */
+	class TestShaderIncludeHandler : public IShaderIncludeHandler
+	{
+	public:
+		/** @copydoc IShaderIncludeHandler::findInclude */
+		HShaderInclude findInclude(const String& name) const override
+		{
+			auto iterFind = includes.find(name);
+			if (iterFind != includes.end())
+				return iterFind->second;
+
+			return HShaderInclude();
+		}
+
+		UnorderedMap<String, HShaderInclude> includes;
+	};
+
+	/** Returns paths of all shader cache entries in the folder that aren't in the provided list of known entries. */
+	Vector<Path> findNewCacheEntries(const Path& cacheFolder, const Vector<Path>& knownEntries)
+	{
+		Vector<Path> newEntries;
+		if (!FileSystem::isDirectory(cacheFolder))
+			return newEntries;
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(cacheFolder, files, directories);
+
+		for (auto& file : files)
+		{
+			if (file.getExtension() != ".asset")
+				continue;
+
+			if (std::find(knownEntries.begin(), knownEntries.end(), file) == knownEntries.end())
+				newEntries.push_back(file);
+		}
+
+		return newEntries;
+	}
+
+	void EditorTestSuite::TestBSLFXCache()
+	{
+		// The cache lives in the BansheeSL plugin, so shaders are compiled through the importer and the cache is inspected
+		// in its default folder
+		Path cacheFolder = FileSystem::getTempDirectoryPath() + Path("BansheeShaderCache/");
+		Path tempFolder = FileSystem::getTempDirectoryPath();
+		Path shaderAPath = Path::combine(tempFolder, "testcacheshadera.bsl");
+		Path shaderBPath = Path::combine(tempFolder, "testcacheshaderb.bsl");
+
+		SPtr<IShaderIncludeHandler> oldIncludeHandler = ShaderManager::instance().getIncludeHandler();
+		SPtr<TestShaderIncludeHandler> includeHandler = bs_shared_ptr_new<TestShaderIncludeHandler>();
+		includeHandler->includes["TestCacheInclude"] = ShaderInclude::create("// Version 1\n");
+		ShaderManager::instance().setIncludeHandler(includeHandler);
+
+		// Unique sources, so entries from previous runs are never found
+		String uniqueId = UUIDGenerator::generateRandom();
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(shaderAPath);
+			stream->writeString("// " + uniqueId + "\n#include \"TestCacheInclude\"\nParameters = { float ParamA; };\n");
+			stream->close();
+
+			stream = FileSystem::createAndOpenFile(shaderBPath);
+			stream->writeString("// " + uniqueId + "\nParameters = { float ParamB; };\n");
+			stream->close();
+		}
+
+		Vector<Path> knownEntries = findNewCacheEntries(cacheFolder, Vector<Path>());
+
+		// Compiled shaders are stored
+		HShader shaderA = static_resource_cast<Shader>(gImporter().import(shaderAPath));
+		BS_TEST_ASSERT(shaderA.isLoaded() && shaderA->hasDataParam("ParamA"));
+
+		Vector<Path> shaderAEntries = findNewCacheEntries(cacheFolder, knownEntries);
+		BS_TEST_ASSERT(shaderAEntries.size() == 1);
+		knownEntries.insert(knownEntries.end(), shaderAEntries.begin(), shaderAEntries.end());
+
+		HShader shaderB = static_resource_cast<Shader>(gImporter().import(shaderBPath));
+		BS_TEST_ASSERT(shaderB.isLoaded() && shaderB->hasDataParam("ParamB"));
+
+		Vector<Path> shaderBEntries = findNewCacheEntries(cacheFolder, knownEntries);
+		BS_TEST_ASSERT(shaderBEntries.size() == 1);
+		knownEntries.insert(knownEntries.end(), shaderBEntries.begin(), shaderBEntries.end());
+
+		if (shaderAEntries.size() == 1 && shaderBEntries.size() == 1)
+		{
+			// Compiling the same source again doesn't create a new entry
+			shaderA = static_resource_cast<Shader>(gImporter().import(shaderAPath));
+			BS_TEST_ASSERT(shaderA.isLoaded() && shaderA->hasDataParam("ParamA"));
+			BS_TEST_ASSERT(findNewCacheEntries(cacheFolder, knownEntries).empty());
+
+			// Replace the entry of the first shader with the second one. If the shader comes from the cache it will now
+			// have the parameters of the second shader.
+			FileSystem::copy(shaderBEntries[0], shaderAEntries[0]);
+
+			shaderA = static_resource_cast<Shader>(gImporter().import(shaderAPath));
+			BS_TEST_ASSERT(shaderA.isLoaded() && shaderA->hasDataParam("ParamB"));
+
+			// Changing the include invalidates the entry, so the shader is compiled from its source again
+			includeHandler->includes["TestCacheInclude"] = ShaderInclude::create("// Version 2\n");
+
+			shaderA = static_resource_cast<Shader>(gImporter().import(shaderAPath));
+			BS_TEST_ASSERT(shaderA.isLoaded() && shaderA->hasDataParam("ParamA") && !shaderA->hasDataParam("ParamB"));
+		}
+
+		ShaderManager::instance().setIncludeHandler(oldIncludeHandler);
+
+		Vector<Path> testEntries = shaderAEntries;
+		testEntries.insert(testEntries.end(), shaderBEntries.begin(), shaderBEntries.end());
+
+		for (auto& entry : testEntries)
+		{
+			Path depsPath = entry;
+			depsPath.setExtension(".deps");
+
+			if (FileSystem::exists(entry))
+				FileSystem::remove(entry);
+
+			if (FileSystem::exists(depsPath))
+				FileSystem::remove(depsPath);
+		}
+
+		FileSystem::remove(shaderAPath);
+		FileSystem::remove(shaderBPath);
+	}
 }
\ No newline at end of file
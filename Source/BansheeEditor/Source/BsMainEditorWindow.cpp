@@ -8,6 +8,7 @@
 #include "BsGUIPanel.h"
 #include "BsGUIStatusBar.h"
 #include "BsEditorTestSuite.h"
+#include "BsEditorBenchmarkSuite.h"
 #include "BsTestOutput.h"
 #include "BsRenderWindow.h"
 #include "BsCoreThread.h"
@@ -37,6 +38,9 @@ namespace BansheeEngine
 		mMenuBar->addMenuItem(L"File/Exit", nullptr, 10000);
 
 		SPtr<TestSuite> testSuite = TestSuite::create<EditorTestSuite>();
+#if BS_EDITOR_BENCHMARKS
+		testSuite->add(TestSuite::create<EditorBenchmarkSuite>());
+#endif
 		ExceptionTestOutput testOutput;
 		testSuite->run(testOutput);
 
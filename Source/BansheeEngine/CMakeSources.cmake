@@ -75,6 +75,7 @@ set(BS_BANSHEEENGINE_SRC_GUI
 	"Source/BsGUITooltipManager.cpp"
 	"Source/BsGUITooltip.cpp"
 	"Source/BsGUIWidget.cpp"
+	"Source/BsGUIHitTestGrid.cpp"
 	"Source/BsShortcutKey.cpp"
 	"Source/BsShortcutManager.cpp"
 	"Source/BsCGUIWidget.cpp"
@@ -256,6 +257,7 @@ set(BS_BANSHEEENGINE_INC_GUI
 	"Include/BsGUITooltipManager.h"
 	"Include/BsGUITooltip.h"
 	"Include/BsGUIWidget.h"
+	"Include/BsGUIHitTestGrid.h"
 	"Include/BsCGUIWidget.h"
 	"Include/BsShortcutManager.h"
 	"Include/BsShortcutKey.h"
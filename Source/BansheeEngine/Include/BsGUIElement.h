@@ -263,6 +263,9 @@ namespace BansheeEngine
 		 */
 		virtual void updateClippedBounds();
 
+		/** Recalculates the clipped bounds and notifies the parent widget so its hit test grid can be updated. */
+		void refreshClippedBounds();
+
 		/**
 		 * Helper method that returns style name used by an element of a certain type. If override style is empty, default
 		 * style for that type is returned.
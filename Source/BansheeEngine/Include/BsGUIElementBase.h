@@ -39,7 +39,8 @@ namespace BansheeEngine
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_OptimalSizeDirty = 0x80
 		};
 
 	public:
@@ -285,6 +286,12 @@ namespace BansheeEngine
 		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
+		/** 
+		 * Returns true if the optimal size of this element, or of any of its children, might have changed since the last
+		 * call to _updateOptimalLayoutSizes().
+		 */
+		bool _isOptimalSizeDirty() const { return (mFlags & GUIElem_OptimalSizeDirty) != 0; }
+
 		/** @} */
 
 	protected:
@@ -315,6 +322,12 @@ namespace BansheeEngine
 		 */
 		void setUpdateParent(GUIElementBase* updateParent);
 
+		/** 
+		 * Flags the cached optimal sizes of this element and all of its parents as out of date. Stops at the first parent
+		 * already flagged, as its own parents are then guaranteed to be flagged as well.
+		 */
+		void markOptimalSizeDirty();
+
 		GUIWidget* mParentWidget;
 		GUIPanel* mAnchorParent;
 		GUIElementBase* mUpdateParent;
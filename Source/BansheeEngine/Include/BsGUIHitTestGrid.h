@@ -0,0 +1,81 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsRect2I.h"
+#include "BsVector2I.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup GUI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Uniform grid over the clipped bounds of GUI elements belonging to a single widget. Allows the elements under a 
+	 * point to be found without testing every element in the widget.
+	 *
+	 * @note	
+	 * Elements are re-inserted lazily, on the first query after being marked dirty. Elements covering a large number of
+	 * cells (e.g. backgrounds) are kept in a separate list that is tested on every query, so they don't bloat the grid.
+	 */
+	class BS_EXPORT GUIHitTestGrid
+	{
+		/** Size of a single grid cell, in pixels. */
+		static const INT32 CELL_SIZE = 64;
+
+		/** Elements covering more than this many cells are not stored in the grid. */
+		static const UINT32 MAX_CELLS_PER_ELEMENT = 32;
+
+		/** Range of grid cells an element was inserted into, inclusive. */
+		struct CellRange
+		{
+			INT32 minX, minY;
+			INT32 maxX, maxY;
+			bool isLarge;
+		};
+
+	public:
+		/** Queues the element to be (re)inserted into the grid, using its clipped bounds at the time of the next query. */
+		void markDirty(GUIElement* element);
+
+		/** Removes the element from the grid. Must be called before the element is destroyed. */
+		void remove(GUIElement* element);
+
+		/** Removes all elements from the grid. */
+		void clear();
+
+		/**
+		 * Appends all elements whose clipped bounds contain the provided position to @p elements. Elements still need to
+		 * be tested using GUIElement::_isInBounds() as their actual interactable area might be smaller.
+		 *
+		 * @param[in]	position	Position relative to the parent widget.
+		 * @param[out]	elements	Output list of candidate elements, in no particular order.
+		 */
+		void findCandidates(const Vector2I& position, Vector<GUIElement*>& elements);
+
+	private:
+		/** Re-inserts all dirty elements. */
+		void update();
+
+		/** Inserts the element into all cells overlapping its current clipped bounds. */
+		void insert(GUIElement* element);
+
+		/** Removes the element from all cells it was inserted into. */
+		void removeFromCells(GUIElement* element, const CellRange& range);
+
+		/** Converts a coordinate into an index of the cell containing it. */
+		static INT32 toCell(INT32 coord) { return coord >= 0 ? coord / CELL_SIZE : (coord - CELL_SIZE + 1) / CELL_SIZE; }
+
+		/** Packs cell coordinates into a single key. */
+		static UINT64 toKey(INT32 x, INT32 y) { return ((UINT64)(UINT32)x << 32) | (UINT64)(UINT32)y; }
+
+		UnorderedMap<UINT64, Vector<GUIElement*>> mCells;
+		UnorderedMap<GUIElement*, CellRange> mElementCells;
+		Vector<GUIElement*> mLargeElements;
+		UnorderedSet<GUIElement*> mDirtyElements;
+	};
+
+	/** @} */
+}
@@ -8,6 +8,7 @@
 #include "BsQuaternion.h"
 #include "BsMatrix4.h"
 #include "BsEvent.h"
+#include "BsGUIHitTestGrid.h"
 
 namespace BansheeEngine
 {
@@ -79,6 +80,16 @@ namespace BansheeEngine
 		/**	Returns a list of all elements parented to this widget. */
 		const Vector<GUIElement*>& getElements() const { return mElements; }
 
+		/**
+		 * Finds elements whose bounds contain the provided position. Uses a spatial grid so the cost doesn't depend on
+		 * the total number of elements in the widget.
+		 *
+		 * @param[in]	position	Position relative to the widget.
+		 * @param[out]	elements	Output list of elements, ordered by depth (front-most first). Only visible elements
+		 *							that report the position as in bounds are included.
+		 */
+		void findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements);
+
 		/** Returns the world transform that all GUI elements beloning to this widget will be transformed by. */
 		const Matrix4 getWorldTfrm() const { return mTransform; }
 
@@ -125,7 +136,19 @@ namespace BansheeEngine
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
-		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
+		/** Notifies the widget that bounds of the provided element changed and its hit test data needs updating. */
+		void _markHitTestDirty(GUIElement* elem);
+
+		/**
+		 * Queues the provided element for a layout update on the next call to _updateLayout(). The element should be the 
+		 * update parent of the element whose layout changed.
+		 */
+		void _markLayoutDirty(GUIElementBase* elem);
+
+		/**	
+		 * Updates the layout of all child elements that were marked as dirty since the last call, repositioning and 
+		 * resizing them as needed. 
+		 */
 		void _updateLayout();
 
 		/**	Updates the layout of the provided element, and queues content updates. */
@@ -193,6 +216,8 @@ namespace BansheeEngine
 		HEvent mOwnerTargetResizedConn;
 
 		Set<GUIElement*> mDirtyContents;
+		UnorderedSet<GUIElementBase*> mDirtyLayouts;
+		GUIHitTestGrid mHitTestGrid;
 
 		mutable UINT64 mCachedRTId;
 		mutable bool mWidgetIsDirty;
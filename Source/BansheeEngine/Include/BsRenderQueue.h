@@ -38,6 +38,9 @@ namespace BansheeEngine
 	 * Render objects determines rendering order of objects contained within it. Rendering order is determined by object
 	 * material, and can influence rendering of transparent or opaque objects, or be used to improve performance by grouping
 	 * similar objects together.
+	 *
+	 * Sorting is performed by packing all the sort criteria of an element into a single 64-bit key whose layout depends on
+	 * the active StateReduction mode, and then radix sorting the keys.
 	 */
 	class BS_EXPORT RenderQueue
 	{
@@ -79,6 +82,30 @@ namespace BansheeEngine
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
 	protected:
+		/**
+		 * Generates a 64-bit sort key for every sortable element and outputs them in @p keys. Keys are generated so that
+		 * their ascending order matches the order requested by the current StateReduction mode.
+		 *
+		 * Priorities and shader IDs are remapped to their rank among all unique values, in order to fit into the key. Ranks 
+		 * are cached between calls and only rebuilt when the queue contains a priority or a shader that isn't ranked yet.
+		 *
+		 * @return	False if the keys could not be generated because there are too many unique priorities, shaders or
+		 *			passes in the queue to fit into the key.
+		 */
+		bool generateSortKeys(Vector<UINT64>& keys);
+
+		/** 
+		 * Rebuilds the priority and shader rank tables so they contain only the values used by the current elements.
+		 * Returns false if there are too many unique values to fit into the key.
+		 */
+		bool buildSortRanks(UINT32 maxPriorities, UINT32 maxShaders);
+
+		/**
+		 * Stable sort of the index array @p indices based on their respective keys in @p keys, using LSD radix sort.
+		 * Both arrays are modified by the sort.
+		 */
+		void radixSort(Vector<UINT64>& keys, Vector<UINT32>& indices);
+
 		/**	Callback used for sorting elements with no material grouping. */
 		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
@@ -92,6 +119,17 @@ namespace BansheeEngine
 		Vector<UINT32> mSortableElementIdx;
 		Vector<RenderableElement*> mElements;
 
+		// Scratch buffers re-used between sort() calls
+		Vector<UINT64> mSortKeys;
+		Vector<UINT64> mSortKeysTemp;
+		Vector<UINT32> mSortIdxTemp;
+		Vector<INT32> mPrioritiesTemp;
+		Vector<UINT32> mShaderIdsTemp;
+
+		// Ranks of priorities and shader IDs in the sort key, kept for as long as all elements in the queue are ranked
+		UnorderedMap<INT32, UINT32> mPriorityRanks;
+		UnorderedMap<UINT32, UINT32> mShaderRanks;
+
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
 	};
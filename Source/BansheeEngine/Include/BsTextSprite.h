@@ -127,6 +127,19 @@ namespace BansheeEngine
 			UINT32 bufferSizeQuads);
 
 	private:
+		/** 
+		 * Calculates text quads for the specified page, starting with the provided line. Used when quads of preceding 
+		 * lines are already present in the output buffers.
+		 *
+		 * @param[in]	firstLine	Index of the first line to generate quads for.
+		 * @param[in]	firstQuad	Number of quads in the output buffers belonging to lines before @p firstLine.
+		 *
+		 * @see		genTextQuads(UINT32, const TextDataBase&, UINT32, UINT32, TextHorzAlign, TextVertAlign, SpriteAnchor, Vector2*, Vector2*, UINT32*, UINT32)
+		 */
+		static UINT32 genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 firstLine, UINT32 firstQuad, 
+			UINT32 width, UINT32 height, TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, 
+			Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads);
+
 		static const int STATIC_CHARS_TO_BUFFER = 25;
 		static const int STATIC_BUFFER_SIZE = STATIC_CHARS_TO_BUFFER * (4 * (2 * sizeof(Vector2)) + (6 * sizeof(UINT32)));
 
@@ -134,6 +147,9 @@ namespace BansheeEngine
 		void clearMesh();
 
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
+
+		TEXT_SPRITE_DESC mDesc; /**< Description used for generating the current layout and quads. */
+		SPtr<TextData<>> mTextData; /**< Current text layout. */
 	};
 
 	/** @} */
@@ -29,7 +29,7 @@ namespace BansheeEngine
 
 	void GUIElement::updateRenderElementsInternal()
 	{
-		updateClippedBounds();
+		refreshClippedBounds();
 	}
 
 	void GUIElement::updateClippedBounds()
@@ -38,6 +38,14 @@ namespace BansheeEngine
 		mClippedBounds.clip(mLayoutData.clipRect);
 	}
 
+	void GUIElement::refreshClippedBounds()
+	{
+		updateClippedBounds();
+
+		if (mParentWidget != nullptr)
+			mParentWidget->_markHitTestDirty(this);
+	}
+
 	void GUIElement::setStyle(const String& styleName)
 	{
 		mStyleName = styleName;
@@ -101,7 +109,7 @@ namespace BansheeEngine
 		GUIElementBase::_setLayoutData(data);
 		_setElementDepth(elemDepth);
 
-		updateClippedBounds();
+		refreshClippedBounds();
 	}
 
 	void GUIElement::_changeParentWidget(GUIWidget* widget)
@@ -12,14 +12,14 @@ namespace BansheeEngine
 {
 	GUIElementBase::GUIElementBase()
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty)
+		, mFlags(GUIElem_Dirty | GUIElem_OptimalSizeDirty)
 	{
 
 	}
 
 	GUIElementBase::GUIElementBase(const GUIDimensions& dimensions)
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty), mDimensions(dimensions)
+		, mFlags(GUIElem_Dirty | GUIElem_OptimalSizeDirty), mDimensions(dimensions)
 	{
 
 	}
@@ -190,13 +190,27 @@ namespace BansheeEngine
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
+		// Tracked even while hidden, otherwise parents would keep using stale sizes once the element is shown again
+		markOptimalSizeDirty();
+
 		if(!_isVisible())
 			return;
 
-		if (mUpdateParent != nullptr)
-			mUpdateParent->mFlags |= GUIElem_Dirty;
-		else
-			mFlags |= GUIElem_Dirty;
+		GUIElementBase* dirtyElement = mUpdateParent != nullptr ? mUpdateParent : this;
+		dirtyElement->mFlags |= GUIElem_Dirty;
+
+		if (dirtyElement->mParentWidget != nullptr)
+			dirtyElement->mParentWidget->_markLayoutDirty(dirtyElement);
+	}
+
+	void GUIElementBase::markOptimalSizeDirty()
+	{
+		GUIElementBase* currentElement = this;
+		while (currentElement != nullptr && !currentElement->_isOptimalSizeDirty())
+		{
+			currentElement->mFlags |= GUIElem_OptimalSizeDirty;
+			currentElement = currentElement->mParentElement;
+		}
 	}
 
 	void GUIElementBase::_markContentAsDirty()
@@ -388,10 +402,14 @@ namespace BansheeEngine
 
 	void GUIElementBase::_updateOptimalLayoutSizes()
 	{
+		// Sizes of children with nothing changed in their hierarchy are still valid from the last update
 		for(auto& child : mChildren)
 		{
-			child->_updateOptimalLayoutSizes();
+			if (child->_isOptimalSizeDirty())
+				child->_updateOptimalLayoutSizes();
 		}
+
+		mFlags &= ~GUIElem_OptimalSizeDirty;
 	}
 
 	void GUIElementBase::_updateLayoutInternal(const GUILayoutData& data)
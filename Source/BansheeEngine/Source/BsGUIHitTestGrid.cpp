@@ -0,0 +1,135 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGUIHitTestGrid.h"
+#include "BsGUIElement.h"
+
+namespace BansheeEngine
+{
+	void GUIHitTestGrid::markDirty(GUIElement* element)
+	{
+		mDirtyElements.insert(element);
+	}
+
+	void GUIHitTestGrid::remove(GUIElement* element)
+	{
+		mDirtyElements.erase(element);
+
+		auto iterFind = mElementCells.find(element);
+		if (iterFind == mElementCells.end())
+			return;
+
+		removeFromCells(element, iterFind->second);
+		mElementCells.erase(iterFind);
+	}
+
+	void GUIHitTestGrid::clear()
+	{
+		mCells.clear();
+		mElementCells.clear();
+		mLargeElements.clear();
+		mDirtyElements.clear();
+	}
+
+	void GUIHitTestGrid::findCandidates(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		update();
+
+		for (auto& element : mLargeElements)
+		{
+			if (element->_getClippedBounds().contains(position))
+				elements.push_back(element);
+		}
+
+		auto iterFind = mCells.find(toKey(toCell(position.x), toCell(position.y)));
+		if (iterFind == mCells.end())
+			return;
+
+		for (auto& element : iterFind->second)
+		{
+			if (element->_getClippedBounds().contains(position))
+				elements.push_back(element);
+		}
+	}
+
+	void GUIHitTestGrid::update()
+	{
+		for (auto& element : mDirtyElements)
+		{
+			auto iterFind = mElementCells.find(element);
+			if (iterFind != mElementCells.end())
+			{
+				removeFromCells(element, iterFind->second);
+				mElementCells.erase(iterFind);
+			}
+
+			insert(element);
+		}
+
+		mDirtyElements.clear();
+	}
+
+	void GUIHitTestGrid::insert(GUIElement* element)
+	{
+		const Rect2I& bounds = element->_getClippedBounds();
+		if (bounds.width == 0 || bounds.height == 0)
+			return;
+
+		CellRange range;
+		range.minX = toCell(bounds.x);
+		range.minY = toCell(bounds.y);
+		range.maxX = toCell(bounds.x + (INT32)bounds.width - 1);
+		range.maxY = toCell(bounds.y + (INT32)bounds.height - 1);
+
+		UINT32 numCells = (UINT32)(range.maxX - range.minX + 1) * (UINT32)(range.maxY - range.minY + 1);
+		range.isLarge = numCells > MAX_CELLS_PER_ELEMENT;
+
+		if (range.isLarge)
+			mLargeElements.push_back(element);
+		else
+		{
+			for (INT32 y = range.minY; y <= range.maxY; y++)
+			{
+				for (INT32 x = range.minX; x <= range.maxX; x++)
+					mCells[toKey(x, y)].push_back(element);
+			}
+		}
+
+		mElementCells[element] = range;
+	}
+
+	void GUIHitTestGrid::removeFromCells(GUIElement* element, const CellRange& range)
+	{
+		if (range.isLarge)
+		{
+			auto iterFind = std::find(mLargeElements.begin(), mLargeElements.end(), element);
+			if (iterFind != mLargeElements.end())
+			{
+				std::swap(*iterFind, mLargeElements.back());
+				mLargeElements.pop_back();
+			}
+
+			return;
+		}
+
+		for (INT32 y = range.minY; y <= range.maxY; y++)
+		{
+			for (INT32 x = range.minX; x <= range.maxX; x++)
+			{
+				auto iterFind = mCells.find(toKey(x, y));
+				if (iterFind == mCells.end())
+					continue;
+
+				Vector<GUIElement*>& cellElements = iterFind->second;
+				auto iterElem = std::find(cellElements.begin(), cellElements.end(), element);
+				if (iterElem != cellElements.end())
+				{
+					std::swap(*iterElem, cellElements.back());
+					cellElements.pop_back();
+				}
+
+				if (cellElements.empty())
+					mCells.erase(iterFind);
+			}
+		}
+	}
+}
@@ -1247,6 +1247,7 @@ namespace BansheeEngine
 			Vector2I windowPos = windowUnderPointer->screenToWindowPos(pointerScreenPos);
 			Vector4 vecWindowPos((float)windowPos.x, (float)windowPos.y, 0.0f, 1.0f);
 
+			Vector<GUIElement*> elementsAtPointer;
 			UINT32 widgetIdx = 0;
 			for(auto& widgetInfo : mWidgets)
 			{
@@ -1260,29 +1261,25 @@ namespace BansheeEngine
 				if(widgetWindows[widgetIdx] == windowUnderPointer 
 					&& widget->inBounds(windowToBridgedCoords(widget->getTarget()->getTarget(), windowPos)))
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
 					Vector2I localPos = getWidgetRelativePos(widget, pointerScreenPos);
 
-					// Elements with lowest depth (most to the front) get handled first
-					for(auto iter = elements.begin(); iter != elements.end(); ++iter)
-					{
-						GUIElement* element = *iter;
+					elementsAtPointer.clear();
+					widget->findElementsAt(localPos, elementsAtPointer);
 
-						if(element->_isVisible() && element->_isInBounds(localPos))
-						{
-							ElementInfoUnderPointer elementInfo(element, widget);
+					for(auto& element : elementsAtPointer)
+					{
+						ElementInfoUnderPointer elementInfo(element, widget);
 
-							auto iterFind = std::find_if(mElementsUnderPointer.begin(), mElementsUnderPointer.end(),
-								[=](const ElementInfoUnderPointer& x) { return x.element == element; });
+						auto iterFind = std::find_if(mElementsUnderPointer.begin(), mElementsUnderPointer.end(),
+							[=](const ElementInfoUnderPointer& x) { return x.element == element; });
 
-							if (iterFind != mElementsUnderPointer.end())
-							{
-								elementInfo.usesMouseOver = iterFind->usesMouseOver;
-								elementInfo.receivedMouseOver = iterFind->receivedMouseOver;
-							}
-
-							mNewElementsUnderPointer.push_back(elementInfo);
+						if (iterFind != mElementsUnderPointer.end())
+						{
+							elementInfo.usesMouseOver = iterFind->usesMouseOver;
+							elementInfo.receivedMouseOver = iterFind->receivedMouseOver;
 						}
+
+						mNewElementsUnderPointer.push_back(elementInfo);
 					}
 				}
 
@@ -1290,7 +1287,8 @@ namespace BansheeEngine
 			}
 		}
 
-		std::sort(mNewElementsUnderPointer.begin(), mNewElementsUnderPointer.end(), 
+		// Stable, so elements at the same depth keep the order their widget returned them in
+		std::stable_sort(mNewElementsUnderPointer.begin(), mNewElementsUnderPointer.end(), 
 			[](const ElementInfoUnderPointer& a, const ElementInfoUnderPointer& b)
 		{
 			return a.element->_getDepth() < b.element->_getDepth();
@@ -81,6 +81,8 @@ namespace BansheeEngine
 
 		mElements.clear();
 		mDirtyContents.clear();
+		mDirtyLayouts.clear();
+		mHitTestGrid.clear();
 	}
 
 	void GUIWidget::setDepth(UINT8 depth)
@@ -156,35 +158,63 @@ namespace BansheeEngine
 
 	void GUIWidget::_updateLayout()
 	{
-		bs_frame_mark();
-
-		// Determine dirty contents and layouts
-		FrameStack<GUIElementBase*> todo;
-		todo.push(mPanel);
+		if (mDirtyLayouts.empty())
+			return;
 
-		while (!todo.empty())
+		bs_frame_mark();
 		{
-			GUIElementBase* currentElem = todo.top();
-			todo.pop();
+			FrameUnorderedSet<GUIElementBase*> processed;
+			FrameVector<GUIElementBase*> deferred;
+			FrameVector<std::pair<UINT32, GUIElementBase*>> dirtyElements;
 
-			if (currentElem->_isDirty())
+			// Elements dirtied by the layout update itself are handled in the same pass, but each element is updated at
+			// most once per call so an element that keeps dirtying itself doesn't stall the frame
+			while (!mDirtyLayouts.empty())
 			{
-				GUIElementBase* updateParent = currentElem->_getUpdateParent();
-				assert(updateParent != nullptr || currentElem == mPanel);
+				dirtyElements.clear();
+				for (auto& elem : mDirtyLayouts)
+				{
+					if (!processed.insert(elem).second)
+					{
+						deferred.push_back(elem);
+						continue;
+					}
 
-				if (updateParent != nullptr)
-					_updateLayout(updateParent);
-				else // Must be root panel
-					_updateLayout(mPanel);
-			}
-			else
-			{
-				UINT32 numChildren = currentElem->_getNumChildren();
-				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+					UINT32 depth = 0;
+					for (GUIElementBase* parent = elem->_getParent(); parent != nullptr; parent = parent->_getParent())
+						depth++;
+
+					dirtyElements.push_back(std::make_pair(depth, elem));
+				}
+
+				mDirtyLayouts.clear();
+
+				// Update parents first, as that also updates and cleans any dirty elements in their hierarchy
+				std::sort(dirtyElements.begin(), dirtyElements.end(),
+					[](const std::pair<UINT32, GUIElementBase*>& a, const std::pair<UINT32, GUIElementBase*>& b)
+				{
+					return a.first < b.first;
+				});
+
+				for (auto& entry : dirtyElements)
+				{
+					GUIElementBase* dirtyElem = entry.second;
+					if (!dirtyElem->_isDirty())
+						continue;
+
+					GUIElementBase* updateParent = dirtyElem->_getUpdateParent();
+					assert(updateParent != nullptr || dirtyElem == mPanel);
+
+					if (updateParent != nullptr)
+						_updateLayout(updateParent);
+					else // Must be root panel
+						_updateLayout(mPanel);
+				}
 			}
-		}
 
+			for (auto& elem : deferred)
+				mDirtyLayouts.insert(elem);
+		}
 		bs_frame_clear();
 	}
 
@@ -255,6 +285,7 @@ namespace BansheeEngine
 		if (elem->_getType() == GUIElementBase::Type::Element)
 		{
 			mElements.push_back(static_cast<GUIElement*>(elem));
+			mHitTestGrid.markDirty(static_cast<GUIElement*>(elem));
 			mWidgetIsDirty = true;
 		}
 	}
@@ -272,7 +303,12 @@ namespace BansheeEngine
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
 			mDirtyContents.erase(static_cast<GUIElement*>(elem));
+			mHitTestGrid.remove(static_cast<GUIElement*>(elem));
+		}
+
+		mDirtyLayouts.erase(elem);
 	}
 
 	void GUIWidget::_markMeshDirty(GUIElementBase* elem)
@@ -286,6 +322,40 @@ namespace BansheeEngine
 			mDirtyContents.insert(static_cast<GUIElement*>(elem));
 	}
 
+	void GUIWidget::_markHitTestDirty(GUIElement* elem)
+	{
+		mHitTestGrid.markDirty(elem);
+	}
+
+	void GUIWidget::findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		UINT32 firstIdx = (UINT32)elements.size();
+		mHitTestGrid.findCandidates(position, elements);
+
+		UINT32 numElements = firstIdx;
+		for (UINT32 i = firstIdx; i < (UINT32)elements.size(); i++)
+		{
+			GUIElement* element = elements[i];
+			if (element->_isVisible() && element->_isInBounds(position))
+				elements[numElements++] = element;
+		}
+
+		elements.resize(numElements);
+
+		// Elements with lowest depth (most to the front) come first. Stable, so elements at the same depth are always 
+		// returned in the same order, in which the grid returned them.
+		std::stable_sort(elements.begin() + firstIdx, elements.end(),
+			[](const GUIElement* a, const GUIElement* b)
+		{
+			return a->_getDepth() < b->_getDepth();
+		});
+	}
+
+	void GUIWidget::_markLayoutDirty(GUIElementBase* elem)
+	{
+		mDirtyLayouts.insert(elem);
+	}
+
 	void GUIWidget::setSkin(const HGUISkin& skin)
 	{
 		mSkin = skin;
@@ -144,6 +144,23 @@ namespace BansheeEngine
 		char* dataPtr = (char*)data.getBuffer();
 
 		UINT32 dirtyFlags = 0;
+		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
+
+		// If only the transform changed, only the transform related fields were sent
+		if (dirtyFlags == (UINT32)LightDirtyFlag::Transform)
+		{
+			dataPtr = rttiReadElem(mPosition, dataPtr);
+			dataPtr = rttiReadElem(mRotation, dataPtr);
+			dataPtr = rttiReadElem(mBounds, dataPtr);
+
+			updateBounds();
+
+			if (mIsActive)
+				gRenderer()->notifyLightUpdated(this);
+
+			return;
+		}
+
 		bool oldIsActive = mIsActive;
 		LightType oldType = mType;
 
@@ -158,40 +175,31 @@ namespace BansheeEngine
 		dataPtr = rttiReadElem(mSpotFalloffAngle, dataPtr);
 		dataPtr = rttiReadElem(mPhysCorrectAtten, dataPtr);
 		dataPtr = rttiReadElem(mIsActive, dataPtr);
-		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
 		dataPtr = rttiReadElem(mBounds, dataPtr);
 
 		updateBounds();
 
-		if (dirtyFlags == (UINT32)LightDirtyFlag::Transform)
+		if (oldIsActive != mIsActive)
 		{
 			if (mIsActive)
-				gRenderer()->notifyLightUpdated(this);
-		}
-		else
-		{
-			if (oldIsActive != mIsActive)
-			{
-				if (mIsActive)
-					gRenderer()->notifyLightAdded(this);
-				else
-				{
-					LightType newType = mType;
-					mType = oldType;
-					gRenderer()->notifyLightRemoved(this);
-					mType = newType;
-				}
-			}
+				gRenderer()->notifyLightAdded(this);
 			else
 			{
 				LightType newType = mType;
 				mType = oldType;
 				gRenderer()->notifyLightRemoved(this);
 				mType = newType;
-
-				gRenderer()->notifyLightAdded(this);
 			}
 		}
+		else
+		{
+			LightType newType = mType;
+			mType = oldType;
+			gRenderer()->notifyLightRemoved(this);
+			mType = newType;
+
+			gRenderer()->notifyLightAdded(this);
+		}
 	}
 
 	SPtr<MeshCore> LightCore::getMesh() const
@@ -262,7 +270,30 @@ namespace BansheeEngine
 
 	CoreSyncData Light::syncToCore(FrameAlloc* allocator)
 	{
+		UINT32 dirtyFlags = getCoreDirtyFlags();
+
+		// Most common case is a light moving, in which case only send the transform related fields
+		if (dirtyFlags == (UINT32)LightDirtyFlag::Transform)
+		{
+			UINT32 size = 0;
+			size += rttiGetElemSize(dirtyFlags);
+			size += rttiGetElemSize(mPosition);
+			size += rttiGetElemSize(mRotation);
+			size += rttiGetElemSize(mBounds);
+
+			UINT8* buffer = allocator->alloc(size);
+
+			char* dataPtr = (char*)buffer;
+			dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
+			dataPtr = rttiWriteElem(mPosition, dataPtr);
+			dataPtr = rttiWriteElem(mRotation, dataPtr);
+			dataPtr = rttiWriteElem(mBounds, dataPtr);
+
+			return CoreSyncData(buffer, size);
+		}
+
 		UINT32 size = 0;
+		size += rttiGetElemSize(dirtyFlags);
 		size += rttiGetElemSize(mPosition);
 		size += rttiGetElemSize(mRotation);
 		size += rttiGetElemSize(mType);
@@ -274,12 +305,12 @@ namespace BansheeEngine
 		size += rttiGetElemSize(mSpotFalloffAngle);
 		size += rttiGetElemSize(mPhysCorrectAtten);
 		size += rttiGetElemSize(mIsActive);
-		size += rttiGetElemSize(getCoreDirtyFlags());
 		size += rttiGetElemSize(mBounds);
 
 		UINT8* buffer = allocator->alloc(size);
 
 		char* dataPtr = (char*)buffer;
+		dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
 		dataPtr = rttiWriteElem(mPosition, dataPtr);
 		dataPtr = rttiWriteElem(mRotation, dataPtr);
 		dataPtr = rttiWriteElem(mType, dataPtr);
@@ -291,7 +322,6 @@ namespace BansheeEngine
 		dataPtr = rttiWriteElem(mSpotFalloffAngle, dataPtr);
 		dataPtr = rttiWriteElem(mPhysCorrectAtten, dataPtr);
 		dataPtr = rttiWriteElem(mIsActive, dataPtr);
-		dataPtr = rttiWriteElem(getCoreDirtyFlags(), dataPtr);
 		dataPtr = rttiWriteElem(mBounds, dataPtr);
 
 		return CoreSyncData(buffer, size);
@@ -302,8 +332,11 @@ namespace BansheeEngine
 		UINT32 curHash = parent->getTransformHash();
 		if (curHash != _getLastModifiedHash())
 		{
-			setPosition(parent->getWorldPosition());
-			setRotation(parent->getWorldRotation());
+			mPosition = parent->getWorldPosition();
+			mRotation = parent->getWorldRotation();
+			updateBounds();
+
+			_markCoreDirty(LightDirtyFlag::Transform);
 			_setLastModifiedHash(curHash);
 		}
 	}
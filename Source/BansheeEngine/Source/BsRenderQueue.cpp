@@ -72,23 +72,30 @@ namespace BansheeEngine
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
-
-		switch (mStateReductionMode)
+		if (generateSortKeys(mSortKeys))
+			radixSort(mSortKeys, mSortableElementIdx);
+		else
 		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
-		}
+			// Too many unique values to fit in the key, fall back to comparison sort
+			std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
 
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+			switch (mStateReductionMode)
+			{
+			case StateReduction::None:
+				sortMethod = &elementSorterNoGroup;
+				break;
+			case StateReduction::Material:
+				sortMethod = &elementSorterPreferGroup;
+				break;
+			case StateReduction::Distance:
+				sortMethod = &elementSorterPreferSort;
+				break;
+			}
+
+			// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
+			std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(),
+				std::bind(sortMethod, _1, _2, std::cref(mSortableElements)));
+		}
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
@@ -148,6 +155,178 @@ namespace BansheeEngine
 		}
 	}
 
+	bool RenderQueue::generateSortKeys(Vector<UINT64>& keys)
+	{
+		UINT32 numElements = (UINT32)mSortableElements.size();
+		keys.resize(numElements);
+
+		if (numElements == 0)
+			return true;
+
+		static const UINT32 PRIORITY_BITS = 8;
+		static const UINT32 SHADER_BITS = 16;
+		static const UINT32 PASS_BITS = 8;
+
+		// Priorities and shader IDs can have arbitrary values, so they are remapped to their rank among all unique values.
+		// This preserves their relative order while allowing them to fit into a small number of bits. The same set of 
+		// shaders is normally rendered frame after frame, so ranks from the previous sort can usually be reused. Ranks
+		// built for a superset of the current values still preserve their order.
+		bool allRanked = true;
+		UINT32 maxPassIdx = 0;
+		for (auto& entry : mSortableElements)
+		{
+			allRanked &= mPriorityRanks.find(entry.priority) != mPriorityRanks.end() &&
+				mShaderRanks.find(entry.shaderId) != mShaderRanks.end();
+
+			maxPassIdx = std::max(maxPassIdx, entry.passIdx);
+		}
+
+		if (maxPassIdx >= (1 << PASS_BITS))
+			return false;
+
+		if (!allRanked && !buildSortRanks(1 << PRIORITY_BITS, 1 << SHADER_BITS))
+			return false;
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const SortableElement& elem = mSortableElements[i];
+
+			UINT64 priority = mPriorityRanks[elem.priority];
+			UINT64 shader = mShaderRanks[elem.shaderId];
+			UINT64 pass = elem.passIdx;
+
+			// Convert the float into an integer that preserves ordering, by flipping the sign bit for positive numbers, or
+			// all bits for negative ones (also making sure negative zero compares as equal to positive zero)
+			float distFromCamera = elem.distFromCamera;
+			if (distFromCamera == 0.0f)
+				distFromCamera = 0.0f;
+
+			UINT32 distBits;
+			memcpy(&distBits, &distFromCamera, sizeof(distBits));
+
+			UINT64 distance = distBits ^ ((distBits & 0x80000000) != 0 ? 0xFFFFFFFF : 0x80000000);
+
+			// Sequence index is not part of the key, as the radix sort is stable and the elements start in sequence order
+			UINT64 key = 0;
+			switch (mStateReductionMode)
+			{
+			case StateReduction::None:
+				key = priority << 56 | distance << 24;
+				break;
+			case StateReduction::Material:
+				key = priority << 56 | shader << 40 | pass << 32 | distance;
+				break;
+			case StateReduction::Distance:
+				key = priority << 56 | distance << 24 | shader << 8 | pass;
+				break;
+			}
+
+			keys[i] = key;
+		}
+
+		return true;
+	}
+
+	bool RenderQueue::buildSortRanks(UINT32 maxPriorities, UINT32 maxShaders)
+	{
+		mPriorityRanks.clear();
+		mShaderRanks.clear();
+
+		mPrioritiesTemp.clear();
+		mShaderIdsTemp.clear();
+		for (auto& entry : mSortableElements)
+		{
+			mPrioritiesTemp.push_back(entry.priority);
+			mShaderIdsTemp.push_back(entry.shaderId);
+		}
+
+		// Higher priorities need to go first, so they get a lower rank
+		std::sort(mPrioritiesTemp.begin(), mPrioritiesTemp.end(), std::greater<INT32>());
+		mPrioritiesTemp.erase(std::unique(mPrioritiesTemp.begin(), mPrioritiesTemp.end()), mPrioritiesTemp.end());
+
+		std::sort(mShaderIdsTemp.begin(), mShaderIdsTemp.end());
+		mShaderIdsTemp.erase(std::unique(mShaderIdsTemp.begin(), mShaderIdsTemp.end()), mShaderIdsTemp.end());
+
+		if (mPrioritiesTemp.size() > maxPriorities || mShaderIdsTemp.size() > maxShaders)
+			return false;
+
+		for (UINT32 i = 0; i < (UINT32)mPrioritiesTemp.size(); i++)
+			mPriorityRanks[mPrioritiesTemp[i]] = i;
+
+		for (UINT32 i = 0; i < (UINT32)mShaderIdsTemp.size(); i++)
+			mShaderRanks[mShaderIdsTemp[i]] = i;
+
+		return true;
+	}
+
+	void RenderQueue::radixSort(Vector<UINT64>& keys, Vector<UINT32>& indices)
+	{
+		static const UINT32 RADIX_BITS = 8;
+		static const UINT32 NUM_BUCKETS = 1 << RADIX_BITS;
+		static const UINT32 NUM_PASSES = 64 / RADIX_BITS;
+
+		UINT32 numElements = (UINT32)keys.size();
+		if (numElements <= 1)
+			return;
+
+		mSortKeysTemp.resize(numElements);
+		mSortIdxTemp.resize(numElements);
+
+		UINT64* srcKeys = keys.data();
+		UINT64* dstKeys = mSortKeysTemp.data();
+		UINT32* srcIndices = indices.data();
+		UINT32* dstIndices = mSortIdxTemp.data();
+
+		// Count the number of keys per bucket for all passes at once
+		UINT32 counts[NUM_PASSES][NUM_BUCKETS];
+		memset(counts, 0, sizeof(counts));
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			UINT64 key = srcKeys[i];
+			for (UINT32 pass = 0; pass < NUM_PASSES; pass++)
+				counts[pass][(key >> (pass * RADIX_BITS)) & (NUM_BUCKETS - 1)]++;
+		}
+
+		for (UINT32 pass = 0; pass < NUM_PASSES; pass++)
+		{
+			UINT32* passCounts = counts[pass];
+			UINT32 shift = pass * RADIX_BITS;
+
+			// If all keys have the same digit in this pass, there is nothing to do
+			if (passCounts[(srcKeys[0] >> shift) & (NUM_BUCKETS - 1)] == numElements)
+				continue;
+
+			// Convert counts to offsets
+			UINT32 offset = 0;
+			for (UINT32 i = 0; i < NUM_BUCKETS; i++)
+			{
+				UINT32 count = passCounts[i];
+				passCounts[i] = offset;
+				offset += count;
+			}
+
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				UINT64 key = srcKeys[i];
+				UINT32 dstIdx = passCounts[(key >> shift) & (NUM_BUCKETS - 1)]++;
+
+				dstKeys[dstIdx] = key;
+				dstIndices[dstIdx] = srcIndices[i];
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcIndices, dstIndices);
+		}
+
+		// Make sure the output ends up in the provided arrays
+		if (srcIndices != indices.data())
+		{
+			memcpy(indices.data(), srcIndices, numElements * sizeof(UINT32));
+			memcpy(keys.data(), srcKeys, numElements * sizeof(UINT64));
+		}
+	}
+
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
 	{
 		const SortableElement& a = lookup[aIdx];
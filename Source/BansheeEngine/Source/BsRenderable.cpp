@@ -165,11 +165,28 @@ namespace BansheeEngine
 	{
 		char* dataPtr = (char*)data.getBuffer();
 
+		UINT32 dirtyFlags = 0;
+		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
+
 		mWorldBounds.clear();
+
+		// If only the transform changed, only the transform related fields were sent
+		if (dirtyFlags == (UINT32)RenderableDirtyFlag::Transform)
+		{
+			dataPtr = rttiReadElem(mWorldBounds, dataPtr);
+			dataPtr = rttiReadElem(mTransform, dataPtr);
+			dataPtr = rttiReadElem(mTransformNoScale, dataPtr);
+			dataPtr = rttiReadElem(mPosition, dataPtr);
+
+			if (mIsActive)
+				gRenderer()->notifyRenderableUpdated(this);
+
+			return;
+		}
+
 		mMaterials.clear();
 
 		UINT32 numMaterials = 0;
-		UINT32 dirtyFlags = 0;
 		bool oldIsActive = mIsActive;
 
 		dataPtr = rttiReadElem(mLayer, dataPtr);
@@ -179,7 +196,6 @@ namespace BansheeEngine
 		dataPtr = rttiReadElem(mTransformNoScale, dataPtr);
 		dataPtr = rttiReadElem(mPosition, dataPtr);
 		dataPtr = rttiReadElem(mIsActive, dataPtr);
-		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
 
 		SPtr<MeshCore>* mesh = (SPtr<MeshCore>*)dataPtr;
 		mMesh = *mesh;
@@ -194,25 +210,17 @@ namespace BansheeEngine
 			dataPtr += sizeof(SPtr<MaterialCore>);
 		}
 
-		if (dirtyFlags == (UINT32)RenderableDirtyFlag::Transform)
+		if (oldIsActive != mIsActive)
 		{
 			if (mIsActive)
-				gRenderer()->notifyRenderableUpdated(this);
+				gRenderer()->notifyRenderableAdded(this);
+			else
+				gRenderer()->notifyRenderableRemoved(this);
 		}
 		else
 		{
-			if (oldIsActive != mIsActive)
-			{
-				if (mIsActive)
-					gRenderer()->notifyRenderableAdded(this);
-				else
-					gRenderer()->notifyRenderableRemoved(this);
-			}
-			else
-			{
-				gRenderer()->notifyRenderableRemoved(this);
-				gRenderer()->notifyRenderableAdded(this);
-			}
+			gRenderer()->notifyRenderableRemoved(this);
+			gRenderer()->notifyRenderableAdded(this);
 		}
 	}
 
@@ -273,21 +281,44 @@ namespace BansheeEngine
 
 	CoreSyncData Renderable::syncToCore(FrameAlloc* allocator)
 	{
+		UINT32 dirtyFlags = getCoreDirtyFlags();
+
+		// Most common case is an object moving, in which case only send the transform related fields
+		if (dirtyFlags == (UINT32)RenderableDirtyFlag::Transform)
+		{
+			UINT32 size = rttiGetElemSize(dirtyFlags) +
+				rttiGetElemSize(mWorldBounds) +
+				rttiGetElemSize(mTransform) +
+				rttiGetElemSize(mTransformNoScale) +
+				rttiGetElemSize(mPosition);
+
+			UINT8* data = allocator->alloc(size);
+			char* dataPtr = (char*)data;
+			dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
+			dataPtr = rttiWriteElem(mWorldBounds, dataPtr);
+			dataPtr = rttiWriteElem(mTransform, dataPtr);
+			dataPtr = rttiWriteElem(mTransformNoScale, dataPtr);
+			dataPtr = rttiWriteElem(mPosition, dataPtr);
+
+			return CoreSyncData(data, size);
+		}
+
 		UINT32 numMaterials = (UINT32)mMaterials.size();
 
-		UINT32 size = rttiGetElemSize(mLayer) + 
+		UINT32 size = rttiGetElemSize(dirtyFlags) +
+			rttiGetElemSize(mLayer) + 
 			rttiGetElemSize(mWorldBounds) + 
 			rttiGetElemSize(numMaterials) + 
 			rttiGetElemSize(mTransform) +
 			rttiGetElemSize(mTransformNoScale) +
 			rttiGetElemSize(mPosition) +
 			rttiGetElemSize(mIsActive) +
-			rttiGetElemSize(getCoreDirtyFlags()) +
 			sizeof(SPtr<MeshCore>) + 
 			numMaterials * sizeof(SPtr<MaterialCore>);
 
 		UINT8* data = allocator->alloc(size);
 		char* dataPtr = (char*)data;
+		dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
 		dataPtr = rttiWriteElem(mLayer, dataPtr);
 		dataPtr = rttiWriteElem(mWorldBounds, dataPtr);
 		dataPtr = rttiWriteElem(numMaterials, dataPtr);
@@ -295,7 +326,6 @@ namespace BansheeEngine
 		dataPtr = rttiWriteElem(mTransformNoScale, dataPtr);
 		dataPtr = rttiWriteElem(mPosition, dataPtr);
 		dataPtr = rttiWriteElem(mIsActive, dataPtr);
-		dataPtr = rttiWriteElem(getCoreDirtyFlags(), dataPtr);
 
 		SPtr<MeshCore>* mesh = new (dataPtr) SPtr<MeshCore>();
 		if (mMesh.isLoaded())
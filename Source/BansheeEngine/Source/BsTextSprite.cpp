@@ -18,11 +18,72 @@ namespace BansheeEngine
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
+		// Layout only depends on the text, font and wrapping options. If those match, the previous layout can be used as 
+		// is, or updated from the first changed line onward if only the text changed.
+		bool sameLayoutOptions = mTextData != nullptr && mDesc.font == desc.font && mDesc.fontSize == desc.fontSize &&
+			mDesc.wordWrap == desc.wordWrap && mDesc.wordBreak == desc.wordBreak && 
+			(!desc.wordWrap || mDesc.width == desc.width);
+
+		SPtr<TextData<>> textData;
+		UINT32 numReusedLines = 0;
+		if (sameLayoutOptions && mDesc.text == desc.text)
+		{
+			textData = mTextData;
+			numReusedLines = textData->getNumLines();
+		}
+		else if (sameLayoutOptions)
 		{
-			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
+			textData = bs_shared_ptr_new<TextData<>>(desc.text, desc.font, desc.fontSize, desc.width, desc.height, 
+				desc.wordWrap, desc.wordBreak, *mTextData, mDesc.text);
+			numReusedLines = textData->getNumReusedLines();
+		}
+		else
+		{
+			textData = bs_shared_ptr_new<TextData<>>(desc.text, desc.font, desc.fontSize, desc.width, desc.height, 
+				desc.wordWrap, desc.wordBreak);
+		}
+
+		// Quads of reused lines can be kept as long as the lines are positioned the same. With vertical alignment other 
+		// than top, line positions also depend on the number of lines.
+		bool samePlacement = numReusedLines > 0 && mDesc.width == desc.width && mDesc.height == desc.height && 
+			mDesc.anchor == desc.anchor && mDesc.horzAlign == desc.horzAlign && mDesc.vertAlign == desc.vertAlign &&
+			(desc.vertAlign == TVA_Top || textData->getNumLines() == mTextData->getNumLines());
 
-			UINT32 numPages = textData.getNumPages();
+		if (!samePlacement)
+			numReusedLines = 0;
+
+		UINT32 numPages = textData->getNumPages();
+
+		bs_frame_mark();
+		{
+			// Copy the quads we're keeping to temporary buffers, since the sprite allocator can only be cleared as a whole
+			FrameVector<SpriteRenderElement> keptQuads(numPages);
+			if (numReusedLines > 0)
+			{
+				for (UINT32 i = 0; i < numPages && i < (UINT32)mCachedRenderElements.size(); i++)
+				{
+					const SpriteRenderElement& cachedElem = mCachedRenderElements[i];
+
+					UINT32 numKeptQuads;
+					if (textData == mTextData)
+						numKeptQuads = textData->getNumQuadsForPage(i);
+					else
+						numKeptQuads = textData->getNumReusedQuadsForPage(i);
+
+					if (numKeptQuads == 0)
+						continue;
+
+					SpriteRenderElement& keptElem = keptQuads[i];
+					keptElem.vertices = bs_frame_alloc<Vector2>(numKeptQuads * 4);
+					keptElem.uvs = bs_frame_alloc<Vector2>(numKeptQuads * 4);
+					keptElem.indexes = bs_frame_alloc<UINT32>(numKeptQuads * 6);
+					keptElem.numQuads = numKeptQuads;
+
+					memcpy(keptElem.vertices, cachedElem.vertices, sizeof(Vector2) * numKeptQuads * 4);
+					memcpy(keptElem.uvs, cachedElem.uvs, sizeof(Vector2) * numKeptQuads * 4);
+					memcpy(keptElem.indexes, cachedElem.indexes, sizeof(UINT32) * numKeptQuads * 6);
+				}
+			}
 
 			// Free all previous memory
 			for (auto& cachedElem : mCachedRenderElements)
@@ -42,14 +103,14 @@ namespace BansheeEngine
 			UINT32 texPage = 0;
 			for (auto& cachedElem : mCachedRenderElements)
 			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
+				UINT32 newNumQuads = textData->getNumQuadsForPage(texPage);
 
 				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
 				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
 				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
 				cachedElem.numQuads = newNumQuads;
 
-				const HTexture& tex = textData.getTextureForPage(texPage);
+				const HTexture& tex = textData->getTextureForPage(texPage);
 
 				SpriteMaterialInfo& matInfo = cachedElem.matInfo;
 				matInfo.groupId = groupId;
@@ -60,23 +121,46 @@ namespace BansheeEngine
 				texPage++;
 			}
 
-			// Calc alignment and anchor offsets and set final line positions
+			// Restore kept quads, then calc alignment and anchor offsets and set final line positions for the rest
 			for (UINT32 j = 0; j < numPages; j++)
 			{
 				SpriteRenderElement& renderElem = mCachedRenderElements[j];
+				SpriteRenderElement& keptElem = keptQuads[j];
+
+				if (keptElem.numQuads > 0)
+				{
+					memcpy(renderElem.vertices, keptElem.vertices, sizeof(Vector2) * keptElem.numQuads * 4);
+					memcpy(renderElem.uvs, keptElem.uvs, sizeof(Vector2) * keptElem.numQuads * 4);
+					memcpy(renderElem.indexes, keptElem.indexes, sizeof(UINT32) * keptElem.numQuads * 6);
 
-				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
-					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
+					bs_frame_free(keptElem.vertices);
+					bs_frame_free(keptElem.uvs);
+					bs_frame_free(keptElem.indexes);
+				}
+
+				genTextQuads(j, *textData, numReusedLines, keptElem.numQuads, desc.width, desc.height, desc.horzAlign, 
+					desc.vertAlign, desc.anchor, renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
 			}
 		}
 
 		bs_frame_clear();
 
+		mTextData = textData;
+		mDesc = desc;
+
 		updateBounds();
 	}
 
 	UINT32 TextSprite::genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 width, UINT32 height,
 		TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads)
+	{
+		return genTextQuads(page, textData, 0, 0, width, height, horzAlign, vertAlign, anchor, vertices, uv, indices, 
+			bufferSizeQuads);
+	}
+
+	UINT32 TextSprite::genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 firstLine, UINT32 firstQuad, 
+		UINT32 width, UINT32 height, TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, 
+		Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads)
 	{
 		UINT32 numLines = textData.getNumLines();
 		UINT32 newNumQuads = textData.getNumQuadsForPage(page);
@@ -85,8 +169,8 @@ namespace BansheeEngine
 		getAlignmentOffsets(textData, width, height, horzAlign, vertAlign, alignmentOffsets);
 		Vector2I offset = getAnchorOffset(anchor, width, height);
 
-		UINT32 quadOffset = 0;
-		for(UINT32 i = 0; i < numLines; i++)
+		UINT32 quadOffset = firstQuad;
+		for(UINT32 i = firstLine; i < numLines; i++)
 		{
 			const TextDataBase::TextLine& line = textData.getLine(i);
 			UINT32 writtenQuads = line.fillBuffer(page, vertices, uv, indices, quadOffset, bufferSizeQuads);
@@ -221,6 +305,8 @@ namespace BansheeEngine
 		mCachedRenderElements.clear();
 		mAlloc.clear();
 
+		mTextData = nullptr;
+
 		updateBounds();
 	}
 }
\ No newline at end of file
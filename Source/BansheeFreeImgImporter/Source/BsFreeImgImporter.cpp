@@ -161,7 +161,12 @@ namespace BansheeEngine
 
 		Vector<SPtr<PixelData>> mipLevels;
 		if (numMips > 0)
-			mipLevels = PixelUtil::genMipmaps(*imgData, MipMapGenOptions());
+		{
+			MipMapGenOptions mipOptions;
+			mipOptions.isSRGB = sRGB;
+
+			mipLevels = PixelUtil::genMipmaps(*imgData, mipOptions);
+		}
 		else
 			mipLevels.insert(mipLevels.begin(), imgData);
 
@@ -0,0 +1,49 @@
+set(BS_BANSHEENULLRENDERAPI_INC_NOFILTER
+	"Include/BsNullVertexBuffer.h"
+	"Include/BsNullTimerQuery.h"
+	"Include/BsNullTextureManager.h"
+	"Include/BsNullTexture.h"
+	"Include/BsNullRenderWindowManager.h"
+	"Include/BsNullRenderWindow.h"
+	"Include/BsNullRenderTexture.h"
+	"Include/BsNullRenderAPIFactory.h"
+	"Include/BsNullRenderAPI.h"
+	"Include/BsNullQueryManager.h"
+	"Include/BsNullPrerequisites.h"
+	"Include/BsNullOcclusionQuery.h"
+	"Include/BsNullMultiRenderTexture.h"
+	"Include/BsNullIndexBuffer.h"
+	"Include/BsNullHardwareBufferManager.h"
+	"Include/BsNullHardwareBuffer.h"
+	"Include/BsNullGpuBuffer.h"
+	"Include/BsNullEventQuery.h"
+)
+
+set(BS_BANSHEENULLRENDERAPI_SRC_NOFILTER
+	"Source/BsNullVertexBuffer.cpp"
+	"Source/BsNullTimerQuery.cpp"
+	"Source/BsNullTextureManager.cpp"
+	"Source/BsNullTexture.cpp"
+	"Source/BsNullRenderWindowManager.cpp"
+	"Source/BsNullRenderWindow.cpp"
+	"Source/BsNullRenderTexture.cpp"
+	"Source/BsNullRenderAPIFactory.cpp"
+	"Source/BsNullRenderAPI.cpp"
+	"Source/BsNullQueryManager.cpp"
+	"Source/BsNullPlugin.cpp"
+	"Source/BsNullOcclusionQuery.cpp"
+	"Source/BsNullMultiRenderTexture.cpp"
+	"Source/BsNullIndexBuffer.cpp"
+	"Source/BsNullHardwareBufferManager.cpp"
+	"Source/BsNullHardwareBuffer.cpp"
+	"Source/BsNullGpuBuffer.cpp"
+	"Source/BsNullEventQuery.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BANSHEENULLRENDERAPI_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER})
+
+set(BS_BANSHEENULLRENDERAPI_SRC
+	${BS_BANSHEENULLRENDERAPI_INC_NOFILTER}
+	${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER}
+)
@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Hardware buffer that keeps its contents in system memory. Used as storage by all null render API buffers. */
+	class BS_NULL_EXPORT NullHardwareBuffer : public HardwareBuffer
+	{
+	public:
+		NullHardwareBuffer(GpuBufferUsage usage, UINT32 sizeInBytes, bool systemMemory = false);
+		~NullHardwareBuffer();
+
+		/** @copydoc HardwareBuffer::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest) override;
+
+		/** @copydoc HardwareBuffer::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source,
+			BufferWriteType writeFlags = BufferWriteType::Normal) override;
+
+		/** @copydoc HardwareBuffer::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset,
+			UINT32 length, bool discardWholeBuffer = false) override;
+
+	protected:
+		/** @copydoc HardwareBuffer::lockImpl */
+		void* lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options) override;
+
+		/** @copydoc HardwareBuffer::unlockImpl */
+		void unlockImpl() override;
+
+		UINT8* mData;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,45 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsIndexBuffer.h"
+#include "BsNullHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Null render API implementation of an index buffer, stored in system memory. */
+	class BS_NULL_EXPORT NullIndexBufferCore : public IndexBufferCore
+	{
+	public:
+		NullIndexBufferCore(IndexType idxType, UINT32 numIndices, GpuBufferUsage usage);
+		~NullIndexBufferCore();
+
+		/** @copydoc IndexBufferCore::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest) override;
+
+		/** @copydoc IndexBufferCore::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags = BufferWriteType::Normal) override;
+
+		/** @copydoc IndexBufferCore::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length, bool discardWholeBuffer = false) override;
+
+	protected: 
+		/** @copydoc IndexBufferCore::lockImpl */
+		void* lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options) override;
+
+		/** @copydoc IndexBufferCore::unlockImpl */
+		void unlockImpl() override;
+
+		/** @copydoc IndexBufferCore::initialize */
+		void initialize() override;
+
+		NullHardwareBuffer* mBuffer;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,54 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsMultiRenderTexture.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Null render API implementation of a render texture with multiple color surfaces.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_NULL_EXPORT NullMultiRenderTextureCore : public MultiRenderTextureCore
+	{
+	public:
+		NullMultiRenderTextureCore(const MULTI_RENDER_TEXTURE_CORE_DESC& desc);
+		virtual ~NullMultiRenderTextureCore() { }
+
+	protected:
+		/** @copydoc MultiRenderTextureCore::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		MultiRenderTextureProperties mProperties;
+	};
+
+	/**
+	 * Null render API implementation of a render texture with multiple color surfaces.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_NULL_EXPORT NullMultiRenderTexture : public MultiRenderTexture
+	{
+	public:
+		virtual ~NullMultiRenderTexture() { }
+
+	protected:
+		friend class NullTextureManager;
+
+		NullMultiRenderTexture(const MULTI_RENDER_TEXTURE_DESC& desc);
+
+		/** @copydoc MultiRenderTexture::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		MultiRenderTextureProperties mProperties;
+	};
+
+	/** @} */
+}
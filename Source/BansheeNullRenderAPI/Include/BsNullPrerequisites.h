@@ -0,0 +1,45 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+#if (BS_PLATFORM == BS_PLATFORM_WIN32) && !defined(BS_STATIC_LIB)
+#	ifdef BS_RSNULL_EXPORTS
+#		define BS_NULL_EXPORT __declspec(dllexport)
+#	else
+#       if defined( __MINGW32__ )
+#           define BS_NULL_EXPORT
+#       else
+#    		define BS_NULL_EXPORT __declspec(dllimport)
+#       endif
+#	endif
+#elif defined ( BS_GCC_VISIBILITY )
+#    define BS_NULL_EXPORT  __attribute__ ((visibility("default")))
+#else
+#	define BS_NULL_EXPORT
+#endif
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup NullRenderAPI BansheeNullRenderAPI
+ *	Render API that doesn't talk to a GPU. All resources are kept in system memory and all rendering calls are no-ops
+ *	that only update render statistics. Useful for benchmarking the CPU side of the engine and for running on machines
+ *	without a GPU.
+ */
+
+/** @} */
+
+namespace BansheeEngine
+{
+	class NullRenderAPI;
+	class NullHardwareBuffer;
+	class NullVertexBufferCore;
+	class NullIndexBufferCore;
+	class NullGpuBufferCore;
+	class NullTextureCore;
+	class NullRenderWindow;
+	class NullRenderWindowCore;
+}
@@ -0,0 +1,136 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsRenderAPI.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Render system implementation that performs no GPU work. Resources are backed by system memory and all state changes
+	 * and draw calls are no-ops, except for updating the render statistics in the same way other render systems do.
+	 * Allows the rest of the engine to be run and profiled on machines without a GPU.
+	 */
+	class BS_NULL_EXPORT NullRenderAPI : public RenderAPICore
+	{
+	public:
+		NullRenderAPI();
+		~NullRenderAPI();
+
+		/** @copydoc RenderAPICore::getName */
+		const StringID& getName() const override;
+
+		/** @copydoc RenderAPICore::getShadingLanguageName */
+		const String& getShadingLanguageName() const override;
+
+		/** @copydoc RenderAPICore::setBlendState */
+		void setBlendState(const SPtr<BlendStateCore>& blendState) override;
+
+		/** @copydoc RenderAPICore::setRasterizerState */
+		void setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState) override;
+
+		/** @copydoc RenderAPICore::setDepthStencilState */
+		void setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) override;
+
+		/** @copydoc RenderAPICore::setSamplerState */
+		void setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) override;
+
+		/** @copydoc RenderAPICore::setTexture */
+		void setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) override;
+
+		/** @copydoc RenderAPICore::setLoadStoreTexture */
+		void setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr,
+			const TextureSurface& surface) override;
+
+		/** @copydoc RenderAPICore::beginFrame */
+		void beginFrame() override;
+
+		/** @copydoc RenderAPICore::endFrame */
+		void endFrame() override;
+
+		/** @copydoc RenderAPICore::clearRenderTarget */
+		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF) override;
+
+		/** @copydoc RenderAPICore::clearViewport */
+		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF) override;
+
+		/** @copydoc RenderAPICore::setRenderTarget */
+		void setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil = false) override;
+
+		/** @copydoc RenderAPICore::setViewport */
+		void setViewport(const Rect2& area) override;
+
+		/** @copydoc RenderAPICore::setScissorRect */
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom) override;
+
+		/** @copydoc RenderAPICore::setVertexBuffers */
+		void setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) override;
+
+		/** @copydoc RenderAPICore::setIndexBuffer */
+		void setIndexBuffer(const SPtr<IndexBufferCore>& buffer) override;
+
+		/** @copydoc RenderAPICore::setVertexDeclaration */
+		void setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration) override;
+
+		/** @copydoc RenderAPICore::setDrawOperation */
+		void setDrawOperation(DrawOperationType op) override;
+
+		/** @copydoc RenderAPICore::draw */
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0) override;
+
+		/** @copydoc RenderAPICore::drawIndexed */
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount = 0) override;
+
+		/** @copydoc RenderAPICore::dispatchCompute */
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1) override;
+
+		/** @copydoc RenderAPICore::bindGpuProgram */
+		void bindGpuProgram(const SPtr<GpuProgramCore>& prg) override;
+
+		/** @copydoc RenderAPICore::unbindGpuProgram */
+		void unbindGpuProgram(GpuProgramType gptype) override;
+
+		/** @copydoc RenderAPICore::setConstantBuffers */
+		void setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& params) override;
+
+		/** @copydoc RenderAPICore::setClipPlanesImpl */
+		void setClipPlanesImpl(const PlaneList& clipPlanes) override;
+
+		/** @copydoc RenderAPICore::convertProjectionMatrix */
+		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
+
+		/** @copydoc RenderAPICore::getAPIInfo */
+		const RenderAPIInfo& getAPIInfo() const override;
+
+		/** @copydoc RenderAPICore::generateParamBlockDesc() */
+		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override;
+
+	protected:
+		friend class NullRenderAPIFactory;
+
+		/** @copydoc RenderAPICore::initializePrepare */
+		void initializePrepare() override;
+
+		/** @copydoc RenderAPICore::initializeFinalize */
+		void initializeFinalize(const SPtr<RenderWindowCore>& primaryWindow) override;
+
+		/** @copydoc RenderAPICore::destroyCore */
+		void destroyCore() override;
+
+		/** Creates and populates a set of render system capabilities describing which functionality is available. */
+		RenderAPICapabilities* createRenderSystemCapabilities() const;
+
+	private:
+		DrawOperationType mActiveDrawOp;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,45 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsTimerQuery.h"
+#include "BsTimer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Null render API implementation of a timer query. Since no GPU work is performed the query reports CPU time elapsed
+	 * between the begin() and end() calls on the core thread.
+	 */
+	class BS_NULL_EXPORT NullTimerQuery : public TimerQuery
+	{
+	public:
+		NullTimerQuery();
+		~NullTimerQuery();
+
+		/** @copydoc TimerQuery::begin */
+		void begin() override;
+
+		/** @copydoc TimerQuery::end */
+		void end() override;
+
+		/** @copydoc TimerQuery::isReady */
+		bool isReady() const override;
+
+		/** @copydoc TimerQuery::getTimeMs */
+		float getTimeMs() override;
+
+	private:
+		Timer mTimer;
+		UINT64 mStartTime;
+		UINT64 mEndTime;
+		bool mEndIssued;
+	};
+
+	/** @} */
+}
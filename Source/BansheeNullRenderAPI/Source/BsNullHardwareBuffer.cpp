@@ -0,0 +1,59 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHardwareBuffer.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	NullHardwareBuffer::NullHardwareBuffer(GpuBufferUsage usage, UINT32 sizeInBytes, bool systemMemory)
+		:HardwareBuffer(usage, systemMemory), mData(nullptr)
+	{
+		mSizeInBytes = sizeInBytes;
+
+		if (mSizeInBytes > 0)
+		{
+			mData = (UINT8*)bs_alloc(mSizeInBytes);
+			memset(mData, 0, mSizeInBytes);
+		}
+	}
+
+	NullHardwareBuffer::~NullHardwareBuffer()
+	{
+		if (mData != nullptr)
+			bs_free(mData);
+	}
+
+	void* NullHardwareBuffer::lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options)
+	{
+		if (length > mSizeInBytes || offset > (mSizeInBytes - length))
+			BS_EXCEPT(InvalidParametersException, "Provided offset(" + toString(offset) + ") + length(" + toString(length) + ") "
+				"is larger than the buffer " + toString(mSizeInBytes) + ".");
+
+		return mData + offset;
+	}
+
+	void NullHardwareBuffer::unlockImpl()
+	{
+		// Do nothing
+	}
+
+	void NullHardwareBuffer::readData(UINT32 offset, UINT32 length, void* dest)
+	{
+		void* src = lock(offset, length, GBL_READ_ONLY);
+		memcpy(dest, src, length);
+		unlock();
+	}
+
+	void NullHardwareBuffer::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags)
+	{
+		void* dst = lock(offset, length, GBL_WRITE_ONLY);
+		memcpy(dst, source, length);
+		unlock();
+	}
+
+	void NullHardwareBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length,
+		bool discardWholeBuffer)
+	{
+		HardwareBuffer::copyData(srcBuffer, srcOffset, dstOffset, length, discardWholeBuffer);
+	}
+}
@@ -0,0 +1,14 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullMultiRenderTexture.h"
+
+namespace BansheeEngine
+{
+	NullMultiRenderTextureCore::NullMultiRenderTextureCore(const MULTI_RENDER_TEXTURE_CORE_DESC& desc)
+		:MultiRenderTextureCore(desc), mProperties(desc)
+	{ }
+
+	NullMultiRenderTexture::NullMultiRenderTexture(const MULTI_RENDER_TEXTURE_DESC& desc)
+		:MultiRenderTexture(desc), mProperties(desc)
+	{ }
+}
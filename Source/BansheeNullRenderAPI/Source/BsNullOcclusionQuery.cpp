@@ -0,0 +1,40 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullOcclusionQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullOcclusionQuery::NullOcclusionQuery(bool binary)
+		:OcclusionQuery(binary), mQueryEndCalled(false)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullOcclusionQuery::~NullOcclusionQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullOcclusionQuery::begin()
+	{
+		mQueryEndCalled = false;
+
+		setActive(true);
+	}
+
+	void NullOcclusionQuery::end()
+	{
+		mQueryEndCalled = true;
+	}
+
+	bool NullOcclusionQuery::isReady() const
+	{
+		return mQueryEndCalled;
+	}
+
+	UINT32 NullOcclusionQuery::getNumSamples()
+	{
+		return 0;
+	}
+}
@@ -0,0 +1,12 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullPrerequisites.h"
+#include "BsNullRenderAPIFactory.h"
+
+namespace BansheeEngine
+{
+	extern "C" BS_NULL_EXPORT const char* getPluginName()
+	{
+		return SystemName;
+	}
+}
@@ -0,0 +1,392 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPI.h"
+#include "BsNullTextureManager.h"
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullRenderWindowManager.h"
+#include "BsNullQueryManager.h"
+#include "BsRenderStateManager.h"
+#include "BsGpuProgramManager.h"
+#include "BsVideoModeInfo.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamDesc.h"
+#include "BsCoreThread.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	/** Number of slots of each type reported by the capabilities of the null render API. */
+	static const UINT16 NULL_NUM_SLOTS = 16;
+
+	NullRenderAPI::NullRenderAPI()
+		:mActiveDrawOp(DOT_TRIANGLE_LIST)
+	{
+		mClipPlanesDirty = false;
+	}
+
+	NullRenderAPI::~NullRenderAPI()
+	{
+
+	}
+
+	const StringID& NullRenderAPI::getName() const
+	{
+		return RenderAPINull;
+	}
+
+	const String& NullRenderAPI::getShadingLanguageName() const
+	{
+		static String strName("null");
+		return strName;
+	}
+
+	void NullRenderAPI::initializePrepare()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mVideoModeInfo = bs_shared_ptr_new<VideoModeInfo>();
+
+		TextureManager::startUp<NullTextureManager>();
+		TextureCoreManager::startUp<NullTextureCoreManager>();
+
+		HardwareBufferManager::startUp();
+		HardwareBufferCoreManager::startUp<NullHardwareBufferCoreManager>();
+
+		RenderWindowManager::startUp<NullRenderWindowManager>();
+		RenderWindowCoreManager::startUp<NullRenderWindowCoreManager>();
+
+		RenderStateCoreManager::startUp();
+
+		// No GPU program factory is registered, so programs get created by the null factory of GpuProgramCoreManager
+		mCurrentCapabilities = createRenderSystemCapabilities();
+		mCurrentCapabilities->addShaderProfile(getShadingLanguageName());
+
+		RenderAPICore::initializePrepare();
+	}
+
+	void NullRenderAPI::initializeFinalize(const SPtr<RenderWindowCore>& primaryWindow)
+	{
+		QueryManager::startUp<NullQueryManager>();
+
+		RenderAPICore::initializeFinalize(primaryWindow);
+	}
+
+	void NullRenderAPI::destroyCore()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		QueryManager::shutDown();
+
+		mActiveRenderTarget = nullptr;
+
+		RenderStateCoreManager::shutDown();
+		RenderWindowCoreManager::shutDown();
+		RenderWindowManager::shutDown();
+		HardwareBufferCoreManager::shutDown();
+		HardwareBufferManager::shutDown();
+		TextureCoreManager::shutDown();
+		TextureManager::shutDown();
+
+		RenderAPICore::destroyCore();
+	}
+
+	void NullRenderAPI::setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumSamplerBinds);
+	}
+
+	void NullRenderAPI::setBlendState(const SPtr<BlendStateCore>& blendState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumBlendStateChanges);
+	}
+
+	void NullRenderAPI::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumRasterizerStateChanges);
+	}
+
+	void NullRenderAPI::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumDepthStencilStateChanges);
+	}
+
+	void NullRenderAPI::setTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumTextureBinds);
+	}
+
+	void NullRenderAPI::setLoadStoreTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
+		const TextureSurface& surface)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumTextureBinds);
+	}
+
+	void NullRenderAPI::beginFrame()
+	{
+		// Not used
+	}
+
+	void NullRenderAPI::endFrame()
+	{
+		// Not used
+	}
+
+	void NullRenderAPI::setViewport(const Rect2& vp)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+	}
+
+	void NullRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 maxBoundVertexBuffers = mCurrentCapabilities->getMaxBoundVertexBuffers();
+		if ((index + numBuffers) > maxBoundVertexBuffers)
+			BS_EXCEPT(InvalidParametersException, "Invalid vertex index: " + toString(index) + ". Valid range is 0 .. " + toString(maxBoundVertexBuffers - 1));
+
+		BS_INC_RENDER_STAT(NumVertexBufferBinds);
+	}
+
+	void NullRenderAPI::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
+	void NullRenderAPI::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+	}
+
+	void NullRenderAPI::setDrawOperation(DrawOperationType op)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mActiveDrawOp = op;
+	}
+
+	void NullRenderAPI::bindGpuProgram(const SPtr<GpuProgramCore>& prg)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderAPICore::bindGpuProgram(prg);
+
+		BS_INC_RENDER_STAT(NumGpuProgramBinds);
+	}
+
+	void NullRenderAPI::unbindGpuProgram(GpuProgramType gptype)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderAPICore::unbindGpuProgram(gptype);
+
+		BS_INC_RENDER_STAT(NumGpuProgramBinds);
+	}
+
+	void NullRenderAPI::setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& bindableParams)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		// Still flush the parameters into their (system memory) buffers, so the CPU cost matches a real render system
+		bindableParams->updateHardwareBuffers();
+
+		const GpuParamDesc& paramDesc = bindableParams->getParamDesc();
+		for (UINT32 i = 0; i < (UINT32)paramDesc.paramBlocks.size(); i++)
+		{
+			BS_INC_RENDER_STAT(NumGpuParamBufferBinds);
+		}
+	}
+
+	void NullRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		BS_INC_RENDER_STAT(NumComputeCalls);
+	}
+
+	void NullRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+	}
+
+	void NullRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		clearRenderTarget(buffers, color, depth, stencil, targetMask);
+	}
+
+	void NullRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mActiveRenderTarget == nullptr)
+			return;
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mActiveRenderTarget = target;
+
+		BS_INC_RENDER_STAT(NumRenderTargetChanges);
+	}
+
+	void NullRenderAPI::setClipPlanesImpl(const PlaneList& clipPlanes)
+	{
+		// Do nothing
+	}
+
+	RenderAPICapabilities* NullRenderAPI::createRenderSystemCapabilities() const
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderAPICapabilities* rsc = bs_new<RenderAPICapabilities>();
+
+		rsc->setDriverVersion(mDriverVersion);
+		rsc->setDeviceName("Null");
+		rsc->setRenderAPIName(getName());
+		rsc->setVendor(GPU_UNKNOWN);
+
+		rsc->setStencilBufferBitDepth(8);
+		rsc->setMaxBoundVertexBuffers(NULL_NUM_SLOTS);
+		rsc->setNumMultiRenderTargets(8);
+
+		GpuProgramType programTypes[] = { GPT_VERTEX_PROGRAM, GPT_FRAGMENT_PROGRAM, GPT_GEOMETRY_PROGRAM,
+			GPT_HULL_PROGRAM, GPT_DOMAIN_PROGRAM, GPT_COMPUTE_PROGRAM };
+
+		UINT16 numPrograms = sizeof(programTypes) / sizeof(programTypes[0]);
+		for (UINT16 i = 0; i < numPrograms; i++)
+		{
+			rsc->setNumTextureUnits(programTypes[i], NULL_NUM_SLOTS);
+			rsc->setNumGpuParamBlockBuffers(programTypes[i], NULL_NUM_SLOTS);
+		}
+
+		rsc->setNumCombinedTextureUnits(NULL_NUM_SLOTS * numPrograms);
+		rsc->setNumCombinedGpuParamBlockBuffers(NULL_NUM_SLOTS * numPrograms);
+
+		rsc->setCapability(RSC_ANISOTROPY);
+		rsc->setCapability(RSC_AUTOMIPMAP);
+		rsc->setCapability(RSC_CUBEMAPPING);
+		rsc->setCapability(RSC_TWO_SIDED_STENCIL);
+		rsc->setCapability(RSC_STENCIL_WRAP);
+		rsc->setCapability(RSC_HWOCCLUSION);
+		rsc->setCapability(RSC_HWOCCLUSION_ASYNCHRONOUS);
+		rsc->setCapability(RSC_USER_CLIP_PLANES);
+		rsc->setCapability(RSC_VERTEX_FORMAT_UBYTE4);
+		rsc->setCapability(RSC_INFINITE_FAR_PLANE);
+		rsc->setCapability(RSC_TEXTURE_3D);
+		rsc->setCapability(RSC_NON_POWER_OF_2_TEXTURES);
+		rsc->setCapability(RSC_HWRENDER_TO_TEXTURE);
+		rsc->setCapability(RSC_TEXTURE_FLOAT);
+		rsc->setCapability(RSC_MRT_DIFFERENT_BIT_DEPTHS);
+		rsc->setCapability(RSC_VERTEX_TEXTURE_FETCH);
+		rsc->setCapability(RSC_MIPMAP_LOD_BIAS);
+
+		return rsc;
+	}
+
+	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
+	{
+		dest = matrix;
+
+		// Convert depth range from [-1,+1] to [0,1]
+		dest[2][0] = (dest[2][0] + dest[3][0]) / 2;
+		dest[2][1] = (dest[2][1] + dest[3][1]) / 2;
+		dest[2][2] = (dest[2][2] + dest[3][2]) / 2;
+		dest[2][3] = (dest[2][3] + dest[3][3]) / 2;
+	}
+
+	const RenderAPIInfo& NullRenderAPI::getAPIInfo() const
+	{
+		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, false, true, false);
+
+		return info;
+	}
+
+	GpuParamBlockDesc NullRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
+	{
+		GpuParamBlockDesc block;
+		block.blockSize = 0;
+		block.isShareable = true;
+		block.name = name;
+		block.slot = 0;
+
+		// Parameters are tightly packed, with array elements aligned to four component vectors
+		for (auto& param : params)
+		{
+			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[param.type];
+			UINT32 size = typeInfo.size / 4;
+
+			if (param.arraySize > 1)
+			{
+				UINT32 alignOffset = size % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+					size += typeInfo.baseTypeSize - alignOffset;
+
+				alignOffset = block.blockSize % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+					block.blockSize += typeInfo.baseTypeSize - alignOffset;
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size * param.arraySize;
+			}
+			else
+			{
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size;
+			}
+
+			param.paramBlockSlot = 0;
+		}
+
+		return block;
+	}
+}
@@ -0,0 +1,14 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderTexture.h"
+
+namespace BansheeEngine
+{
+	NullRenderTextureCore::NullRenderTextureCore(const RENDER_TEXTURE_CORE_DESC& desc)
+		:RenderTextureCore(desc), mProperties(desc, false)
+	{ }
+
+	NullRenderTexture::NullRenderTexture(const RENDER_TEXTURE_DESC& desc)
+		:RenderTexture(desc), mProperties(desc, false)
+	{ }
+}
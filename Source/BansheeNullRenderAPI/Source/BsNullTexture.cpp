@@ -0,0 +1,121 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTexture.h"
+#include "BsPixelUtil.h"
+#include "BsCoreThread.h"
+#include "BsRenderStats.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	NullTextureCore::NullTextureCore(TextureType textureType, UINT32 width, UINT32 height, UINT32 depth, UINT32 numMipmaps,
+		PixelFormat format, int usage, bool hwGamma, UINT32 multisampleCount, UINT32 numArraySlices,
+		const SPtr<PixelData>& initialData)
+		: TextureCore(textureType, width, height, depth, numMipmaps, format, usage, hwGamma, multisampleCount, 
+			numArraySlices, initialData)
+	{ }
+
+	NullTextureCore::~NullTextureCore()
+	{ 
+		clearBufferViews();
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		const TextureProperties& props = mProperties;
+
+		UINT32 numFaces = props.getNumFaces();
+		UINT32 numMips = props.getNumMipmaps() + 1;
+
+		mSurfaces.resize(numFaces * numMips);
+		for (UINT32 face = 0; face < numFaces; face++)
+		{
+			for (UINT32 mip = 0; mip < numMips; mip++)
+			{
+				UINT32 mipWidth, mipHeight, mipDepth;
+				PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mip,
+					mipWidth, mipHeight, mipDepth);
+
+				mSurfaces[props.mapToSubresourceIdx(face, mip)] = 
+					PixelData::create(mipWidth, mipHeight, mipDepth, props.getFormat());
+			}
+		}
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Texture);
+		TextureCore::initialize();
+	}
+
+	void NullTextureCore::copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel, 
+		const SPtr<TextureCore>& target)
+	{
+		NullTextureCore* other = static_cast<NullTextureCore*>(target.get());
+
+		PixelUtil::bulkPixelConversion(getSurface(srcFace, srcMipLevel), other->getSurface(destFace, destMipLevel));
+	}
+
+	PixelData NullTextureCore::lockImpl(GpuLockOptions options, UINT32 mipLevel, UINT32 face)
+	{
+		if (mProperties.getMultisampleCount() > 1)
+			BS_EXCEPT(InvalidStateException, "Multisampled textures cannot be accessed from the CPU directly.");
+
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+		}
+#endif
+
+		PixelData& surface = getSurface(face, mipLevel);
+
+		PixelData lockedArea(surface.getWidth(), surface.getHeight(), surface.getDepth(), surface.getFormat());
+		lockedArea.setExternalBuffer(surface.getData());
+
+		return lockedArea;
+	}
+
+	void NullTextureCore::unlockImpl()
+	{
+		// Do nothing
+	}
+
+	void NullTextureCore::readData(PixelData& dest, UINT32 mipLevel, UINT32 face)
+	{
+		if (mProperties.getMultisampleCount() > 1)
+			BS_EXCEPT(InvalidStateException, "Multisampled textures cannot be accessed from the CPU directly.");
+
+		PixelUtil::bulkPixelConversion(getSurface(face, mipLevel), dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::writeData(const PixelData& src, UINT32 mipLevel, UINT32 face, bool discardWholeBuffer)
+	{
+		if (mProperties.getMultisampleCount() > 1)
+			BS_EXCEPT(InvalidStateException, "Multisampled textures cannot be accessed from the CPU directly.");
+
+		PixelUtil::bulkPixelConversion(src, getSurface(face, mipLevel));
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+	}
+
+	PixelData& NullTextureCore::getSurface(UINT32 face, UINT32 mipLevel) const
+	{
+		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
+		if (subresourceIdx >= (UINT32)mSurfaces.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid face or mip level. Face: " + toString(face) + 
+				", mip level: " + toString(mipLevel));
+		}
+
+		return *mSurfaces[subresourceIdx];
+	}
+}
@@ -0,0 +1,57 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTextureManager.h"
+#include "BsNullTexture.h"
+#include "BsNullRenderTexture.h"
+#include "BsNullMultiRenderTexture.h"
+
+namespace BansheeEngine
+{
+	SPtr<RenderTexture> NullTextureManager::createRenderTextureImpl(const RENDER_TEXTURE_DESC& desc)
+	{
+		NullRenderTexture* tex = new (bs_alloc<NullRenderTexture>()) NullRenderTexture(desc);
+
+		return bs_core_ptr<NullRenderTexture>(tex);
+	}
+
+	SPtr<MultiRenderTexture> NullTextureManager::createMultiRenderTextureImpl(const MULTI_RENDER_TEXTURE_DESC& desc)
+	{
+		NullMultiRenderTexture* tex = new (bs_alloc<NullMultiRenderTexture>()) NullMultiRenderTexture(desc);
+
+		return bs_core_ptr<NullMultiRenderTexture>(tex);
+	}
+
+	PixelFormat NullTextureManager::getNativeFormat(TextureType ttype, PixelFormat format, int usage, bool hwGamma)
+	{
+		// All formats are stored as-is in system memory
+		return format;
+	}
+
+	SPtr<TextureCore> NullTextureCoreManager::createTextureInternal(TextureType texType, UINT32 width, UINT32 height, UINT32 depth,
+		int numMips, PixelFormat format, int usage, bool hwGammaCorrection, UINT32 multisampleCount, UINT32 numArraySlices, const SPtr<PixelData>& initialData)
+	{
+		NullTextureCore* tex = new (bs_alloc<NullTextureCore>()) NullTextureCore(texType, 
+			width, height, depth, numMips, format, usage, hwGammaCorrection, multisampleCount, numArraySlices, initialData);
+
+		SPtr<NullTextureCore> texPtr = bs_shared_ptr<NullTextureCore>(tex);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+
+	SPtr<RenderTextureCore> NullTextureCoreManager::createRenderTextureInternal(const RENDER_TEXTURE_CORE_DESC& desc)
+	{
+		SPtr<NullRenderTextureCore> texPtr = bs_shared_ptr_new<NullRenderTextureCore>(desc);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+
+	SPtr<MultiRenderTextureCore> NullTextureCoreManager::createMultiRenderTextureInternal(const MULTI_RENDER_TEXTURE_CORE_DESC& desc)
+	{
+		SPtr<NullMultiRenderTextureCore> texPtr = bs_shared_ptr_new<NullMultiRenderTextureCore>(desc);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+}
@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTimerQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullTimerQuery::NullTimerQuery()
+		:mStartTime(0), mEndTime(0), mEndIssued(false)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullTimerQuery::~NullTimerQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullTimerQuery::begin()
+	{
+		mStartTime = mTimer.getMicroseconds();
+		mEndTime = mStartTime;
+		mEndIssued = false;
+
+		setActive(true);
+	}
+
+	void NullTimerQuery::end()
+	{
+		mEndTime = mTimer.getMicroseconds();
+		mEndIssued = true;
+	}
+
+	bool NullTimerQuery::isReady() const
+	{
+		return mEndIssued;
+	}
+
+	float NullTimerQuery::getTimeMs()
+	{
+		return (mEndTime - mStartTime) / 1000.0f;
+	}
+}
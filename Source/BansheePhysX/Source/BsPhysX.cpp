@@ -19,6 +19,7 @@
 #include "BsCCollider.h"
 #include "BsFPhysXCollider.h"
 #include "BsTime.h"
+#include "BsCoreSceneManager.h"
 #include "Bsvector3.h"
 #include "BsAABox.h"
 #include "BsCapsule.h"
@@ -595,6 +596,10 @@ namespace BansheeEngine
 		}
 
 		// Note: Consider extrapolating for the remaining "simulationAmount" value
+
+		// Children of moved rigidbodies are notified of the change when the scene transforms are updated, which needs to
+		// happen while the update is still marked as in progress
+		gCoreSceneManager()._updateTransforms();
 		mUpdateInProgress = false;
 
 		triggerEvents();
@@ -4,6 +4,7 @@ set(BS_BANSHEESL_INC_NOFILTER
 	"Include/BsMMAlloc.h"
 	"Include/BsSLImporter.h"
 	"Include/BsSLFXCompiler.h"
+	"Include/BsSLFXCache.h"
 	"Include/BsIncludeHandler.h"
 	"Include/BsLexerFX.h"
 	"Include/BsParserFX.h"
@@ -14,6 +15,7 @@ set(BS_BANSHEESL_SRC_NOFILTER
 	"Source/BsASTFX.c"
 	"Source/BsSLImporter.cpp"
 	"Source/BsSLFXCompiler.cpp"
+	"Source/BsSLFXCache.cpp"
 	"Source/BsIncludeHandler.cpp"
 	"Source/BSMMAlloc.c"
 	"Source/BsLexerFX.c"
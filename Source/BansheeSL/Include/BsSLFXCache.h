@@ -0,0 +1,91 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsSLPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup BansheeSL
+	 *  @{
+	 */
+
+	/**
+	 * On-disk cache of shaders compiled by BSLFXCompiler. Allows the compiler to skip parsing and technique/pass
+	 * generation for shaders it has already seen.
+	 *
+	 * Entries are keyed by a hash of the shader source, its defines, the active render API, the engine version and the
+	 * layout of the serialized shader types. Each entry also records a hash of every include file the shader used, and the
+	 * entry is discarded if any of them changed since it was stored. Once the entries exceed the maximum cache size, the
+	 * least recently stored ones are removed.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BSLFXCache
+	{
+	public:
+		/** 
+		 * Generates a key identifying a shader compiled from the provided source and defines, with the active render API
+		 * and the current engine build.
+		 */
+		static String getKey(const String& source, const UnorderedMap<String, String>& defines);
+
+		/**
+		 * Attempts to find a previously compiled shader with the provided key. Returns null if the shader isn't in the
+		 * cache, or if any of its include files changed since it was stored. Default textures referenced by the shader
+		 * are loaded before it is returned.
+		 */
+		static SPtr<Shader> find(const String& key);
+
+		/** 
+		 * Stores a successfully compiled shader in the cache, under the provided key. If the entry cannot be written a 
+		 * warning is logged and the shader is simply not cached.
+		 */
+		static void store(const String& key, const SPtr<Shader>& shader);
+
+		/**
+		 * Sets the folder in which to store the cache entries. By default a folder in the system temporary directory is 
+		 * used. Should be called before any shaders are compiled.
+		 */
+		static void setFolder(const Path& folder);
+
+		/** Sets the maximum total size of the cache entries, in bytes. Older entries are removed when it is exceeded. */
+		static void setMaxSize(UINT64 size);
+
+	private:
+		/** Returns a hash of the current contents of an include file. Returns an empty string if the include cannot be found. */
+		static String getIncludeHash(const String& name);
+
+		/** 
+		 * Returns a description of the RTTI fields of the serialized shader types. Changes whenever a field is added,
+		 * removed or changes type, so entries written by a build with a different shader layout are never decoded.
+		 */
+		static const String& getRTTISignature();
+
+		/** Appends the fields of the provided RTTI type and all the types it references to the output stream. */
+		static void appendRTTISignature(RTTITypeBase* type, UnorderedSet<UINT32>& visited, StringStream& output);
+
+		/** 
+		 * Removes the least recently stored entries until the total size of the cache is below the maximum size. Entry
+		 * with the @p keepKey key is never removed. Caller must hold the cache mutex.
+		 */
+		static void evict(const String& keepKey);
+
+		/** Returns the folder the cache entries are stored in. */
+		static Path& getFolder();
+
+		/** Returns the maximum total size of the cache entries, in bytes. */
+		static UINT64& getMaxSize();
+
+		/** Returns the mutex used for synchronizing access to the cache files. */
+		static Mutex& getMutex();
+
+		/** Version of the cache entries. Increment to invalidate all existing entries when the compiler output changes. */
+		static const UINT32 VERSION;
+
+		/** Default maximum total size of the cache entries, in bytes. */
+		static const UINT64 DEFAULT_MAX_SIZE;
+	};
+
+	/** @} */
+}
@@ -79,6 +79,12 @@ namespace BansheeEngine
 		/** Converts the provided source into an abstract syntax tree using the lexer & parser for BSL FX syntax. */
 		static void parseFX(ParseState* parseState, const char* source);
 
+		/** 
+		 * Waits until GPU programs used by the best technique of the compiled shader finish compiling, and reports an 
+		 * error in the provided result if any of them failed. The shader in the result is cleared on failure.
+		 */
+		static void checkGpuPrograms(BSLFXCompileResult& output);
+
 		/**
 		 * Retrieves the renderer and language specified for the technique. These two values are considered a unique 
 		 * identifier for a technique.
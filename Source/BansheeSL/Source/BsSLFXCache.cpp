@@ -0,0 +1,337 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSLFXCache.h"
+#include "BsShader.h"
+#include "BsShaderManager.h"
+#include "BsShaderInclude.h"
+#include "BsRenderAPI.h"
+#include "BsFileSystem.h"
+#include "BsFileSerializer.h"
+#include "BsDataStream.h"
+#include "BsResources.h"
+#include "BsTexture.h"
+#include "BsEngineConfig.h"
+#include "BsRTTIType.h"
+#include "BsRTTIPlainField.h"
+#include "BsRTTIReflectableField.h"
+#include "BsRTTIReflectablePtrField.h"
+
+namespace BansheeEngine
+{
+	const UINT32 BSLFXCache::VERSION = 1;
+	const UINT64 BSLFXCache::DEFAULT_MAX_SIZE = 64 * 1024 * 1024;
+
+	String BSLFXCache::getKey(const String& source, const UnorderedMap<String, String>& defines)
+	{
+		// Sort the defines so the key doesn't depend on the order of the unordered map
+		Map<String, String> sortedDefines(defines.begin(), defines.end());
+
+		StringStream keyData;
+		keyData << VERSION << "\n";
+		keyData << BS_VERSION_MAJOR << "." << BS_VERSION_MINOR << "\n";
+		keyData << getRTTISignature();
+		keyData << RenderAPICore::instance().getName().cstr() << "\n";
+
+		for (auto& define : sortedDefines)
+			keyData << define.first << "=" << define.second << "\n";
+
+		keyData << source;
+
+		return md5(keyData.str());
+	}
+
+	SPtr<Shader> BSLFXCache::find(const String& key)
+	{
+		Path entryPath = getFolder();
+		entryPath.setFilename(key + ".asset");
+
+		Path depsPath = getFolder();
+		depsPath.setFilename(key + ".deps");
+
+		String deps;
+		{
+			Lock lock(getMutex());
+
+			if (!FileSystem::isFile(entryPath) || !FileSystem::isFile(depsPath))
+				return nullptr;
+
+			SPtr<DataStream> depsStream = FileSystem::openFile(depsPath);
+			deps = depsStream->getAsString();
+			depsStream->close();
+		}
+
+		// Each line contains a hash of the include's contents, followed by the include name
+		Vector<String> lines = StringUtil::split(deps, "\n");
+		for (auto& line : lines)
+		{
+			if (line.empty())
+				continue;
+
+			Vector<String> entry = StringUtil::split(line, " ", 1);
+			if (entry.size() != 2)
+				return nullptr;
+
+			if (getIncludeHash(entry[1]) != entry[0])
+				return nullptr;
+		}
+
+		SPtr<IReflectable> loadedData;
+		{
+			Lock lock(getMutex());
+
+			UnorderedMap<String, UINT64> loadParams;
+			loadParams["keepSourceData"] = 1;
+
+			FileDecoder fs(entryPath);
+			loadedData = fs.decode(loadParams);
+		}
+
+		if (loadedData == nullptr || !loadedData->isDerivedFrom(Shader::getRTTIStatic()))
+			return nullptr;
+
+		SPtr<Shader> shader = std::static_pointer_cast<Shader>(loadedData);
+
+		// Default textures are only referenced by UUID in the cache entry, make sure they are loaded like when the shader 
+		// is parsed
+		for (auto& textureParam : shader->getTextureParams())
+		{
+			UINT32 defaultValueIdx = textureParam.second.defaultValueIdx;
+			if (defaultValueIdx == (UINT32)-1)
+				continue;
+
+			HTexture defaultTexture = shader->getDefaultTexture(defaultValueIdx);
+			if (defaultTexture != nullptr && !defaultTexture.isLoaded(false))
+				gResources().loadFromUUID(defaultTexture.getUUID());
+		}
+
+		return shader;
+	}
+
+	void BSLFXCache::store(const String& key, const SPtr<Shader>& shader)
+	{
+		if (shader == nullptr)
+			return;
+
+		StringStream deps;
+		SPtr<ShaderMetaData> metaData = std::static_pointer_cast<ShaderMetaData>(shader->getMetaData());
+		if (metaData != nullptr)
+		{
+			for (auto& include : metaData->includes)
+				deps << getIncludeHash(include) << " " << include << "\n";
+		}
+
+		Path entryPath = getFolder();
+		entryPath.setFilename(key + ".asset");
+
+		Path depsPath = getFolder();
+		depsPath.setFilename(key + ".deps");
+
+		Lock lock(getMutex());
+
+		// The cache is only an optimization, failing to write to it must never fail the compilation
+		if (!FileSystem::exists(getFolder()))
+			FileSystem::createDir(getFolder());
+
+		if (!FileSystem::isDirectory(getFolder()))
+		{
+			LOGWRN("Unable to create the shader cache folder: " + getFolder().toString() + ". Shader won't be cached.");
+			return;
+		}
+
+		if (FileSystem::exists(depsPath))
+			FileSystem::remove(depsPath);
+
+		if (FileSystem::exists(entryPath))
+			FileSystem::remove(entryPath);
+
+		if (FileSystem::exists(depsPath) || FileSystem::exists(entryPath))
+		{
+			LOGWRN("Unable to replace the shader cache entry: " + entryPath.toString() + ". Shader won't be cached.");
+			return;
+		}
+
+		{
+			FileEncoder fs(entryPath);
+			fs.encode(shader.get());
+		}
+
+		if (!FileSystem::isFile(entryPath) || FileSystem::getFileSize(entryPath) == 0)
+		{
+			LOGWRN("Unable to write the shader cache entry: " + entryPath.toString() + ". Shader won't be cached.");
+
+			FileSystem::remove(entryPath);
+			return;
+		}
+
+		// Written last, so that an entry whose shader failed to write never gets found
+		SPtr<DataStream> depsStream = FileSystem::createAndOpenFile(depsPath);
+		depsStream->writeString(deps.str());
+		depsStream->close();
+
+		if (!FileSystem::isFile(depsPath))
+		{
+			LOGWRN("Unable to write the shader cache entry: " + depsPath.toString() + ". Shader won't be cached.");
+
+			FileSystem::remove(entryPath);
+			return;
+		}
+
+		evict(key);
+	}
+
+	void BSLFXCache::setFolder(const Path& folder)
+	{
+		Lock lock(getMutex());
+
+		getFolder() = folder;
+	}
+
+	void BSLFXCache::setMaxSize(UINT64 size)
+	{
+		Lock lock(getMutex());
+
+		getMaxSize() = size;
+	}
+
+	void BSLFXCache::evict(const String& keepKey)
+	{
+		struct CacheEntry
+		{
+			Path entryPath;
+			Path depsPath;
+			std::time_t storeTime;
+			UINT64 size;
+		};
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(getFolder(), files, directories);
+
+		// Dependencies are written last, so their time is the time the entry was stored
+		Vector<CacheEntry> entries;
+		UINT64 totalSize = 0;
+		for (auto& file : files)
+		{
+			if (file.getExtension() != ".deps")
+				continue;
+
+			String key = file.getFilename(false);
+			Path entryPath = file;
+			entryPath.setFilename(key + ".asset");
+
+			UINT64 size = FileSystem::getFileSize(file);
+			if (FileSystem::isFile(entryPath))
+				size += FileSystem::getFileSize(entryPath);
+
+			totalSize += size;
+
+			if (key == keepKey)
+				continue;
+
+			entries.push_back({ entryPath, file, FileSystem::getLastModifiedTime(file), size });
+		}
+
+		UINT64 maxSize = getMaxSize();
+		if (totalSize <= maxSize)
+			return;
+
+		std::sort(entries.begin(), entries.end(), 
+			[](const CacheEntry& a, const CacheEntry& b) { return a.storeTime < b.storeTime; });
+
+		for (auto& entry : entries)
+		{
+			if (totalSize <= maxSize)
+				break;
+
+			// Remove dependencies first, so a partially removed entry is never found
+			FileSystem::remove(entry.depsPath);
+
+			if (FileSystem::exists(entry.entryPath))
+				FileSystem::remove(entry.entryPath);
+
+			totalSize -= entry.size;
+		}
+	}
+
+	const String& BSLFXCache::getRTTISignature()
+	{
+		static String signature = []()
+		{
+			UnorderedSet<UINT32> visited;
+			StringStream output;
+			appendRTTISignature(Shader::getRTTIStatic(), visited, output);
+
+			return output.str();
+		}();
+
+		return signature;
+	}
+
+	void BSLFXCache::appendRTTISignature(RTTITypeBase* type, UnorderedSet<UINT32>& visited, StringStream& output)
+	{
+		if (type == nullptr || !visited.insert(type->getRTTIId()).second)
+			return;
+
+		output << type->getRTTIId() << " " << type->getRTTIName() << "\n";
+
+		Vector<RTTITypeBase*> referencedTypes;
+		UINT32 numFields = type->getNumFields();
+		for (UINT32 i = 0; i < numFields; i++)
+		{
+			RTTIField* field = type->getField(i);
+			output << field->mUniqueId << " " << field->mName << " " << (UINT32)field->mType << " " << field->isArray();
+
+			if (field->isPlainType())
+				output << " " << static_cast<RTTIPlainFieldBase*>(field)->getTypeId();
+			else if (field->isReflectableType())
+				referencedTypes.push_back(static_cast<RTTIReflectableFieldBase*>(field)->getType());
+			else if (field->isReflectablePtrType())
+				referencedTypes.push_back(static_cast<RTTIReflectablePtrFieldBase*>(field)->getType());
+
+			output << "\n";
+		}
+
+		// Fields of the base types are serialized along with the type's own
+		appendRTTISignature(type->getBaseClass(), visited, output);
+
+		// Pointer fields can hold any type derived from the field type
+		for (auto& referencedType : referencedTypes)
+		{
+			appendRTTISignature(referencedType, visited, output);
+
+			for (auto& derivedType : referencedType->getDerivedClasses())
+				appendRTTISignature(derivedType, visited, output);
+		}
+	}
+
+	String BSLFXCache::getIncludeHash(const String& name)
+	{
+		HShaderInclude include = ShaderManager::instance().findInclude(name);
+
+		if (include != nullptr)
+			include.blockUntilLoaded();
+
+		if (!include.isLoaded())
+			return "";
+
+		return md5(include->getString());
+	}
+
+	Path& BSLFXCache::getFolder()
+	{
+		static Path folder = FileSystem::getTempDirectoryPath() + Path("BansheeShaderCache/");
+		return folder;
+	}
+
+	UINT64& BSLFXCache::getMaxSize()
+	{
+		static UINT64 maxSize = DEFAULT_MAX_SIZE;
+		return maxSize;
+	}
+
+	Mutex& BSLFXCache::getMutex()
+	{
+		static Mutex mutex;
+		return mutex;
+	}
+}
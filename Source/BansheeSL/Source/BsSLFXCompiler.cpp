@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsSLFXCompiler.h"
+#include "BsSLFXCache.h"
 #include "BsGpuProgram.h"
 #include <regex>
 #include "BsShader.h"
@@ -72,6 +73,17 @@ namespace BansheeEngine
 	{
 		BSLFXCompileResult output;
 
+		String cacheKey = BSLFXCache::getKey(source, defines);
+		output.shader = BSLFXCache::find(cacheKey);
+
+		// GPU programs of cached shaders are recreated from their source, so they can still fail to compile (e.g. on a
+		// different driver)
+		if (output.shader != nullptr)
+		{
+			checkGpuPrograms(output);
+			return output;
+		}
+
 		String parsedSource = source;
 
 		ParseState* parseState = parseStateCreate();
@@ -116,55 +128,62 @@ namespace BansheeEngine
 			}
 
 			output = parseShader("Shader", parseState, codeBlocks);
+			checkGpuPrograms(output);
 
-			StringStream gpuProgError;
-			bool hasError = false;
 			if (output.shader != nullptr)
+				BSLFXCache::store(cacheKey, output.shader);
+		}
+
+		return output;
+	}
+
+	void BSLFXCompiler::checkGpuPrograms(BSLFXCompileResult& output)
+	{
+		if (output.shader == nullptr)
+			return;
+
+		StringStream gpuProgError;
+		bool hasError = false;
+
+		SPtr<Technique> bestTechnique = output.shader->getBestTechnique();
+		if (bestTechnique != nullptr)
+		{
+			UINT32 numPasses = bestTechnique->getNumPasses();
+
+			for (UINT32 i = 0; i < numPasses; i++)
 			{
-				SPtr<Technique> bestTechnique = output.shader->getBestTechnique();
+				SPtr<Pass> pass = bestTechnique->getPass(i);
 
-				if (bestTechnique != nullptr)
+				auto checkCompileStatus = [&](const String& prefix, const SPtr<GpuProgram>& prog)
 				{
-					UINT32 numPasses = bestTechnique->getNumPasses();
-
-					for (UINT32 i = 0; i < numPasses; i++)
+					if (prog != nullptr)
 					{
-						SPtr<Pass> pass = bestTechnique->getPass(i);
+						prog->blockUntilCoreInitialized();
 
-						auto checkCompileStatus = [&](const String& prefix, const SPtr<GpuProgram>& prog)
+						if (!prog->isCompiled())
 						{
-							if (prog != nullptr)
-							{
-								prog->blockUntilCoreInitialized();
-
-								if (!prog->isCompiled())
-								{
-									hasError = true;
-									gpuProgError << prefix <<": " << prog->getCompileErrorMessage() << std::endl;
-								}
-							}
-						};
-
-						checkCompileStatus("Vertex program", pass->getVertexProgram());
-						checkCompileStatus("Fragment program", pass->getFragmentProgram());
-						checkCompileStatus("Geometry program", pass->getGeometryProgram());
-						checkCompileStatus("Hull program", pass->getHullProgram());
-						checkCompileStatus("Domain program", pass->getDomainProgram());
-						checkCompileStatus("Compute program", pass->getComputeProgram());
+							hasError = true;
+							gpuProgError << prefix <<": " << prog->getCompileErrorMessage() << std::endl;
+						}
 					}
-				}
-			}
-
-			if (hasError)
-			{
-				output.shader = nullptr;
-				output.errorMessage = "Failed compiling GPU program(s): " + gpuProgError.str();
-				output.errorLine = 0;
-				output.errorColumn = 0;
+				};
+
+				checkCompileStatus("Vertex program", pass->getVertexProgram());
+				checkCompileStatus("Fragment program", pass->getFragmentProgram());
+				checkCompileStatus("Geometry program", pass->getGeometryProgram());
+				checkCompileStatus("Hull program", pass->getHullProgram());
+				checkCompileStatus("Domain program", pass->getDomainProgram());
+				checkCompileStatus("Compute program", pass->getComputeProgram());
 			}
 		}
 
-		return output;
+		if (hasError)
+		{
+			output.shader = nullptr;
+			output.errorMessage = "Failed compiling GPU program(s): " + gpuProgError.str();
+			output.errorLine = 0;
+			output.errorColumn = 0;
+		}
 	}
 
 	void BSLFXCompiler::parseFX(ParseState* parseState, const char* source)
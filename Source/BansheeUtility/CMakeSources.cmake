@@ -24,6 +24,11 @@ set(BS_BANSHEEUTILITY_SRC_WIN32
 	"Source/Win32/BsWin32CrashHandler.cpp"
 	"Source/Win32/BsWin32PlatformUtility.cpp"
 	"Source/Win32/BsWin32Window.cpp"
+	"Source/Win32/BsWin32MappedFile.cpp"
+)
+
+set(BS_BANSHEEUTILITY_SRC_UNIX
+	"Source/Unix/BsUnixMappedFile.cpp"
 )
 
 set(BS_BANSHEEUTILITY_INC_IMAGE
@@ -61,10 +66,13 @@ set(BS_BANSHEEUTILITY_INC_FILESYSTEM
 	"Include/BsFileSystem.h"
 	"Include/BsDataStream.h"
 	"Include/BsPath.h"
+	"Include/BsMappedFile.h"
+	"Include/BsAsyncFileDataStream.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_FILESYSTEM
 	"Source/BsDataStream.cpp"
+	"Source/BsAsyncFileDataStream.cpp"
 	"Source/BsPath.cpp"
 )
 
@@ -148,7 +156,9 @@ set(BS_BANSHEEUTILITY_SRC_MATH
 	"Source/BsVector3.cpp"
 	"Source/BsVector4.cpp"
 	"Source/BsBounds.cpp"
+	"Source/BsBoundsArray.cpp"
 	"Source/BsConvexVolume.cpp"
+	"Source/BsVisibilityTree.cpp"
 	"Source/BsTorus.cpp"
 	"Source/BsRect3.cpp"
 	"Source/BsRect2.cpp"
@@ -192,7 +202,9 @@ set(BS_BANSHEEUTILITY_INC_MATH
 	"Include/BsVector3.h"
 	"Include/BsVector4.h"
 	"Include/BsBounds.h"
+	"Include/BsBoundsArray.h"
 	"Include/BsConvexVolume.h"
+	"Include/BsVisibilityTree.h"
 	"Include/BsTorus.h"
 	"Include/BsLineSegment3.h"
 	"Include/BsRect3.h"
@@ -240,6 +252,7 @@ source_group("Header Files\\Threading" FILES ${BS_BANSHEEUTILITY_INC_THREADING})
 source_group("Source Files\\ThirdParty" FILES ${BS_BANSHEEUTILITY_SRC_THIRDPARTY})
 source_group("Header Files\\Prerequisites" FILES ${BS_BANSHEEUTILITY_INC_PREREQUISITES})
 source_group("Source Files\\Win32" FILES ${BS_BANSHEEUTILITY_SRC_WIN32})
+source_group("Source Files\\Unix" FILES ${BS_BANSHEEUTILITY_SRC_UNIX})
 source_group("Header Files\\Image" FILES ${BS_BANSHEEUTILITY_INC_IMAGE})
 source_group("Header Files\\String" FILES ${BS_BANSHEEUTILITY_INC_STRING})
 source_group("Source Files\\Image" FILES ${BS_BANSHEEUTILITY_SRC_IMAGE})
@@ -301,4 +314,6 @@ set(BS_BANSHEEUTILITY_SRC
 if(WIN32)
 	list(APPEND BS_BANSHEEUTILITY_SRC ${BS_BANSHEEUTILITY_SRC_WIN32})
 	list(APPEND BS_BANSHEEUTILITY_SRC ${BS_BANSHEEUTILITY_INC_WIN32})
+else()
+	list(APPEND BS_BANSHEEUTILITY_SRC ${BS_BANSHEEUTILITY_SRC_UNIX})
 endif()
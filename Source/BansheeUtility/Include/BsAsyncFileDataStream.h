@@ -0,0 +1,116 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsDataStream.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/**
+	 * File data stream that performs the file I/O on TaskScheduler worker threads, using two blocks of memory. When 
+	 * reading, the block following the one currently being consumed is read ahead of time. When writing, a filled block 
+	 * is written out while the other one is being filled. This allows large sequential reads and writes to overlap with
+	 * processing of the data.
+	 *
+	 * @note	
+	 * Stream can be opened either for reading or for writing, but not both. Seeking is supported in both modes, but
+	 * seeking outside of the two blocks currently in memory restarts the I/O, so random access is slow.
+	 * @note
+	 * Not thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncFileDataStream : public DataStream
+	{
+		/** Block of memory the file data is read into, or written from. */
+		struct Block
+		{
+			UINT8* data = nullptr;
+			size_t filePos = 0; /**< Position in the file the first byte in the block corresponds to. */
+			size_t size = 0; /**< Number of valid bytes in the block. */
+			SPtr<Task> task; /**< Task reading or writing the block, if any. */
+		};
+
+	public:
+		/**
+		 * Opens a file stream.
+		 *
+		 * @param[in]	filePath	Path of the file to open. When writing, any existing file is overwritten.
+		 * @param[in]	accessMode	Determines should the file be opened for reading or for writing.
+		 * @param[in]	blockSize	Size of a single block of memory the file is read into or written from, in bytes. 
+		 */
+		AsyncFileDataStream(const Path& filePath, AccessMode accessMode = READ, UINT32 blockSize = DEFAULT_BLOCK_SIZE);
+		~AsyncFileDataStream();
+
+		bool isFile() const override { return true; }
+
+		/** @copydoc DataStream::read */
+		size_t read(void* buf, size_t count) override;
+
+		/** @copydoc DataStream::write */
+		size_t write(const void* buf, size_t count) override;
+
+		/**
+		 * Overwrites already written data at the specified position, without changing the current position or waiting for
+		 * queued writes to complete. Useful for filling out headers whose contents are only known after the data following
+		 * them was written.
+		 *
+		 * @param[in]	pos		Position in the file to write the data to.
+		 * @param[in]	buf		Data to write.
+		 * @param[in]	count	Number of bytes to write.
+		 */
+		void writeAt(size_t pos, const void* buf, size_t count);
+
+		/** @copydoc DataStream::skip */
+		void skip(size_t count) override;
+
+		/** @copydoc DataStream::seek */
+		void seek(size_t pos) override;
+
+		/** @copydoc DataStream::tell */
+		size_t tell() const override;
+
+		/** @copydoc DataStream::eof */
+		bool eof() const override;
+
+		/** @copydoc DataStream::clone */
+		SPtr<DataStream> clone(bool copyData = true) const override;
+
+		/** @copydoc DataStream::close */
+		void close() override;
+
+		/** Returns the path of the file opened by the stream. */
+		const Path& getPath() const { return mPath; }
+
+		/** Default size of a single block of memory used for I/O, in bytes. */
+		static const UINT32 DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+	private:
+		/** Ensures the active block contains the data at the current position, reading it if needed. */
+		bool activateReadBlock();
+
+		/** Queues a read of the file data starting at @p filePos into the specified block. */
+		void queueRead(Block& block, size_t filePos);
+
+		/** Queues a write of the active block and switches to the other one. */
+		void flushWriteBlock();
+
+		/** Blocks until all queued reads and writes complete. */
+		void waitForAll();
+
+		Path mPath;
+		SPtr<FileDataStream> mFile;
+		UINT32 mBlockSize;
+
+		Block mBlocks[2];
+		UINT32 mActiveBlock;
+		size_t mPos;
+
+		SPtr<Task> mLastTask; /**< Last queued I/O task. Each task depends on the previous so the file is accessed in order. */
+	};
+
+	/** @} */
+}
@@ -0,0 +1,73 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsBounds.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Array of bounds (box and sphere pairs) stored as structure-of-arrays. Each component of each bound is stored in its
+	 * own contiguous array, which allows many bounds to be tested at once using vector instructions (for example see
+	 * ConvexVolume::intersectsBatch()).
+	 *
+	 * Internal arrays are always padded to a multiple of BATCH_SIZE so batch operations never need to handle a partial
+	 * batch. Padding entries have zero size and are positioned at the origin.
+	 */
+	class BS_UTILITY_EXPORT BoundsArray
+	{
+	public:
+		/** Number of entries processed by a single batch operation. */
+		static const UINT32 BATCH_SIZE = 4;
+
+		BoundsArray();
+
+		/** Appends new bounds at the end of the array. */
+		void add(const Bounds& bounds);
+
+		/** Overwrites bounds at the specified index. */
+		void set(UINT32 idx, const Bounds& bounds);
+
+		/** Swaps the bounds at the two provided indices. */
+		void swap(UINT32 idxA, UINT32 idxB);
+
+		/** Removes the last entry in the array. */
+		void removeLast();
+
+		/** Removes all entries from the array. */
+		void clear();
+
+		/** Returns the number of entries in the array (not counting the padding). */
+		UINT32 size() const { return mNumEntries; }
+
+		/** Returns the center of the bounding box at the specified index. */
+		Vector3 getBoxCenter(UINT32 idx) const { return Vector3(mBoxCenterX[idx], mBoxCenterY[idx], mBoxCenterZ[idx]); }
+
+	private:
+		friend class ConvexVolume;
+
+		/** Resizes the internal arrays so they can hold at least @p numEntries entries, including padding. */
+		void resize(UINT32 numEntries);
+
+		UINT32 mNumEntries;
+
+		Vector<float> mSphereX;
+		Vector<float> mSphereY;
+		Vector<float> mSphereZ;
+		Vector<float> mSphereRadius;
+
+		Vector<float> mBoxCenterX;
+		Vector<float> mBoxCenterY;
+		Vector<float> mBoxCenterZ;
+		Vector<float> mBoxExtentX;
+		Vector<float> mBoxExtentY;
+		Vector<float> mBoxExtentZ;
+	};
+
+	/** @} */
+}
@@ -4,6 +4,7 @@
 
 #include "BsPrerequisitesUtil.h"
 #include "BsPlane.h"
+#include "BsBoundsArray.h"
 
 namespace BansheeEngine
 {
@@ -30,8 +31,20 @@ namespace BansheeEngine
 		 */
 		bool intersects(const Sphere& sphere) const;
 
+		/**
+		 * Checks which of the provided bounds intersect the volume. Both the sphere and the box of each bounds entry must
+		 * intersect the volume in order for the entry to be considered intersecting. Multiple entries are tested at once
+		 * using vector instructions.
+		 *
+		 * @param[in]	bounds	Bounds to test.
+		 * @param[out]	output	Bitmask with one bit per entry in @p bounds. Bit is set if the entry intersects the volume.
+		 *						Bit for entry @p i is located at output[i / 32] & (1 << (i % 32)). Vector will be resized
+		 *						as needed.
+		 */
+		void intersectsBatch(const BoundsArray& bounds, Vector<UINT32>& output) const;
+
 		/** Returns the internal set of planes that represent the volume. */
-		Vector<Plane> getPlanes() const { return mPlanes; }
+		const Vector<Plane>& getPlanes() const { return mPlanes; }
 
 	private:
 		Vector<Plane> mPlanes;
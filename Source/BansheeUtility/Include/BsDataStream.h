@@ -50,6 +50,13 @@ namespace BansheeEngine
 		virtual bool isWriteable() const { return (mAccess & WRITE) != 0; }
 		virtual bool isFile() const = 0;
 
+		/** 
+		 * Returns the memory mapped file the stream reads from, or null if the stream doesn't read from a mapped file. 
+		 * Only MappedFileDataStream reads from mapped files, and data it reads may be referenced directly for as long as
+		 * a reference to the mapped file is kept.
+		 */
+		virtual SPtr<MappedFile> getMappedFile() const { return nullptr; }
+
         /** Reads data from the buffer and copies it to the specified value. */
         template<typename T> DataStream& operator>>(T& val);
 
@@ -13,7 +13,14 @@ namespace BansheeEngine
 	// TODO - Low priority. Eventually I'll want to generalize BinarySerializer to Serializer class, then I can make this class accept
 	// a generic Serializer interface so it may write both binary, plain-text or some other form of data.
 
-	/** Encodes the provided object to the specified file using the RTTI system. */
+	/** 
+	 * Encodes the provided object to the specified file using the RTTI system. 
+	 *
+	 * File starts with a header identifying the format, followed by the encoded objects. Each object is prefixed with its
+	 * 64-bit size and a CRC32 checksum of its data. Objects are written in small chunks as they are being encoded, and the
+	 * size and checksum are filled out once the object is done. The file is written on worker threads through 
+	 * AsyncFileDataStream, so writing overlaps with encoding.
+	 */
 	class BS_UTILITY_EXPORT FileEncoder
 	{
 	public:
@@ -27,6 +34,8 @@ namespace BansheeEngine
 		 * @param[in]	object		Object to encode.
 		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
 		 *							serialized.
+		 *
+		 * @note	Objects larger than 4 GB are not supported by the binary serializer, and will throw an exception.
 		 */
 		void encode(IReflectable* object, const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
 
@@ -34,17 +43,40 @@ namespace BansheeEngine
 		/** Called by the binary serializer whenever the buffer gets full. */
 		UINT8* flushBuffer(UINT8* bufferStart, UINT32 bytesWritten, UINT32& newBufferSize);
 
-		std::ofstream mOutputStream;
+		SPtr<AsyncFileDataStream> mOutputStream;
 		UINT8* mWriteBuffer;
+		UINT64 mObjectSize;
+		UINT32 mChecksum;
 
 		static const UINT32 WRITE_BUFFER_SIZE = 2048;
 	};
 
-	/** Decodes objects from the specified file using the RTTI system. */
+	/** 
+	 * Decodes objects from the specified file using the RTTI system. Supports files written by FileEncoder, as well as 
+	 * files written in the older format with 32-bit object sizes and no checksums.
+	 */
 	class BS_UTILITY_EXPORT FileDecoder
 	{
 	public:
-		FileDecoder(const Path& fileLocation);
+		/**
+		 * Opens the file for decoding. Large files are read on worker threads through AsyncFileDataStream, so reading 
+		 * overlaps with decoding.
+		 *
+		 * @param[in]	fileLocation		Path to the file to decode.
+		 * @param[in]	verifyChecksums		If true, checksum of each object is verified before it is decoded, and objects
+		 *									with invalid checksums are not decoded. This requires the object data to be
+		 *									read twice, so it is off by default. Files in the older format have no 
+		 *									checksums and are never verified.
+		 */
+		FileDecoder(const Path& fileLocation, bool verifyChecksums = false);
+
+		/** 
+		 * Decodes objects from an already open stream, starting at its current position. The stream is expected to
+		 * contain data in the same format as files written by FileEncoder.
+		 *
+		 * @see	FileDecoder(const Path&, bool)
+		 */
+		FileDecoder(const SPtr<DataStream>& stream, bool verifyChecksums = false);
 
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
@@ -58,7 +90,18 @@ namespace BansheeEngine
 		void skip();
 
 	private:
+		/** Detects the format of the data in the stream and reads the header if present. */
+		void readHeader();
+
+		/** Reads the size and checksum of the next object. Returns false if there are no more objects. */
+		bool readObjectHeader(UINT64& size, UINT32& checksum);
+
+		/** Checks that the data of the next @p size bytes matches the checksum. Stream position is left unchanged. */
+		bool verifyChecksum(UINT64 size, UINT32 checksum);
+
 		SPtr<DataStream> mInputStream;
+		UINT32 mVersion;
+		bool mVerifyChecksums;
 	};
 
 	/** @} */
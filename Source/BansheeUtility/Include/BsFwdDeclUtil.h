@@ -61,7 +61,9 @@ namespace BansheeEngine
 	class DynLibManager;
 	class DataStream;
 	class MemoryDataStream;
+	class MappedFile;
 	class FileDataStream;
+	class AsyncFileDataStream;
 	class MeshData;
 	class FileSystem;
 	class Timer;
@@ -0,0 +1,81 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsDataStream.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/** 
+	 * Read-only view of a file mapped into the process address space. File contents are paged in by the OS on first
+	 * access, without any explicit reads or intermediate buffers. The mapping stays valid for as long as the object is
+	 * alive.
+	 *
+	 * @note	
+	 * Pages are mapped copy-on-write, so code that received a pointer into the mapping may modify the data. The first
+	 * write to a page gives the process its own copy of that page, and the file itself is never modified.
+	 */
+	class BS_UTILITY_EXPORT MappedFile
+	{
+		struct PrivatelyConstruct {};
+
+	public:
+		MappedFile(const PrivatelyConstruct& dummy);
+		~MappedFile();
+
+		/** 
+		 * Maps the file at the specified path into memory. 
+		 *
+		 * @param[in]	fullPath	Full path to the file.
+		 * @return					Mapped file, or null if the file doesn't exist or couldn't be mapped.
+		 */
+		static SPtr<MappedFile> open(const Path& fullPath);
+
+		/** Returns a pointer to the start of the mapped file contents. */
+		const UINT8* getData() const { return mData; }
+
+		/** Returns the size of the mapped file, in bytes. */
+		UINT64 getSize() const { return mSize; }
+
+	private:
+		const UINT8* mData;
+		UINT64 mSize;
+
+		void* mFileHandle; /**< Platform specific handle of the mapped file, if the platform requires it to stay open. */
+		void* mMappingHandle; /**< Platform specific handle of the mapping object, if the platform uses one. */
+	};
+
+	/** 
+	 * Stream reading a range of a mapped file directly from the mapped memory. Keeps the file mapped for as long as the
+	 * stream is alive.
+	 */
+	class BS_UTILITY_EXPORT MappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		/**
+		 * Creates a stream reading from the mapped file.
+		 *
+		 * @param[in]	file	Mapped file to read from.
+		 * @param[in]	offset	Offset of the range to read, from the start of the file, in bytes.
+		 * @param[in]	size	Size of the range to read, in bytes. Range must be contained within the file.
+		 */
+		MappedFileDataStream(const SPtr<MappedFile>& file, UINT64 offset, UINT64 size)
+			:MemoryDataStream(const_cast<UINT8*>(file->getData()) + offset, (size_t)size, false), mFile(file)
+		{ 
+			mAccess = READ;
+		}
+
+		/** @copydoc DataStream::getMappedFile */
+		SPtr<MappedFile> getMappedFile() const override { return mFile; }
+
+	private:
+		SPtr<MappedFile> mFile;
+	};
+
+	/** @} */
+}
@@ -223,6 +223,17 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
+	/**
+	 * Information about a field used during serialization. Computed once when the field is registered, so it doesn't need
+	 * to be queried through virtual calls for every serialized object.
+	 */
+	struct RTTIFieldInfo
+	{
+		RTTIField* field;
+		UINT32 typeSize; /**< Size of a single element of the field. Only relevant if field doesn't have dynamic size. */
+		bool hasDynamicSize;
+	};
+
 	/**
 	 * Provides an interface for accessing fields of a certain class.
 	 * Data can be easily accessed by getter and setter methods.
@@ -624,6 +635,22 @@ namespace BansheeEngine
 		 *  @{
 		 */
 
+		/** Returns serialization information for a field based on the field index. */
+		const RTTIFieldInfo& _getFieldInfo(UINT32 idx) const { return mFieldInfos[idx]; }
+
+		/** Returns serialization information for a field with the specified unique ID, or null if it cannot be found. */
+		const RTTIFieldInfo* _findFieldInfo(int uniqueFieldId) const
+		{
+			if (uniqueFieldId < 0 || uniqueFieldId >= (int)mFieldIdxById.size())
+				return nullptr;
+
+			UINT16 fieldIdx = mFieldIdxById[uniqueFieldId];
+			if (fieldIdx == INVALID_FIELD_IDX)
+				return nullptr;
+
+			return &mFieldInfos[fieldIdx];
+		}
+
 		/** Called by the RTTI system when a class is first found in order to form child/parent class hierarchy. */
 		virtual void _registerDerivedClass(RTTITypeBase* derivedClass) = 0;
 
@@ -639,7 +666,11 @@ namespace BansheeEngine
 		void addNewField(RTTIField* field);
 
 	private:
+		static const UINT16 INVALID_FIELD_IDX = 0xFFFF;
+
 		Vector<RTTIField*> mFields;
+		Vector<RTTIFieldInfo> mFieldInfos;
+		Vector<UINT16> mFieldIdxById; /**< Maps unique field IDs to field indices, for constant time lookup. */
 	};
 
 	/** Used for initializing a certain type as soon as the program is loaded. */
@@ -5,6 +5,7 @@
 #include "BsPrerequisitesUtil.h"
 #include "BsModule.h"
 #include "BsThreadPool.h"
+#include "BsSpinLock.h"
 
 namespace BansheeEngine
 {
@@ -25,7 +26,7 @@ namespace BansheeEngine
 
 	/**
 	 * Represents a single task that may be queued in the TaskScheduler.
-	 * 			
+	 *
 	 * @note	Thread safe.
 	 */
 	class BS_UTILITY_EXPORT Task
@@ -33,7 +34,7 @@ namespace BansheeEngine
 		struct PrivatelyConstruct {};
 
 	public:
-		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
+		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
 			TaskPriority priority, SPtr<Task> dependency);
 
 		/**
@@ -45,7 +46,7 @@ namespace BansheeEngine
 		 * @param[in]	dependency	(optional) Task dependency if one exists. If provided the task will
 		 * 							not be executed until its dependency is complete.
 		 */
-		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, TaskPriority priority = TaskPriority::Normal, 
+		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, TaskPriority priority = TaskPriority::Normal,
 			SPtr<Task> dependency = nullptr);
 
 		/** Returns true if the task has completed. */
@@ -55,80 +56,181 @@ namespace BansheeEngine
 		bool isCanceled() const;
 
 		/**
-		 * Blocks the current thread until the task has completed. 
-		 * 
-		 * @note	While waiting adds a new worker thread, so that the blocking threads core can be utilized.
+		 * Blocks the current thread until the task has completed.
+		 *
+		 * @note	
+		 * When called from a thread that isn't a worker, one more of the already created workers is allowed to execute
+		 * tasks while waiting, so the blocked thread's core can be utilized. The number of running workers never exceeds
+		 * the number of workers created at startup. When called from a worker, the worker executes queued tasks while 
+		 * waiting instead.
 		 */
 		void wait();
 
 		/** Cancels the task and removes it from the TaskSchedulers queue. */
 		void cancel();
 
+		/** Returns the name the task was created with. */
+		const String& getName() const { return mName; }
+
 	private:
 		friend class TaskScheduler;
 
 		String mName;
 		TaskPriority mPriority;
-		UINT32 mTaskId;
 		std::function<void()> mTaskWorker;
 		SPtr<Task> mTaskDependency;
 		std::atomic<UINT32> mState; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 
+		SpinLock mDependantsLock;
+		Vector<SPtr<Task>> mDependants; /**< Tasks waiting on this task to complete before they can be queued. */
+
 		TaskScheduler* mParent;
 	};
 
 	/**
 	 * Represents a task scheduler running on multiple threads. You may queue tasks on it from any thread and they will be
 	 * executed in user specified order on any available thread.
-	 * 			
-	 * @note	
+	 *
+	 * @note
 	 * Thread safe.
 	 * @note
-	 * This type of task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks 
-	 * in the order of hundreds. Higher number of tasks might require different queuing and locking mechanism, potentially 
-	 * at the cost of flexibility.)
+	 * Each worker thread has its own set of queues (one per priority). Tasks queued from a worker thread go into that
+	 * worker's queues, while tasks queued from other threads are distributed between the workers. Workers that run out of
+	 * work steal it from other workers. Higher priority tasks are always picked before lower priority ones within a queue
+	 * and when stealing, but there is no strict global ordering between tasks queued on different workers.
+	 * @note
+	 * Tasks with dependencies are not queued until their dependency completes, so they cost nothing while waiting.
+	 * @note
+	 * For large numbers of small jobs use parallelFor(), which avoids allocating a Task for each job.
+	 * @note
+	 * The task scheduler creates as many worker threads as there are hardware threads, up to a maximum of 64. Each
+	 * worker permanently holds a ThreadPool thread. You may change how many of them are active using
+	 * addWorker()/removeWorker() methods.
 	 * @note
-	 * By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
-	 * threads using addWorker()/removeWorker() methods.
+	 * Any jobs still queued when the scheduler shuts down are executed on the thread shutting it down.
 	 */
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
+		/** Maximum number of worker threads the scheduler can create. */
+		static const UINT32 MAX_WORKERS = 64;
+
+		/** Number of different values in TaskPriority. */
+		static const UINT32 NUM_PRIORITIES = 5;
+
+		/** Shared state of a single parallelFor() call. */
+		struct ParallelForData
+		{
+			std::atomic<UINT32> nextChunk;
+			std::atomic<UINT32> numCompletedChunks;
+			std::atomic<UINT32> refCount;
+			UINT32 numChunks;
+			UINT32 begin;
+			UINT32 end;
+			UINT32 grain;
+			const std::function<void(UINT32, UINT32)>* worker;
+		};
+
+		/** Single entry in a worker queue. Contains either a task, or a helper job of a parallelFor() call. */
+		struct Job
+		{
+			SPtr<Task> task;
+			ParallelForData* parallelFor = nullptr;
+		};
+
+		/** Set of job queues belonging to a single worker thread. */
+		struct WorkerQueue
+		{
+			SpinLock lock;
+			Deque<Job> jobs[NUM_PRIORITIES];
+		};
+
 	public:
+		/** Signature of a method notified when a worker starts or finishes executing a task. */
+		typedef void(*TaskCallback)(const Task& task);
+
 		TaskScheduler();
 		~TaskScheduler();
 
 		/** Queues a new task. */
 		void addTask(const SPtr<Task>& task);
 
-		/**	Adds a new worker thread which will be used for executing queued tasks. */
+		/**
+		 * Executes @p worker over the range [@p begin, @p end), split into chunks of @p grain elements. Chunks are
+		 * distributed between the calling thread and any available worker threads. Blocks until all chunks are complete.
+		 *
+		 * @param[in]	begin		First element of the range.
+		 * @param[in]	end			One past the last element of the range.
+		 * @param[in]	grain		Number of elements per chunk. Should be large enough so that processing a chunk is
+		 *							notably more expensive than an atomic increment.
+		 * @param[in]	worker		Method to call for each chunk. Receives the start and one past the end of the chunk.
+		 * @param[in]	priority	Priority of the jobs queued on the worker threads.
+		 *
+		 * @note	Since the calling thread always participates, this is safe to call even when no workers are available.
+		 */
+		void parallelFor(UINT32 begin, UINT32 end, UINT32 grain, const std::function<void(UINT32, UINT32)>& worker,
+			TaskPriority priority = TaskPriority::High);
+
+		/**
+		 * Allows one more worker thread to execute queued tasks. Worker threads are all created when the scheduler starts
+		 * (one per hardware thread), so this never creates a new thread and has no effect once all workers are active.
+		 */
 		void addWorker();
 
-		/**	Removes a worker thread (as soon as its current task is finished). */
+		/**	Stops a worker thread from executing queued tasks (as soon as its current task is finished). */
 		void removeWorker();
 
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
-		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+		UINT32 getNumWorkers() const { return std::min(mMaxActiveTasks.load(), mNumWorkers.load()); }
+
+		/**
+		 * Registers methods that get called on the executing thread right before and right after a task runs. Meant for
+		 * profiling tools that need to know what the workers are busy with. Provide null to remove the callbacks.
+		 */
+		void setTaskCallbacks(TaskCallback onStarted, TaskCallback onFinished);
 	protected:
 		friend class Task;
 
-		/**	Main task scheduler method that dispatches tasks to other threads. */
-		void runMain();
+		/**	Main method of a worker thread. Executes jobs from its own queue, or steals them from other workers. */
+		void runWorker(UINT32 workerIdx);
 
-		/**	Worker method that runs a single task. */
-		void runTask(SPtr<Task> task);
+		/** Creates a new worker thread along with its queue. Only called during construction. */
+		void spawnWorker();
 
-		/**	Blocks the calling thread until the specified task has completed. */
-		void waitUntilComplete(const Task* task);
+		/** Pushes a job to the queue of the current worker thread, or to one of the worker queues if not on a worker. */
+		void queueJob(Job job, TaskPriority priority);
+
+		/** Retrieves the highest priority job from the worker's own queue, or steals one from other workers. */
+		bool popJob(UINT32 workerIdx, Job& job);
 
-		/**	Method used for sorting tasks. */
-		static bool taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs);
+		/** Executes a job retrieved through popJob(). */
+		void executeJob(Job& job);
 
-		HThread mTaskSchedulerThread;
-		Set<SPtr<Task>, std::function<bool(const SPtr<Task>&, const SPtr<Task>&)>> mTaskQueue;
-		Vector<SPtr<Task>> mActiveTasks;
-		UINT32 mMaxActiveTasks;
-		UINT32 mNextTaskId;
-		bool mShutdown;
+		/**	Marks the task as complete, wakes up anyone waiting on it and queues any tasks depending on it. */
+		void completeTask(const SPtr<Task>& task);
+
+		/**
+		 * Blocks the calling thread until the specified task has completed. If called from a worker thread, the worker
+		 * executes other queued jobs while waiting.
+		 */
+		void waitUntilComplete(const Task* task);
+
+		/**
+		 * Executes chunks of a parallelFor() call until none remain, then releases the reference to @p data held by the
+		 * caller.
+		 */
+		void executeChunks(ParallelForData* data);
+
+		WorkerQueue* mWorkers[MAX_WORKERS];
+		Vector<HThread> mWorkerThreads;
+		std::atomic<UINT32> mNumWorkers;
+		std::atomic<UINT32> mMaxActiveTasks;
+		std::atomic<UINT32> mNumQueuedJobs;
+		std::atomic<UINT32> mNumSleeping;
+		std::atomic<UINT32> mNumWaiters;
+		std::atomic<UINT32> mNextQueue;
+		std::atomic<bool> mShutdown;
+		std::atomic<TaskCallback> mTaskStartedCallback;
+		std::atomic<TaskCallback> mTaskFinishedCallback;
 
 		Mutex mReadyMutex;
 		Mutex mCompleteMutex;
@@ -137,4 +239,4 @@ namespace BansheeEngine
 	};
 
 	/** @} */
-}
\ No newline at end of file
+}
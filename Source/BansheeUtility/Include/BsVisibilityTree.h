@@ -0,0 +1,118 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsAABox.h"
+#include "BsConvexVolume.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Dynamic bounding volume hierarchy used for accelerating visibility queries. Each leaf holds a user provided
+	 * identifier, an axis aligned box and a layer mask. Leaves are inserted, updated and removed incrementally and the
+	 * tree is kept balanced using tree rotations, ensuring queries run in roughly logarithmic time in the number of
+	 * leaves.
+	 *
+	 * Leaf boxes are slightly enlarged compared to the provided bounds so that objects moving by small amounts don't
+	 * require the tree to be restructured.
+	 */
+	class BS_UTILITY_EXPORT VisibilityTree
+	{
+		/** A single node in the tree. Leaf nodes have no children. */
+		struct Node
+		{
+			bool isLeaf() const { return children[0] == NULL_NODE; }
+
+			AABox bounds;
+			UINT64 layers;
+			UINT32 parent; /**< Parent node index, or next free node index if the node is unused. */
+			UINT32 children[2];
+			INT32 height; /**< Height of the node's subtree. 0 for leaves, -1 for unused nodes. */
+			UINT32 id; /**< User provided identifier, only relevant for leaves. */
+		};
+
+	public:
+		/** Index signifying a non-existing node. */
+		static const UINT32 NULL_NODE = (UINT32)-1;
+
+		VisibilityTree();
+
+		/**
+		 * Inserts a new leaf in the tree.
+		 *
+		 * @param[in]	id		Identifier that will be returned by queries when the leaf is found.
+		 * @param[in]	bounds	Bounds of the object represented by the leaf.
+		 * @param[in]	layers	Layer mask of the object represented by the leaf.
+		 * @return				Handle to the leaf, that can be used for updating and removing the leaf.
+		 */
+		UINT32 add(UINT32 id, const AABox& bounds, UINT64 layers);
+
+		/** Updates the bounds of a leaf previously created with add(). */
+		void update(UINT32 leaf, const AABox& bounds);
+
+		/** Removes a leaf previously created with add(). */
+		void remove(UINT32 leaf);
+
+		/** Changes the identifier stored in a leaf previously created with add(). */
+		void setId(UINT32 leaf, UINT32 id) { mNodes[leaf].id = id; }
+
+		/** Removes all leaves from the tree. */
+		void clear();
+
+		/**
+		 * Finds all leaves whose bounds intersect the provided volume and have at least one layer bit in common with
+		 * @p layers.
+		 *
+		 * @param[in]	volume			Volume to test the leaves against.
+		 * @param[in]	layers			Layer mask the leaves need to match.
+		 * @param[out]	inside			Identifiers of leaves which are fully contained within the volume.
+		 * @param[out]	intersecting	Identifiers of leaves which only partially intersect the volume. Objects
+		 *								represented by those leaves might still not intersect the volume, as the leaf
+		 *								bounds are conservative and the caller should perform a more precise test.
+		 * @param[in]	scratch			Buffer used for traversing the tree. Its contents are overwritten. Should be kept
+		 *								between queries so they don't need to allocate, and must not be shared between
+		 *								queries running at the same time.
+		 */
+		void query(const ConvexVolume& volume, UINT64 layers, Vector<UINT32>& inside, Vector<UINT32>& intersecting,
+			Vector<UINT32>& scratch) const;
+
+	private:
+		/** Returns an unused node, expanding the node array if needed. */
+		UINT32 allocateNode();
+
+		/** Returns a node back to the free list. */
+		void freeNode(UINT32 node);
+
+		/** Inserts a leaf into the tree hierarchy, attaching it next to the cheapest sibling. */
+		void insertLeaf(UINT32 leaf);
+
+		/** Detaches a leaf from the tree hierarchy. Leaf node itself is not freed. */
+		void removeLeaf(UINT32 leaf);
+
+		/** Walks from the provided node up to the root, re-balancing and refitting bounds and layers of the nodes. */
+		void refitAncestors(UINT32 node);
+
+		/** Performs a tree rotation around the provided node if its subtree is imbalanced. Returns new subtree root. */
+		UINT32 balance(UINT32 node);
+
+		/** Returns a bounding box that contains both of the provided boxes. */
+		static AABox merge(const AABox& a, const AABox& b);
+
+		/** Returns the surface area of the provided box. */
+		static float getArea(const AABox& box);
+
+		/** Checks if box @p outer fully contains box @p inner. */
+		static bool contains(const AABox& outer, const AABox& inner);
+
+		Vector<Node> mNodes;
+		UINT32 mRoot;
+		UINT32 mFreeList;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,285 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAsyncFileDataStream.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	AsyncFileDataStream::AsyncFileDataStream(const Path& filePath, AccessMode accessMode, UINT32 blockSize)
+		:DataStream(accessMode), mPath(filePath), mBlockSize(blockSize), mActiveBlock(0), mPos(0)
+	{
+		assert(accessMode == READ || accessMode == WRITE);
+
+		mFile = bs_shared_ptr_new<FileDataStream>(filePath, accessMode, true);
+		if (accessMode == READ)
+			mSize = mFile->size();
+
+		for (auto& block : mBlocks)
+			block.data = (UINT8*)bs_alloc(mBlockSize);
+
+		if (isReadable())
+		{
+			// Start reading the first two blocks right away
+			queueRead(mBlocks[0], 0);
+			queueRead(mBlocks[1], mBlockSize);
+		}
+	}
+
+	AsyncFileDataStream::~AsyncFileDataStream()
+	{
+		close();
+	}
+
+	size_t AsyncFileDataStream::read(void* buf, size_t count)
+	{
+		if (!isReadable() || mFile == nullptr)
+			return 0;
+
+		UINT8* dst = (UINT8*)buf;
+		size_t numRead = 0;
+		while (numRead < count && mPos < mSize)
+		{
+			if (!activateReadBlock())
+				break;
+
+			const Block& block = mBlocks[mActiveBlock];
+			size_t blockOffset = mPos - block.filePos;
+			size_t toCopy = std::min(count - numRead, block.size - blockOffset);
+
+			memcpy(dst + numRead, block.data + blockOffset, toCopy);
+			numRead += toCopy;
+			mPos += toCopy;
+		}
+
+		return numRead;
+	}
+
+	size_t AsyncFileDataStream::write(const void* buf, size_t count)
+	{
+		if (!isWriteable() || mFile == nullptr)
+			return 0;
+
+		const UINT8* src = (const UINT8*)buf;
+		size_t numWritten = 0;
+		while (numWritten < count)
+		{
+			Block& block = mBlocks[mActiveBlock];
+			if (block.size == mBlockSize)
+			{
+				flushWriteBlock();
+				continue;
+			}
+
+			size_t toCopy = std::min(count - numWritten, (size_t)mBlockSize - block.size);
+			memcpy(block.data + block.size, src + numWritten, toCopy);
+
+			block.size += toCopy;
+			numWritten += toCopy;
+			mPos += toCopy;
+		}
+
+		mSize = std::max(mSize, mPos);
+		return numWritten;
+	}
+
+	void AsyncFileDataStream::writeAt(size_t pos, const void* buf, size_t count)
+	{
+		if (!isWriteable() || mFile == nullptr || count == 0)
+			return;
+
+		// Patch any part of the range that's still in the active block, as the block will be written later
+		const UINT8* src = (const UINT8*)buf;
+		Block& block = mBlocks[mActiveBlock];
+
+		size_t blockEnd = block.filePos + block.size;
+		size_t overlapStart = std::max(pos, block.filePos);
+		size_t overlapEnd = std::min(pos + count, blockEnd);
+		if (overlapStart < overlapEnd)
+			memcpy(block.data + (overlapStart - block.filePos), src + (overlapStart - pos), overlapEnd - overlapStart);
+
+		if (pos >= block.filePos && (pos + count) <= blockEnd)
+			return;
+
+		// Rest of the range was already queued for writing, so write it after all the queued writes complete. Data is 
+		// copied since the caller's buffer won't be around by the time the write executes.
+		SPtr<FileDataStream> file = mFile;
+		auto data = bs_shared_ptr_new<Vector<UINT8>>(src, src + count);
+
+		mLastTask = Task::create("AsyncFileWrite", [file, data, pos]()
+		{
+			file->seek(pos);
+			file->write(data->data(), data->size());
+		}, TaskPriority::High, mLastTask);
+
+		TaskScheduler::instance().addTask(mLastTask);
+	}
+
+	void AsyncFileDataStream::skip(size_t count)
+	{
+		seek(mPos + count);
+	}
+
+	void AsyncFileDataStream::seek(size_t pos)
+	{
+		if (mFile == nullptr || pos == mPos)
+			return;
+
+		if (isWriteable())
+		{
+			// Write out everything written so far, and start a new block at the new position
+			flushWriteBlock();
+			waitForAll();
+
+			mBlocks[mActiveBlock].filePos = pos;
+		}
+
+		// When reading, data is read on the next read() call, potentially from the blocks already in memory
+		mPos = pos;
+	}
+
+	size_t AsyncFileDataStream::tell() const
+	{
+		return mPos;
+	}
+
+	bool AsyncFileDataStream::eof() const
+	{
+		return mPos >= mSize;
+	}
+
+	SPtr<DataStream> AsyncFileDataStream::clone(bool copyData) const
+	{
+		return bs_shared_ptr_new<AsyncFileDataStream>(mPath, (AccessMode)getAccessMode(), mBlockSize);
+	}
+
+	void AsyncFileDataStream::close()
+	{
+		if (mFile == nullptr)
+			return;
+
+		if (isWriteable())
+			flushWriteBlock();
+
+		waitForAll();
+
+		for (auto& block : mBlocks)
+		{
+			bs_free(block.data);
+			block.data = nullptr;
+			block.task = nullptr;
+		}
+
+		mFile->close();
+		mFile = nullptr;
+	}
+
+	bool AsyncFileDataStream::activateReadBlock()
+	{
+		Block* active = &mBlocks[mActiveBlock];
+		if (mPos < active->filePos || mPos >= active->filePos + active->size)
+		{
+			UINT32 nextBlockIdx = mActiveBlock ^ 1;
+			Block& next = mBlocks[nextBlockIdx];
+
+			if (mPos >= next.filePos && mPos < next.filePos + next.size)
+			{
+				// Sequential access, move to the block read ahead of time and start reading ahead into the current one
+				mActiveBlock = nextBlockIdx;
+				queueRead(*active, next.filePos + next.size);
+			}
+			else
+			{
+				// Random access, restart reading from the new position
+				waitForAll();
+
+				queueRead(mBlocks[mActiveBlock], mPos);
+				queueRead(mBlocks[nextBlockIdx], mPos + mBlocks[mActiveBlock].size);
+			}
+
+			active = &mBlocks[mActiveBlock];
+		}
+
+		if (active->task != nullptr)
+		{
+			active->task->wait();
+			active->task = nullptr;
+		}
+
+		return active->size > 0;
+	}
+
+	void AsyncFileDataStream::queueRead(Block& block, size_t filePos)
+	{
+		// Any previous read into this block must be done before the memory is reused
+		if (block.task != nullptr)
+			block.task->wait();
+
+		block.filePos = filePos;
+		block.size = filePos < mSize ? std::min((size_t)mBlockSize, mSize - filePos) : 0;
+		block.task = nullptr;
+
+		if (block.size == 0)
+			return;
+
+		SPtr<FileDataStream> file = mFile;
+		UINT8* data = block.data;
+		size_t size = block.size;
+
+		block.task = Task::create("AsyncFileRead", [file, data, filePos, size]()
+		{
+			file->seek(filePos);
+			file->read(data, size);
+		}, TaskPriority::High, mLastTask);
+
+		mLastTask = block.task;
+		TaskScheduler::instance().addTask(block.task);
+	}
+
+	void AsyncFileDataStream::flushWriteBlock()
+	{
+		Block& block = mBlocks[mActiveBlock];
+		if (block.size > 0)
+		{
+			SPtr<FileDataStream> file = mFile;
+			UINT8* data = block.data;
+			size_t filePos = block.filePos;
+			size_t size = block.size;
+
+			block.task = Task::create("AsyncFileWrite", [file, data, filePos, size]()
+			{
+				file->seek(filePos);
+				file->write(data, size);
+			}, TaskPriority::High, mLastTask);
+
+			mLastTask = block.task;
+			TaskScheduler::instance().addTask(block.task);
+		}
+
+		size_t nextFilePos = block.filePos + block.size;
+		mActiveBlock ^= 1;
+
+		// Previous write from the block we're switching to must be done before the memory is reused
+		Block& next = mBlocks[mActiveBlock];
+		if (next.task != nullptr)
+		{
+			next.task->wait();
+			next.task = nullptr;
+		}
+
+		next.filePos = nextFilePos;
+		next.size = 0;
+	}
+
+	void AsyncFileDataStream::waitForAll()
+	{
+		// Tasks execute in order, so the last one completing means all of them have
+		if (mLastTask != nullptr)
+		{
+			mLastTask->wait();
+			mLastTask = nullptr;
+		}
+
+		for (auto& block : mBlocks)
+			block.task = nullptr;
+	}
+}
@@ -233,11 +233,12 @@ namespace BansheeEngine
 			int numFields = si->getNumFields();
 			for(int i = 0; i < numFields; i++)
 			{
-				RTTIField* curGenericField = si->getField(i);
+				const RTTIFieldInfo& fieldInfo = si->_getFieldInfo(i);
+				RTTIField* curGenericField = fieldInfo.field;
 
 				// Copy field ID & other meta-data like field size and type
-				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, curGenericField->getTypeSize(), 
-					curGenericField->mIsVectorType, curGenericField->mType, curGenericField->hasDynamicSize(), false);
+				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, fieldInfo.typeSize, 
+					curGenericField->mIsVectorType, curGenericField->mType, fieldInfo.hasDynamicSize, false);
 				COPY_TO_BUFFER(&metaData, META_SIZE)
 
 				if(curGenericField->mIsVectorType)
@@ -289,13 +290,31 @@ namespace BansheeEngine
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+							// If elements have a fixed size and the entire array fits in the buffer, write it without 
+							// checking the buffer size for each element
+							if(!fieldInfo.hasDynamicSize)
+							{
+								UINT64 arraySize = (UINT64)arrayNumElems * fieldInfo.typeSize;
+								if((*bytesWritten + arraySize) <= bufferLength)
+								{
+									for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+									{
+										curField->arrayElemToBuffer(object, arrIdx, buffer);
+										buffer += fieldInfo.typeSize;
+									}
+
+									*bytesWritten += (UINT32)arraySize;
+									break;
+								}
+							}
+
 							for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
 							{
 								UINT32 typeSize = 0;
-								if(curField->hasDynamicSize())
+								if(fieldInfo.hasDynamicSize)
 									typeSize = curField->getArrayElemDynamicSize(object, arrIdx);
 								else
-									typeSize = curField->getTypeSize();
+									typeSize = fieldInfo.typeSize;
 
 								if ((*bytesWritten + typeSize) > bufferLength)
 								{
@@ -364,10 +383,10 @@ namespace BansheeEngine
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
 							UINT32 typeSize = 0;
-							if(curField->hasDynamicSize())
+							if(fieldInfo.hasDynamicSize)
 								typeSize = curField->getDynamicSize(object);
 							else
-								typeSize = curField->getTypeSize();
+								typeSize = fieldInfo.typeSize;
 
 							if ((*bytesWritten + typeSize) > bufferLength)
 							{
@@ -560,17 +579,20 @@ namespace BansheeEngine
 			}
 
 			RTTIField* curGenericField = nullptr;
+			const RTTIFieldInfo* fieldInfo = nullptr;
 
 			if (rtti != nullptr)
-				curGenericField = rtti->findField(fieldId);
+				fieldInfo = rtti->_findFieldInfo(fieldId);
 
-			if (curGenericField != nullptr)
+			if (fieldInfo != nullptr)
 			{
-				if (!hasDynamicSize && curGenericField->getTypeSize() != fieldSize)
+				curGenericField = fieldInfo->field;
+
+				if (!hasDynamicSize && fieldInfo->typeSize != fieldSize)
 				{
 					BS_EXCEPT(InternalErrorException,
 						"Data type mismatch. Type size stored in file and actual type size don't match. ("
-						+ toString(curGenericField->getTypeSize()) + " vs. " + toString(fieldSize) + ")");
+						+ toString(fieldInfo->typeSize) + " vs. " + toString(fieldSize) + ")");
 				}
 
 				if (curGenericField->mIsVectorType != isArray)
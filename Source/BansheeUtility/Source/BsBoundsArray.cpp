@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBoundsArray.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	BoundsArray::BoundsArray()
+		:mNumEntries(0)
+	{ }
+
+	void BoundsArray::add(const Bounds& bounds)
+	{
+		UINT32 idx = mNumEntries;
+		resize(mNumEntries + 1);
+
+		set(idx, bounds);
+	}
+
+	void BoundsArray::set(UINT32 idx, const Bounds& bounds)
+	{
+		assert(idx < mNumEntries);
+
+		const Sphere& sphere = bounds.getSphere();
+		const Vector3& sphereCenter = sphere.getCenter();
+
+		mSphereX[idx] = sphereCenter.x;
+		mSphereY[idx] = sphereCenter.y;
+		mSphereZ[idx] = sphereCenter.z;
+		mSphereRadius[idx] = sphere.getRadius();
+
+		const AABox& box = bounds.getBox();
+		Vector3 boxCenter = box.getCenter();
+		Vector3 boxExtents = box.getHalfSize();
+
+		mBoxCenterX[idx] = boxCenter.x;
+		mBoxCenterY[idx] = boxCenter.y;
+		mBoxCenterZ[idx] = boxCenter.z;
+		mBoxExtentX[idx] = Math::abs(boxExtents.x);
+		mBoxExtentY[idx] = Math::abs(boxExtents.y);
+		mBoxExtentZ[idx] = Math::abs(boxExtents.z);
+	}
+
+	void BoundsArray::swap(UINT32 idxA, UINT32 idxB)
+	{
+		assert(idxA < mNumEntries && idxB < mNumEntries);
+
+		std::swap(mSphereX[idxA], mSphereX[idxB]);
+		std::swap(mSphereY[idxA], mSphereY[idxB]);
+		std::swap(mSphereZ[idxA], mSphereZ[idxB]);
+		std::swap(mSphereRadius[idxA], mSphereRadius[idxB]);
+
+		std::swap(mBoxCenterX[idxA], mBoxCenterX[idxB]);
+		std::swap(mBoxCenterY[idxA], mBoxCenterY[idxB]);
+		std::swap(mBoxCenterZ[idxA], mBoxCenterZ[idxB]);
+		std::swap(mBoxExtentX[idxA], mBoxExtentX[idxB]);
+		std::swap(mBoxExtentY[idxA], mBoxExtentY[idxB]);
+		std::swap(mBoxExtentZ[idxA], mBoxExtentZ[idxB]);
+	}
+
+	void BoundsArray::removeLast()
+	{
+		assert(mNumEntries > 0);
+
+		UINT32 idx = mNumEntries - 1;
+		set(idx, Bounds(AABox(Vector3::ZERO, Vector3::ZERO), Sphere(Vector3::ZERO, 0.0f)));
+
+		resize(mNumEntries - 1);
+	}
+
+	void BoundsArray::clear()
+	{
+		resize(0);
+	}
+
+	void BoundsArray::resize(UINT32 numEntries)
+	{
+		mNumEntries = numEntries;
+
+		UINT32 numPadded = ((numEntries + BATCH_SIZE - 1) / BATCH_SIZE) * BATCH_SIZE;
+
+		mSphereX.resize(numPadded, 0.0f);
+		mSphereY.resize(numPadded, 0.0f);
+		mSphereZ.resize(numPadded, 0.0f);
+		mSphereRadius.resize(numPadded, 0.0f);
+
+		mBoxCenterX.resize(numPadded, 0.0f);
+		mBoxCenterY.resize(numPadded, 0.0f);
+		mBoxCenterZ.resize(numPadded, 0.0f);
+		mBoxExtentX.resize(numPadded, 0.0f);
+		mBoxExtentY.resize(numPadded, 0.0f);
+		mBoxExtentZ.resize(numPadded, 0.0f);
+	}
+}
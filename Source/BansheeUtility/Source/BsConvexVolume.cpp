@@ -6,6 +6,8 @@
 #include "BsPlane.h"
 #include "BsMath.h"
 
+#include <xmmintrin.h>
+
 namespace BansheeEngine
 {
 	ConvexVolume::ConvexVolume(const Vector<Plane>& planes)
@@ -48,4 +50,94 @@ namespace BansheeEngine
 
 		return true;
 	}
+
+	void ConvexVolume::intersectsBatch(const BoundsArray& bounds, Vector<UINT32>& output) const
+	{
+		UINT32 numEntries = bounds.size();
+		UINT32 numWords = (numEntries + 31) / 32;
+
+		output.resize(numWords);
+		if (numWords == 0)
+			return;
+
+		memset(output.data(), 0, numWords * sizeof(UINT32));
+
+		// Pre-calculate per-plane values so they can be splat into registers: normal, absolute normal and distance
+		static const UINT32 PLANE_STRIDE = 7;
+
+		UINT32 numPlanes = (UINT32)mPlanes.size();
+		Vector<float> planeData(numPlanes * PLANE_STRIDE);
+		for (UINT32 i = 0; i < numPlanes; i++)
+		{
+			const Plane& plane = mPlanes[i];
+			float* entry = &planeData[i * PLANE_STRIDE];
+
+			entry[0] = plane.normal.x;
+			entry[1] = plane.normal.y;
+			entry[2] = plane.normal.z;
+			entry[3] = Math::abs(plane.normal.x);
+			entry[4] = Math::abs(plane.normal.y);
+			entry[5] = Math::abs(plane.normal.z);
+			entry[6] = plane.d;
+		}
+
+		static_assert(BoundsArray::BATCH_SIZE == 4, "Batch size must match the SSE vector width.");
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 allSet = _mm_cmpeq_ps(zero, zero);
+
+		for (UINT32 i = 0; i < numEntries; i += BoundsArray::BATCH_SIZE)
+		{
+			__m128 sphereX = _mm_loadu_ps(&bounds.mSphereX[i]);
+			__m128 sphereY = _mm_loadu_ps(&bounds.mSphereY[i]);
+			__m128 sphereZ = _mm_loadu_ps(&bounds.mSphereZ[i]);
+			__m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(&bounds.mSphereRadius[i]));
+
+			__m128 boxX = _mm_loadu_ps(&bounds.mBoxCenterX[i]);
+			__m128 boxY = _mm_loadu_ps(&bounds.mBoxCenterY[i]);
+			__m128 boxZ = _mm_loadu_ps(&bounds.mBoxCenterZ[i]);
+			__m128 extentX = _mm_loadu_ps(&bounds.mBoxExtentX[i]);
+			__m128 extentY = _mm_loadu_ps(&bounds.mBoxExtentY[i]);
+			__m128 extentZ = _mm_loadu_ps(&bounds.mBoxExtentZ[i]);
+
+			__m128 inside = allSet;
+			for (UINT32 j = 0; j < numPlanes; j++)
+			{
+				const float* entry = &planeData[j * PLANE_STRIDE];
+
+				__m128 normalX = _mm_load1_ps(&entry[0]);
+				__m128 normalY = _mm_load1_ps(&entry[1]);
+				__m128 normalZ = _mm_load1_ps(&entry[2]);
+				__m128 planeD = _mm_load1_ps(&entry[6]);
+
+				// Sphere
+				__m128 sphereDist = _mm_mul_ps(sphereX, normalX);
+				sphereDist = _mm_add_ps(sphereDist, _mm_mul_ps(sphereY, normalY));
+				sphereDist = _mm_add_ps(sphereDist, _mm_mul_ps(sphereZ, normalZ));
+				sphereDist = _mm_sub_ps(sphereDist, planeD);
+
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(sphereDist, negRadius));
+
+				// Box
+				__m128 boxDist = _mm_mul_ps(boxX, normalX);
+				boxDist = _mm_add_ps(boxDist, _mm_mul_ps(boxY, normalY));
+				boxDist = _mm_add_ps(boxDist, _mm_mul_ps(boxZ, normalZ));
+				boxDist = _mm_sub_ps(boxDist, planeD);
+
+				__m128 effectiveRadius = _mm_mul_ps(extentX, _mm_load1_ps(&entry[3]));
+				effectiveRadius = _mm_add_ps(effectiveRadius, _mm_mul_ps(extentY, _mm_load1_ps(&entry[4])));
+				effectiveRadius = _mm_add_ps(effectiveRadius, _mm_mul_ps(extentZ, _mm_load1_ps(&entry[5])));
+
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(boxDist, _mm_sub_ps(zero, effectiveRadius)));
+			}
+
+			UINT32 mask = (UINT32)_mm_movemask_ps(inside);
+			output[i / 32] |= mask << (i % 32);
+		}
+
+		// Clear bits belonging to padding entries
+		UINT32 numUsedBits = numEntries % 32;
+		if (numUsedBits != 0)
+			output[numWords - 1] &= (1U << numUsedBits) - 1;
+	}
 }
\ No newline at end of file
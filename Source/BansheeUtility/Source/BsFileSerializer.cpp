@@ -7,15 +7,55 @@
 #include "BsBinarySerializer.h"
 #include "BsFileSystem.h"
 #include "BsDataStream.h"
+#include "BsAsyncFileDataStream.h"
 #include "BsDebug.h"
 #include <numeric>
+#include <limits>
+#include <array>
 
 using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	/** Identifier at the start of files written by FileEncoder. Files without it use the legacy format. */
+	static const UINT32 FILE_MAGIC = 0x45465342; // "BSFE"
+
+	/** Version of the file format written by FileEncoder. */
+	static const UINT32 FILE_VERSION = 1;
+
+	/** Files larger than this are read through AsyncFileDataStream. */
+	static const UINT64 ASYNC_READ_THRESHOLD = 4 * 1024 * 1024;
+
+	/** Size of the chunks the object data is read in when verifying checksums. */
+	static const UINT32 VERIFY_CHUNK_SIZE = 64 * 1024;
+
+	/** Updates a CRC32 checksum with the provided data. Start with a checksum of zero. */
+	UINT32 updateCRC32(UINT32 crc, const UINT8* data, size_t size)
+	{
+		static const auto table = []()
+		{
+			std::array<UINT32, 256> output;
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				UINT32 value = i;
+				for (UINT32 j = 0; j < 8; j++)
+					value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+
+				output[i] = value;
+			}
+
+			return output;
+		}();
+
+		crc = ~crc;
+		for (size_t i = 0; i < size; i++)
+			crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+		return ~crc;
+	}
+
 	FileEncoder::FileEncoder(const Path& fileLocation)
-		:mWriteBuffer(nullptr)
+		:mWriteBuffer(nullptr), mObjectSize(0), mChecksum(0)
 	{
 		mWriteBuffer = (UINT8*)bs_alloc(WRITE_BUFFER_SIZE);
 
@@ -23,19 +63,16 @@ namespace BansheeEngine
 		if (!FileSystem::exists(parentDir))
 			FileSystem::createDir(parentDir);
 
-		mOutputStream.open(fileLocation.toWString().c_str(), std::ios::out | std::ios::binary);
-		if (mOutputStream.fail())
-		{
-			LOGWRN("Failed to save file: \"" + fileLocation.toString() + "\". Error: " + strerror(errno) + ".");
-		}
+		mOutputStream = bs_shared_ptr_new<AsyncFileDataStream>(fileLocation, DataStream::WRITE);
+
+		UINT32 header[2] = { FILE_MAGIC, FILE_VERSION };
+		mOutputStream->write(header, sizeof(header));
 	}
 
 	FileEncoder::~FileEncoder()
 	{
+		mOutputStream->close();
 		bs_free(mWriteBuffer);
-
-		mOutputStream.close();
-		mOutputStream.clear();
 	}
 
 	void FileEncoder::encode(IReflectable* object, const UnorderedMap<String, UINT64>& params)
@@ -43,61 +80,173 @@ namespace BansheeEngine
 		if (object == nullptr)
 			return;
 
-		UINT64 curPos = (UINT64)mOutputStream.tellp();
-		mOutputStream.seekp(sizeof(UINT32), std::ios_base::cur);
+		// Size and checksum aren't known until the object is fully written, so reserve space for them and fill them out
+		// afterwards
+		UINT8 objectHeader[sizeof(UINT64) + sizeof(UINT32)] = { 0 };
+
+		size_t headerPos = mOutputStream->tell();
+		mOutputStream->write(objectHeader, sizeof(objectHeader));
+
+		mObjectSize = 0;
+		mChecksum = 0;
 
 		BinarySerializer bs;
 		UINT32 totalBytesWritten = 0;
 		bs.encode(object, mWriteBuffer, WRITE_BUFFER_SIZE, &totalBytesWritten, 
 			std::bind(&FileEncoder::flushBuffer, this, _1, _2, _3), false, params);
 
-		mOutputStream.seekp(curPos);
-		mOutputStream.write((char*)&totalBytesWritten, sizeof(totalBytesWritten));
-		mOutputStream.seekp(totalBytesWritten, std::ios_base::cur);
+		memcpy(objectHeader, &mObjectSize, sizeof(UINT64));
+		memcpy(objectHeader + sizeof(UINT64), &mChecksum, sizeof(UINT32));
+		mOutputStream->writeAt(headerPos, objectHeader, sizeof(objectHeader));
 	}
 
 	UINT8* FileEncoder::flushBuffer(UINT8* bufferStart, UINT32 bytesWritten, UINT32& newBufferSize)
 	{
-		mOutputStream.write((const char*)bufferStart, bytesWritten);
+		// Serializer tracks its total size in 32 bits, so make sure it didn't wrap around
+		mObjectSize += bytesWritten;
+		if (mObjectSize > std::numeric_limits<UINT32>::max())
+		{
+			BS_EXCEPT(InternalErrorException, "Object being encoded is larger than 4 GB, which is not supported by the "
+				"binary serializer.");
+		}
+
+		mChecksum = updateCRC32(mChecksum, bufferStart, bytesWritten);
+		mOutputStream->write(bufferStart, bytesWritten);
 
 		return bufferStart;
 	}
 
-	FileDecoder::FileDecoder(const Path& fileLocation)
+	FileDecoder::FileDecoder(const Path& fileLocation, bool verifyChecksums)
+		:mVersion(0), mVerifyChecksums(verifyChecksums)
 	{
-		mInputStream = FileSystem::openFile(fileLocation, true);
+		if (FileSystem::isFile(fileLocation) && FileSystem::getFileSize(fileLocation) >= ASYNC_READ_THRESHOLD)
+			mInputStream = bs_shared_ptr_new<AsyncFileDataStream>(fileLocation, DataStream::READ);
+		else
+			mInputStream = FileSystem::openFile(fileLocation, true);
 
 		if (mInputStream == nullptr)
 			return;
 
-		if (mInputStream->size() > std::numeric_limits<UINT32>::max())
+		readHeader();
+	}
+
+	FileDecoder::FileDecoder(const SPtr<DataStream>& stream, bool verifyChecksums)
+		:mInputStream(stream), mVersion(0), mVerifyChecksums(verifyChecksums)
+	{
+		if (mInputStream == nullptr)
+			return;
+
+		readHeader();
+	}
+
+	void FileDecoder::readHeader()
+	{
+		size_t startPos = mInputStream->tell();
+
+		UINT32 header[2] = { 0, 0 };
+		if (mInputStream->read(header, sizeof(header)) == sizeof(header) && header[0] == FILE_MAGIC)
 		{
-			BS_EXCEPT(InternalErrorException,
-				"File size is larger that UINT32 can hold. Ask a programmer to use a bigger data type.");
+			if (header[1] > FILE_VERSION)
+			{
+				BS_EXCEPT(InternalErrorException, "Unsupported file version: " + toString(header[1]) + 
+					". Maximum supported version is " + toString(FILE_VERSION) + ".");
+			}
+
+			mVersion = header[1];
+		}
+		else // Legacy format, with no header
+		{
+			mVersion = 0;
+			mInputStream->seek(startPos);
+		}
+	}
+
+	bool FileDecoder::readObjectHeader(UINT64& size, UINT32& checksum)
+	{
+		if (mInputStream == nullptr || mInputStream->eof())
+			return false;
+
+		if (mVersion == 0)
+		{
+			UINT32 legacySize = 0;
+			if (mInputStream->read(&legacySize, sizeof(legacySize)) != sizeof(legacySize))
+				return false;
+
+			size = legacySize;
+			checksum = 0;
+			return true;
 		}
+
+		if (mInputStream->read(&size, sizeof(size)) != sizeof(size))
+			return false;
+
+		if (mInputStream->read(&checksum, sizeof(checksum)) != sizeof(checksum))
+			return false;
+
+		return true;
+	}
+
+	bool FileDecoder::verifyChecksum(UINT64 size, UINT32 checksum)
+	{
+		size_t startPos = mInputStream->tell();
+
+		UINT8* buffer = (UINT8*)bs_alloc(VERIFY_CHUNK_SIZE);
+		UINT32 actualChecksum = 0;
+		UINT64 remaining = size;
+		while (remaining > 0)
+		{
+			size_t toRead = (size_t)std::min(remaining, (UINT64)VERIFY_CHUNK_SIZE);
+			size_t numRead = mInputStream->read(buffer, toRead);
+			if (numRead == 0)
+				break;
+
+			actualChecksum = updateCRC32(actualChecksum, buffer, numRead);
+			remaining -= numRead;
+		}
+		bs_free(buffer);
+
+		mInputStream->seek(startPos);
+		return remaining == 0 && actualChecksum == checksum;
 	}
 
 	SPtr<IReflectable> FileDecoder::decode(const UnorderedMap<String, UINT64>& params)
 	{
-		if (mInputStream->eof())
+		UINT64 objectSize = 0;
+		UINT32 checksum = 0;
+		if (!readObjectHeader(objectSize, checksum))
 			return nullptr;
 
-		UINT32 objectSize = 0;
-		mInputStream->read(&objectSize, sizeof(objectSize));
+		size_t objectStart = mInputStream->tell();
+		if (objectSize > std::numeric_limits<UINT32>::max())
+		{
+			BS_EXCEPT(InternalErrorException,
+				"Encoded object is larger than 4 GB, which is the maximum size the binary serializer can decode.");
+		}
+
+		if (mVerifyChecksums && mVersion > 0 && !verifyChecksum(objectSize, checksum))
+		{
+			LOGERR("Checksum mismatch when decoding an object. Data is corrupt, object will not be decoded.");
+
+			mInputStream->seek(objectStart + (size_t)objectSize);
+			return nullptr;
+		}
 
 		BinarySerializer bs;
-		SPtr<IReflectable> object = bs.decode(mInputStream, objectSize, params);
+		SPtr<IReflectable> object = bs.decode(mInputStream, (UINT32)objectSize, params);
+
+		// Make sure the next decode starts at the next object, regardless of how much data the serializer consumed
+		mInputStream->seek(objectStart + (size_t)objectSize);
 
 		return object;
 	}
 
 	void FileDecoder::skip()
 	{
-		if (mInputStream->eof())
+		UINT64 objectSize = 0;
+		UINT32 checksum = 0;
+		if (!readObjectHeader(objectSize, checksum))
 			return;
 
-		UINT32 objectSize = 0;
-		mInputStream->read(&objectSize, sizeof(objectSize));
-		mInputStream->skip(objectSize);
+		mInputStream->skip((size_t)objectSize);
 	}
-}
\ No newline at end of file
+}
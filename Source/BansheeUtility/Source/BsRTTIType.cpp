@@ -31,12 +31,11 @@ namespace BansheeEngine
 
 	RTTIField* RTTITypeBase::findField(int uniqueFieldId)
 	{
-		auto foundElement = std::find_if(mFields.begin(), mFields.end(), [&uniqueFieldId](RTTIField* x) { return x->mUniqueId == uniqueFieldId; });
-
-		if(foundElement == mFields.end())
+		const RTTIFieldInfo* fieldInfo = _findFieldInfo(uniqueFieldId);
+		if (fieldInfo == nullptr)
 			return nullptr;
 
-		return *foundElement;
+		return fieldInfo->field;
 	}
 
 	void RTTITypeBase::addNewField(RTTIField* field)
@@ -48,9 +47,7 @@ namespace BansheeEngine
 		}
 
 		int uniqueId = field->mUniqueId;
-		auto foundElementById = std::find_if(mFields.begin(), mFields.end(), [uniqueId](RTTIField* x) { return x->mUniqueId == uniqueId; });
-
-		if(foundElementById != mFields.end())
+		if(_findFieldInfo(uniqueId) != nullptr)
 		{
 			BS_EXCEPT(InternalErrorException, 
 				"Field with the same ID already exists.");
@@ -65,7 +62,18 @@ namespace BansheeEngine
 				"Field with the same name already exists.");
 		}
 
+		if(uniqueId >= (int)mFieldIdxById.size())
+			mFieldIdxById.resize(uniqueId + 1, INVALID_FIELD_IDX);
+
+		mFieldIdxById[uniqueId] = (UINT16)mFields.size();
 		mFields.push_back(field);
+
+		RTTIFieldInfo fieldInfo;
+		fieldInfo.field = field;
+		fieldInfo.typeSize = field->getTypeSize();
+		fieldInfo.hasDynamicSize = field->hasDynamicSize();
+
+		mFieldInfos.push_back(fieldInfo);
 	}
 
 	SPtr<IReflectable> rtti_create(UINT32 rttiId)
@@ -5,9 +5,18 @@
 
 namespace BansheeEngine
 {
-	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
+	/** Index of the worker the current thread belongs to, or -1 if not a worker thread. */
+	BS_THREADLOCAL UINT32 CurrentWorkerIdx = (UINT32)-1;
+
+	/** Converts a task priority into an index of a worker queue. Higher priority queues have higher indices. */
+	UINT32 getPriorityIdx(TaskPriority priority)
+	{
+		return (UINT32)priority - (UINT32)TaskPriority::VeryLow;
+	}
+
+	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
 		TaskPriority priority, SPtr<Task> dependency)
-		:mName(name), mPriority(priority), mTaskId(0), mTaskWorker(taskWorker), mTaskDependency(dependency),
+		:mName(name), mPriority(priority), mTaskWorker(taskWorker), mTaskDependency(dependency), mState(0),
 		mParent(nullptr)
 	{
 
@@ -39,124 +48,316 @@ namespace BansheeEngine
 	}
 
 	TaskScheduler::TaskScheduler()
-		:mTaskQueue(&TaskScheduler::taskCompare), mMaxActiveTasks(0), mNextTaskId(0), mShutdown(false)
+		: mNumWorkers(0), mMaxActiveTasks(0), mNumQueuedJobs(0), mNumSleeping(0), mNumWaiters(0), mNextQueue(0)
+		, mShutdown(false), mTaskStartedCallback(nullptr), mTaskFinishedCallback(nullptr)
 	{
 		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		// All workers are created up front and never added afterwards, so the number of pool threads held by the
+		// scheduler is known at startup. Always keep at least one worker so there is somewhere to queue jobs.
+		UINT32 numWorkers = mMaxActiveTasks.load();
+		numWorkers = numWorkers > MAX_WORKERS ? MAX_WORKERS : numWorkers;
+		numWorkers = numWorkers > 0 ? numWorkers : 1;
+
+		for (UINT32 i = 0; i < numWorkers; i++)
+			spawnWorker();
 	}
 
 	TaskScheduler::~TaskScheduler()
 	{
-		// Wait until all tasks complete
+		// Workers finish their current job and exit
 		{
-			Lock activeTaskLock(mReadyMutex);
+			Lock lock(mReadyMutex);
+			mShutdown = true;
+		}
 
-			while (mActiveTasks.size() > 0)
-			{
-				SPtr<Task> task = mActiveTasks[0];
-				activeTaskLock.unlock();
+		mTaskReadyCond.notify_all();
 
-				task->wait();
-				activeTaskLock.lock();
-			}
-		}
+		for (auto& thread : mWorkerThreads)
+			thread.blockUntilComplete();
+
+		// Execute any jobs still queued on this thread, so queued tasks still complete and anyone waiting on them is
+		// released. This includes tasks queued as dependants of the ones executed here.
+		Job job;
+		while (popJob(0, job))
+			executeJob(job);
 
-		// Start shutdown of the main queue worker and wait until it exits
+		UINT32 numWorkers = mNumWorkers.load();
+		for (UINT32 i = 0; i < numWorkers; i++)
+			bs_delete(mWorkers[i]);
+	}
+
+	void TaskScheduler::addTask(const SPtr<Task>& task)
+	{
+		task->mParent = this;
+
+		// Tasks with incomplete dependencies are queued by the dependency once it completes
+		const SPtr<Task>& dependency = task->mTaskDependency;
+		if (dependency != nullptr)
 		{
-			Lock lock(mReadyMutex);
+			ScopedSpinLock lock(dependency->mDependantsLock);
 
-			mShutdown = true;
+			if (!dependency->isComplete())
+			{
+				dependency->mDependants.push_back(task);
+				return;
+			}
 		}
 
-		mTaskReadyCond.notify_one();
+		Job job;
+		job.task = task;
 
-		mTaskSchedulerThread.blockUntilComplete();
+		queueJob(job, task->mPriority);
 	}
 
-	void TaskScheduler::addTask(const SPtr<Task>& task)
+	void TaskScheduler::parallelFor(UINT32 begin, UINT32 end, UINT32 grain,
+		const std::function<void(UINT32, UINT32)>& worker, TaskPriority priority)
 	{
-		Lock lock(mReadyMutex);
+		if (end <= begin)
+			return;
 
-		task->mParent = this;
-		task->mTaskId = mNextTaskId++;
+		if (grain == 0)
+			grain = 1;
+
+		UINT32 numChunks = (end - begin + grain - 1) / grain;
+		UINT32 numHelpers = std::min(numChunks - 1, getNumWorkers());
+
+		// Not worth queuing anything, just run on this thread
+		if (numHelpers == 0)
+		{
+			for (UINT32 i = begin; i < end; i += grain)
+				worker(i, std::min(i + grain, end));
+
+			return;
+		}
+
+		// Data is reference counted since helper jobs might start only after the call has already returned (e.g. if all
+		// workers are busy the calling thread will end up executing all the chunks itself)
+		ParallelForData* data = bs_new<ParallelForData>();
+		data->nextChunk = 0;
+		data->numCompletedChunks = 0;
+		data->refCount = numHelpers + 2; // One for each helper, and two for the caller (participation and waiting)
+		data->numChunks = numChunks;
+		data->begin = begin;
+		data->end = end;
+		data->grain = grain;
+		data->worker = &worker;
+
+		Job job;
+		job.parallelFor = data;
 
-		mTaskQueue.insert(task);
+		for (UINT32 i = 0; i < numHelpers; i++)
+			queueJob(job, priority);
+
+		// Participate, then wait for any chunks still being executed by the helpers
+		executeChunks(data);
+
+		if (data->numCompletedChunks.load() < numChunks)
+		{
+			mNumWaiters++;
+			{
+				Lock lock(mCompleteMutex);
 
-		// Wake main scheduler thread
-		mTaskReadyCond.notify_one();
+				while (data->numCompletedChunks.load() < numChunks)
+					mTaskCompleteCond.wait(lock);
+			}
+			mNumWaiters--;
+		}
+
+		if (data->refCount.fetch_sub(1) == 1)
+			bs_delete(data);
 	}
 
 	void TaskScheduler::addWorker()
 	{
-		Lock lock(mReadyMutex);
-
-		mMaxActiveTasks++;
+		++mMaxActiveTasks;
 
-		// A spot freed up, queue new tasks on main scheduler thread if they exist
-		mTaskReadyCond.notify_one();
+		// A spot freed up, wake workers so they can start on queued tasks
+		if (mNumSleeping.load() > 0)
+		{
+			Lock lock(mReadyMutex);
+			mTaskReadyCond.notify_all();
+		}
 	}
 
 	void TaskScheduler::removeWorker()
 	{
-		Lock lock(mReadyMutex);
+		UINT32 numActive = mMaxActiveTasks.load();
+		while (numActive > 0 && !mMaxActiveTasks.compare_exchange_weak(numActive, numActive - 1))
+		{ }
+	}
+
+	void TaskScheduler::setTaskCallbacks(TaskCallback onStarted, TaskCallback onFinished)
+	{
+		mTaskStartedCallback.store(onStarted);
+		mTaskFinishedCallback.store(onFinished);
+	}
+
+	void TaskScheduler::spawnWorker()
+	{
+		UINT32 workerIdx = mNumWorkers.load();
+
+		// Queue must be visible to other workers before they see the new worker count
+		mWorkers[workerIdx] = bs_new<WorkerQueue>();
+		mNumWorkers.store(workerIdx + 1);
 
-		if(mMaxActiveTasks > 0)
-			mMaxActiveTasks--;
+		mWorkerThreads.push_back(ThreadPool::instance().run("TaskWorker", std::bind(&TaskScheduler::runWorker, this, workerIdx)));
 	}
 
-	void TaskScheduler::runMain()
+	void TaskScheduler::runWorker(UINT32 workerIdx)
 	{
-		while(true)
+		CurrentWorkerIdx = workerIdx;
+
+		while (!mShutdown.load())
 		{
+			Job job;
+			if (workerIdx < mMaxActiveTasks.load() && popJob(workerIdx, job))
+			{
+				executeJob(job);
+				continue;
+			}
+
+			// Sleeping count is incremented before checking the job count, while queueJob() increments the job count
+			// before checking the sleeping count. This way either we see the new job, or queueJob() sees us sleeping.
 			Lock lock(mReadyMutex);
+			mNumSleeping++;
 
-			while((mTaskQueue.size() == 0 || (UINT32)mActiveTasks.size() >= mMaxActiveTasks) && !mShutdown)
+			while ((mNumQueuedJobs.load() == 0 || workerIdx >= mMaxActiveTasks.load()) && !mShutdown.load())
 				mTaskReadyCond.wait(lock);
 
-			if(mShutdown)
-				break;
+			mNumSleeping--;
+		}
 
-			for(UINT32 i = 0; (i < mTaskQueue.size()) && ((UINT32)mActiveTasks.size() < mMaxActiveTasks); i++)
-			{
-				SPtr<Task> curTask = *mTaskQueue.begin();
-				mTaskQueue.erase(mTaskQueue.begin());
+		CurrentWorkerIdx = (UINT32)-1;
+	}
+
+	void TaskScheduler::queueJob(Job job, TaskPriority priority)
+	{
+		UINT32 workerIdx = CurrentWorkerIdx;
+		if (workerIdx == (UINT32)-1)
+			workerIdx = mNextQueue.fetch_add(1) % mNumWorkers.load();
 
-				if(curTask->isCanceled())
-					continue;
+		WorkerQueue* queue = mWorkers[workerIdx];
+		{
+			ScopedSpinLock lock(queue->lock);
+			queue->jobs[getPriorityIdx(priority)].push_back(job);
+		}
 
-				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
-					continue;
+		mNumQueuedJobs++;
 
-				curTask->mState.store(1);
-				mActiveTasks.push_back(curTask);
+		// Wake everyone, since a single woken worker might be one of the inactive ones
+		if (mNumSleeping.load() > 0)
+		{
+			Lock lock(mReadyMutex);
+			mTaskReadyCond.notify_all();
+		}
 
-				ThreadPool::instance().run(curTask->mName, std::bind(&TaskScheduler::runTask, this, curTask));
+		// Workers blocked in waitUntilComplete() execute queued jobs while they wait
+		if (mNumWaiters.load() > 0)
+		{
+			Lock lock(mCompleteMutex);
+			mTaskCompleteCond.notify_all();
+		}
+	}
+
+	bool TaskScheduler::popJob(UINT32 workerIdx, Job& job)
+	{
+		if (mNumQueuedJobs.load() == 0)
+			return false;
+
+		UINT32 numWorkers = mNumWorkers.load();
+		for (INT32 priorityIdx = NUM_PRIORITIES - 1; priorityIdx >= 0; priorityIdx--)
+		{
+			// Own queue first, in order the jobs were queued
+			{
+				WorkerQueue* queue = mWorkers[workerIdx];
+				ScopedSpinLock lock(queue->lock);
+
+				Deque<Job>& jobs = queue->jobs[priorityIdx];
+				if (!jobs.empty())
+				{
+					job = std::move(jobs.front());
+					jobs.pop_front();
+
+					mNumQueuedJobs--;
+					return true;
+				}
+			}
+
+			// Steal from the back of other queues, to reduce contention with their owners
+			for (UINT32 i = 1; i < numWorkers; i++)
+			{
+				WorkerQueue* queue = mWorkers[(workerIdx + i) % numWorkers];
+				ScopedSpinLock lock(queue->lock);
+
+				Deque<Job>& jobs = queue->jobs[priorityIdx];
+				if (!jobs.empty())
+				{
+					job = std::move(jobs.back());
+					jobs.pop_back();
+
+					mNumQueuedJobs--;
+					return true;
+				}
 			}
 		}
+
+		return false;
 	}
 
-	void TaskScheduler::runTask(SPtr<Task> task)
+	void TaskScheduler::executeJob(Job& job)
 	{
+		if (job.parallelFor != nullptr)
+		{
+			executeChunks(job.parallelFor);
+			return;
+		}
+
+		const SPtr<Task>& task = job.task;
+		UINT32 expectedState = 0;
+		if (!task->mState.compare_exchange_strong(expectedState, 1))
+			return; // Canceled
+
+		// Dependency is no longer needed, release it so chains of dependant tasks don't keep each other alive
+		task->mTaskDependency = nullptr;
+
+		TaskCallback onStarted = mTaskStartedCallback.load();
+		if (onStarted != nullptr)
+			onStarted(*task);
+
 		task->mTaskWorker();
 
+		TaskCallback onFinished = mTaskFinishedCallback.load();
+		if (onFinished != nullptr)
+			onFinished(*task);
+
+		completeTask(task);
+	}
+
+	void TaskScheduler::completeTask(const SPtr<Task>& task)
+	{
+		Vector<SPtr<Task>> dependants;
 		{
-			Lock lock(mReadyMutex);
+			ScopedSpinLock lock(task->mDependantsLock);
 
-			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
-			if (findIter != mActiveTasks.end())
-				mActiveTasks.erase(findIter);
+			task->mState.store(2);
+			std::swap(dependants, task->mDependants);
 		}
 
+		// Same ordering as with sleeping workers, waiters register before checking the state
+		if (mNumWaiters.load() > 0)
 		{
 			Lock lock(mCompleteMutex);
-			task->mState.store(2);
-
 			mTaskCompleteCond.notify_all();
 		}
 
-		// Possibly this task was someones dependency, so wake the main scheduler thread
-		mTaskReadyCond.notify_one();
+		for (auto& dependant : dependants)
+		{
+			Job job;
+			job.task = dependant;
+
+			queueJob(job, dependant->mPriority);
+		}
 	}
 
 	void TaskScheduler::waitUntilComplete(const Task* task)
@@ -164,25 +365,65 @@ namespace BansheeEngine
 		if(task->isCanceled())
 			return;
 
+		UINT32 workerIdx = CurrentWorkerIdx;
+		bool isWorker = workerIdx != (UINT32)-1;
+
+		// Other threads let one more worker run while they are blocked. Workers instead execute queued jobs while they
+		// wait, which also guarantees progress when the task being waited on is queued behind other waiting workers.
+		if (!isWorker)
+			addWorker();
+
+		mNumWaiters++;
+		while (!task->isComplete())
 		{
-			Lock lock(mCompleteMutex);
-			
-			while(!task->isComplete())
+			Job job;
+			if (isWorker && popJob(workerIdx, job))
 			{
-				addWorker();
-				mTaskCompleteCond.wait(lock);
-				removeWorker();
+				executeJob(job);
+				continue;
 			}
+
+			Lock lock(mCompleteMutex);
+			if (task->isComplete() || (isWorker && mNumQueuedJobs.load() > 0))
+				continue;
+
+			mTaskCompleteCond.wait(lock);
 		}
+		mNumWaiters--;
+
+		if (!isWorker)
+			removeWorker();
 	}
 
-	bool TaskScheduler::taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs)
+	void TaskScheduler::executeChunks(ParallelForData* data)
 	{
-		// If one tasks priority is higher, that one goes first
-		if(lhs->mPriority > rhs->mPriority)
-			return true;
+		UINT32 numExecuted = 0;
+		while (true)
+		{
+			UINT32 chunkIdx = data->nextChunk.fetch_add(1);
+			if (chunkIdx >= data->numChunks)
+				break;
+
+			UINT32 chunkBegin = data->begin + chunkIdx * data->grain;
+			UINT32 chunkEnd = std::min(chunkBegin + data->grain, data->end);
+
+			(*data->worker)(chunkBegin, chunkEnd);
+			numExecuted++;
+		}
+
+		if (numExecuted > 0)
+		{
+			UINT32 numCompleted = data->numCompletedChunks.fetch_add(numExecuted) + numExecuted;
+
+			// Release the parallelFor() caller if it is waiting on the chunks executed here
+			if (numCompleted == data->numChunks && mNumWaiters.load() > 0)
+			{
+				Lock lock(mCompleteMutex);
+				mTaskCompleteCond.notify_all();
+			}
+		}
 
-		// Otherwise we go by smaller id, as that task was queued earlier than the other
-		return lhs->mTaskId < rhs->mTaskId;
+		if (data->refCount.fetch_sub(1) == 1)
+			bs_delete(data);
 	}
-}
\ No newline at end of file
+}
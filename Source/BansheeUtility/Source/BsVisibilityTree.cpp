@@ -0,0 +1,426 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsVisibilityTree.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/** Amount (relative to object size) by which leaf bounds are enlarged. */
+	static const float FAT_BOUNDS_SCALE = 0.1f;
+
+	/** Flag set on node indices in the query stack, signifying the node is known to be fully inside the volume. */
+	static const UINT32 INSIDE_FLAG = 0x80000000;
+
+	VisibilityTree::VisibilityTree()
+		:mRoot(NULL_NODE), mFreeList(NULL_NODE)
+	{ }
+
+	UINT32 VisibilityTree::add(UINT32 id, const AABox& bounds, UINT64 layers)
+	{
+		UINT32 leaf = allocateNode();
+
+		Vector3 margin = bounds.getSize() * FAT_BOUNDS_SCALE;
+
+		Node& node = mNodes[leaf];
+		node.bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+		node.layers = layers;
+		node.height = 0;
+		node.id = id;
+
+		insertLeaf(leaf);
+		return leaf;
+	}
+
+	void VisibilityTree::update(UINT32 leaf, const AABox& bounds)
+	{
+		assert(mNodes[leaf].isLeaf());
+
+		if (contains(mNodes[leaf].bounds, bounds))
+			return;
+
+		removeLeaf(leaf);
+
+		Vector3 margin = bounds.getSize() * FAT_BOUNDS_SCALE;
+		mNodes[leaf].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+
+		insertLeaf(leaf);
+	}
+
+	void VisibilityTree::remove(UINT32 leaf)
+	{
+		assert(mNodes[leaf].isLeaf());
+
+		removeLeaf(leaf);
+		freeNode(leaf);
+	}
+
+	void VisibilityTree::clear()
+	{
+		mNodes.clear();
+		mRoot = NULL_NODE;
+		mFreeList = NULL_NODE;
+	}
+
+	void VisibilityTree::query(const ConvexVolume& volume, UINT64 layers, Vector<UINT32>& inside,
+		Vector<UINT32>& intersecting, Vector<UINT32>& scratch) const
+	{
+		if (mRoot == NULL_NODE)
+			return;
+
+		const Vector<Plane>& planes = volume.getPlanes();
+
+		Vector<UINT32>& todo = scratch;
+		todo.clear();
+		todo.push_back(mRoot);
+
+		while (!todo.empty())
+		{
+			UINT32 entry = todo.back();
+			todo.pop_back();
+
+			const Node& node = mNodes[entry & ~INSIDE_FLAG];
+			if ((node.layers & layers) == 0)
+				continue;
+
+			bool isInside = (entry & INSIDE_FLAG) != 0;
+			if (!isInside)
+			{
+				Vector3 center = node.bounds.getCenter();
+				Vector3 extents = node.bounds.getHalfSize();
+
+				bool isOutside = false;
+				bool isPartial = false;
+				for (auto& plane : planes)
+				{
+					float dist = center.dot(plane.normal) - plane.d;
+
+					float effectiveRadius = extents.x * Math::abs(plane.normal.x);
+					effectiveRadius += extents.y * Math::abs(plane.normal.y);
+					effectiveRadius += extents.z * Math::abs(plane.normal.z);
+
+					if (dist < -effectiveRadius)
+					{
+						isOutside = true;
+						break;
+					}
+
+					if (dist < effectiveRadius)
+						isPartial = true;
+				}
+
+				if (isOutside)
+					continue;
+
+				isInside = !isPartial;
+			}
+
+			if (node.isLeaf())
+			{
+				if (isInside)
+					inside.push_back(node.id);
+				else
+					intersecting.push_back(node.id);
+			}
+			else
+			{
+				UINT32 flag = isInside ? INSIDE_FLAG : 0;
+
+				todo.push_back(node.children[0] | flag);
+				todo.push_back(node.children[1] | flag);
+			}
+		}
+	}
+
+	UINT32 VisibilityTree::allocateNode()
+	{
+		UINT32 idx;
+		if (mFreeList == NULL_NODE)
+		{
+			idx = (UINT32)mNodes.size();
+			assert((idx & INSIDE_FLAG) == 0);
+
+			mNodes.push_back(Node());
+		}
+		else
+		{
+			idx = mFreeList;
+			mFreeList = mNodes[idx].parent;
+		}
+
+		Node& node = mNodes[idx];
+		node.layers = 0;
+		node.parent = NULL_NODE;
+		node.children[0] = NULL_NODE;
+		node.children[1] = NULL_NODE;
+		node.height = 0;
+		node.id = 0;
+
+		return idx;
+	}
+
+	void VisibilityTree::freeNode(UINT32 node)
+	{
+		mNodes[node].parent = mFreeList;
+		mNodes[node].height = -1;
+		mFreeList = node;
+	}
+
+	void VisibilityTree::insertLeaf(UINT32 leaf)
+	{
+		if (mRoot == NULL_NODE)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = NULL_NODE;
+			return;
+		}
+
+		// Find the best sibling, using the surface area heuristic
+		AABox leafBounds = mNodes[leaf].bounds;
+		UINT32 index = mRoot;
+		while (!mNodes[index].isLeaf())
+		{
+			const Node& node = mNodes[index];
+			UINT32 child0 = node.children[0];
+			UINT32 child1 = node.children[1];
+
+			float area = getArea(node.bounds);
+			float combinedArea = getArea(merge(node.bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float costs[2];
+			UINT32 children[2] = { child0, child1 };
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const Node& child = mNodes[children[i]];
+
+				float childCost = getArea(merge(leafBounds, child.bounds));
+				if (!child.isLeaf())
+					childCost -= getArea(child.bounds);
+
+				costs[i] = childCost + inheritanceCost;
+			}
+
+			if (cost < costs[0] && cost < costs[1])
+				break;
+
+			index = costs[0] < costs[1] ? child0 : child1;
+		}
+
+		UINT32 sibling = index;
+
+		// Create a new parent for the leaf and its sibling
+		UINT32 oldParent = mNodes[sibling].parent;
+		UINT32 newParent = allocateNode();
+
+		Node& parentNode = mNodes[newParent];
+		parentNode.parent = oldParent;
+		parentNode.bounds = merge(leafBounds, mNodes[sibling].bounds);
+		parentNode.layers = mNodes[leaf].layers | mNodes[sibling].layers;
+		parentNode.height = mNodes[sibling].height + 1;
+		parentNode.children[0] = sibling;
+		parentNode.children[1] = leaf;
+
+		if (oldParent != NULL_NODE)
+		{
+			if (mNodes[oldParent].children[0] == sibling)
+				mNodes[oldParent].children[0] = newParent;
+			else
+				mNodes[oldParent].children[1] = newParent;
+		}
+		else
+			mRoot = newParent;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		refitAncestors(newParent);
+	}
+
+	void VisibilityTree::removeLeaf(UINT32 leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = NULL_NODE;
+			return;
+		}
+
+		UINT32 parent = mNodes[leaf].parent;
+		UINT32 grandParent = mNodes[parent].parent;
+		UINT32 sibling = mNodes[parent].children[0] == leaf ? mNodes[parent].children[1] : mNodes[parent].children[0];
+
+		if (grandParent != NULL_NODE)
+		{
+			// Replace the parent with the sibling
+			if (mNodes[grandParent].children[0] == parent)
+				mNodes[grandParent].children[0] = sibling;
+			else
+				mNodes[grandParent].children[1] = sibling;
+
+			mNodes[sibling].parent = grandParent;
+			freeNode(parent);
+
+			refitAncestors(grandParent);
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = NULL_NODE;
+			freeNode(parent);
+		}
+
+		mNodes[leaf].parent = NULL_NODE;
+	}
+
+	void VisibilityTree::refitAncestors(UINT32 node)
+	{
+		UINT32 index = node;
+		while (index != NULL_NODE)
+		{
+			index = balance(index);
+
+			Node& current = mNodes[index];
+			const Node& child0 = mNodes[current.children[0]];
+			const Node& child1 = mNodes[current.children[1]];
+
+			current.height = 1 + std::max(child0.height, child1.height);
+			current.bounds = merge(child0.bounds, child1.bounds);
+			current.layers = child0.layers | child1.layers;
+
+			index = current.parent;
+		}
+	}
+
+	UINT32 VisibilityTree::balance(UINT32 iA)
+	{
+		Node& A = mNodes[iA];
+		if (A.isLeaf() || A.height < 2)
+			return iA;
+
+		UINT32 iB = A.children[0];
+		UINT32 iC = A.children[1];
+		Node& B = mNodes[iB];
+		Node& C = mNodes[iC];
+
+		INT32 heightDiff = C.height - B.height;
+
+		// Rotate C up
+		if (heightDiff > 1)
+		{
+			UINT32 iF = C.children[0];
+			UINT32 iG = C.children[1];
+			Node& F = mNodes[iF];
+			Node& G = mNodes[iG];
+
+			// Swap A and C
+			C.children[0] = iA;
+			C.parent = A.parent;
+			A.parent = iC;
+
+			if (C.parent != NULL_NODE)
+			{
+				if (mNodes[C.parent].children[0] == iA)
+					mNodes[C.parent].children[0] = iC;
+				else
+					mNodes[C.parent].children[1] = iC;
+			}
+			else
+				mRoot = iC;
+
+			// Keep the taller of F and G under C, move the other one under A
+			UINT32 iKeep = F.height > G.height ? iF : iG;
+			UINT32 iMove = F.height > G.height ? iG : iF;
+			Node& keep = mNodes[iKeep];
+			Node& moved = mNodes[iMove];
+
+			C.children[1] = iKeep;
+			A.children[1] = iMove;
+			moved.parent = iA;
+
+			A.bounds = merge(B.bounds, moved.bounds);
+			A.layers = B.layers | moved.layers;
+			A.height = 1 + std::max(B.height, moved.height);
+
+			C.bounds = merge(A.bounds, keep.bounds);
+			C.layers = A.layers | keep.layers;
+			C.height = 1 + std::max(A.height, keep.height);
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (heightDiff < -1)
+		{
+			UINT32 iD = B.children[0];
+			UINT32 iE = B.children[1];
+			Node& D = mNodes[iD];
+			Node& E = mNodes[iE];
+
+			// Swap A and B
+			B.children[0] = iA;
+			B.parent = A.parent;
+			A.parent = iB;
+
+			if (B.parent != NULL_NODE)
+			{
+				if (mNodes[B.parent].children[0] == iA)
+					mNodes[B.parent].children[0] = iB;
+				else
+					mNodes[B.parent].children[1] = iB;
+			}
+			else
+				mRoot = iB;
+
+			// Keep the taller of D and E under B, move the other one under A
+			UINT32 iKeep = D.height > E.height ? iD : iE;
+			UINT32 iMove = D.height > E.height ? iE : iD;
+			Node& keep = mNodes[iKeep];
+			Node& moved = mNodes[iMove];
+
+			B.children[1] = iKeep;
+			A.children[0] = iMove;
+			moved.parent = iA;
+
+			A.bounds = merge(C.bounds, moved.bounds);
+			A.layers = C.layers | moved.layers;
+			A.height = 1 + std::max(C.height, moved.height);
+
+			B.bounds = merge(A.bounds, keep.bounds);
+			B.layers = A.layers | keep.layers;
+			B.height = 1 + std::max(A.height, keep.height);
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	AABox VisibilityTree::merge(const AABox& a, const AABox& b)
+	{
+		Vector3 min = Vector3::min(a.getMin(), b.getMin());
+		Vector3 max = Vector3::max(a.getMax(), b.getMax());
+
+		return AABox(min, max);
+	}
+
+	float VisibilityTree::getArea(const AABox& box)
+	{
+		Vector3 size = box.getSize();
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	bool VisibilityTree::contains(const AABox& outer, const AABox& inner)
+	{
+		const Vector3& outerMin = outer.getMin();
+		const Vector3& outerMax = outer.getMax();
+		const Vector3& innerMin = inner.getMin();
+		const Vector3& innerMax = inner.getMax();
+
+		return outerMin.x <= innerMin.x && outerMin.y <= innerMin.y && outerMin.z <= innerMin.z &&
+			outerMax.x >= innerMax.x && outerMax.y >= innerMax.y && outerMax.z >= innerMax.z;
+	}
+}
@@ -0,0 +1,59 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMappedFile.h"
+#include "BsDebug.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace BansheeEngine
+{
+	MappedFile::MappedFile(const PrivatelyConstruct& dummy)
+		:mData(nullptr), mSize(0), mFileHandle(nullptr), mMappingHandle(nullptr)
+	{ }
+
+	MappedFile::~MappedFile()
+	{
+		if (mData != nullptr)
+			munmap((void*)mData, (size_t)mSize);
+	}
+
+	SPtr<MappedFile> MappedFile::open(const Path& fullPath)
+	{
+		String pathString = fullPath.toString();
+
+		int fileDesc = ::open(pathString.c_str(), O_RDONLY);
+		if (fileDesc == -1)
+		{
+			LOGWRN("Cannot map file at path: \"" + pathString + "\". Unable to open the file.");
+			return nullptr;
+		}
+
+		struct stat fileStats;
+		if (fstat(fileDesc, &fileStats) != 0 || fileStats.st_size == 0)
+		{
+			// Empty files cannot be mapped
+			LOGWRN("Cannot map file at path: \"" + pathString + "\". File is empty.");
+			close(fileDesc);
+			return nullptr;
+		}
+
+		void* data = mmap(nullptr, (size_t)fileStats.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDesc, 0);
+
+		// Mapping keeps its own reference to the file, so the descriptor is no longer needed
+		close(fileDesc);
+
+		if (data == MAP_FAILED)
+		{
+			LOGWRN("Cannot map file at path: \"" + pathString + "\". Unable to map the file.");
+			return nullptr;
+		}
+
+		SPtr<MappedFile> output = bs_shared_ptr_new<MappedFile>(PrivatelyConstruct());
+		output->mData = (const UINT8*)data;
+		output->mSize = (UINT64)fileStats.st_size;
+
+		return output;
+	}
+}
@@ -0,0 +1,64 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMappedFile.h"
+#include "BsDebug.h"
+#include <windows.h>
+
+namespace BansheeEngine
+{
+	MappedFile::MappedFile(const PrivatelyConstruct& dummy)
+		:mData(nullptr), mSize(0), mFileHandle(INVALID_HANDLE_VALUE), mMappingHandle(nullptr)
+	{ }
+
+	MappedFile::~MappedFile()
+	{
+		if (mData != nullptr)
+			UnmapViewOfFile(mData);
+
+		if (mMappingHandle != nullptr)
+			CloseHandle((HANDLE)mMappingHandle);
+
+		if (mFileHandle != INVALID_HANDLE_VALUE)
+			CloseHandle((HANDLE)mFileHandle);
+	}
+
+	SPtr<MappedFile> MappedFile::open(const Path& fullPath)
+	{
+		WString pathString = fullPath.toWString();
+
+		SPtr<MappedFile> output = bs_shared_ptr_new<MappedFile>(PrivatelyConstruct());
+		output->mFileHandle = CreateFileW(pathString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (output->mFileHandle == INVALID_HANDLE_VALUE)
+		{
+			LOGWRN("Cannot map file at path: \"" + fullPath.toString() + "\". Unable to open the file.");
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx((HANDLE)output->mFileHandle, &fileSize) || fileSize.QuadPart == 0)
+		{
+			// Empty files cannot be mapped
+			LOGWRN("Cannot map file at path: \"" + fullPath.toString() + "\". File is empty.");
+			return nullptr;
+		}
+
+		output->mSize = (UINT64)fileSize.QuadPart;
+		output->mMappingHandle = CreateFileMappingW((HANDLE)output->mFileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (output->mMappingHandle == nullptr)
+		{
+			LOGWRN("Cannot map file at path: \"" + fullPath.toString() + "\". Unable to create a file mapping.");
+			return nullptr;
+		}
+
+		output->mData = (const UINT8*)MapViewOfFile((HANDLE)output->mMappingHandle, FILE_MAP_COPY, 0, 0, 0);
+		if (output->mData == nullptr)
+		{
+			LOGWRN("Cannot map file at path: \"" + fullPath.toString() + "\". Unable to map a view of the file.");
+			return nullptr;
+		}
+
+		return output;
+	}
+}
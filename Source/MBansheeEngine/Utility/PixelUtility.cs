@@ -247,7 +247,8 @@ namespace BansheeEngine
 	{
 		Box,
 		Triangle,
-		Kaiser
+		Kaiser,
+		Lanczos
 	};
 
     /// <summary>
@@ -307,6 +308,12 @@ namespace BansheeEngine
         /// Should the downsampled values be re-normalized. Only relevant for mip-maps representing normal maps.
         /// </summary>
 		public bool normalizeMipmaps;
+
+        /// <summary>
+        /// Determines has the input data been gamma corrected. If true filtering is done in linear space. Ignored for
+        /// normal maps.
+        /// </summary>
+		public bool isSRGB;
 	};
 
     /** @} */
@@ -0,0 +1,9 @@
+set(BS_NULLSMOKETEST_SRC_NOFILTER
+	"Source/Main.cpp"
+)
+
+source_group("Source Files" FILES ${BS_NULLSMOKETEST_SRC_NOFILTER})
+
+set(BS_NULLSMOKETEST_SRC
+	${BS_NULLSMOKETEST_SRC_NOFILTER}
+)
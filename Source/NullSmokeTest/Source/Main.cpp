@@ -0,0 +1,105 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsApplication.h"
+#include "BsBuiltinResources.h"
+#include "BsMaterial.h"
+#include "BsShader.h"
+#include "BsComponent.h"
+#include "BsCCamera.h"
+#include "BsCRenderable.h"
+#include "BsSceneObject.h"
+#include "BsRenderWindow.h"
+
+namespace BansheeEngine
+{
+	/** Number of frames to run the main loop for, before shutting down. */
+	const UINT32 NUM_FRAMES = 10;
+
+	/** Counts the frames executed by the main loop, and stops it once the requested number of frames ran. */
+	class FrameCounter : public Component
+	{
+	public:
+		FrameCounter(const HSceneObject& parent)
+			:Component(parent), mNumFrames(0)
+		{
+			setName("FrameCounter");
+		}
+
+		/** Triggered once per frame. */
+		void update() override
+		{
+			mNumFrames++;
+
+			if (mNumFrames == NUM_FRAMES)
+				gApplication().stopMainLoop();
+		}
+
+		/** Returns the number of frames the component was updated for. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+	private:
+		UINT32 mNumFrames;
+	};
+}
+
+using namespace BansheeEngine;
+
+/** 
+ * Starts the engine on the null render API, renders a simple scene for a few frames and shuts down. Returns a non-zero
+ * exit code if materials cannot find a usable technique, or if the main loop didn't run for the expected number of 
+ * frames. 
+ */
+int main()
+{
+	START_UP_DESC startUpDesc;
+	startUpDesc.renderAPI = "BansheeNullRenderAPI";
+	startUpDesc.renderer = BS_RENDERER_MODULE;
+	startUpDesc.audio = BS_AUDIO_MODULE;
+	startUpDesc.physics = BS_PHYSICS_MODULE;
+	startUpDesc.input = BS_INPUT_MODULE;
+
+	startUpDesc.primaryWindowDesc.videoMode = VideoMode(640, 480);
+	startUpDesc.primaryWindowDesc.title = "Banshee Null Smoke Test";
+	startUpDesc.primaryWindowDesc.fullscreen = false;
+	startUpDesc.primaryWindowDesc.depthBuffer = false;
+
+	Application::startUp(startUpDesc);
+
+	int result = 0;
+	{
+		HMaterial material = Material::create(BuiltinResources::instance().getDiffuseShader());
+		if (material->getNumPasses() == 0)
+		{
+			LOGERR("Smoke test failed: No supported technique found for the diffuse material.");
+			result = 1;
+		}
+
+		HSceneObject renderableSO = SceneObject::create("Renderable");
+		HRenderable renderable = renderableSO->addComponent<CRenderable>();
+		renderable->setMesh(BuiltinResources::instance().getMesh(BuiltinMesh::Box));
+		renderable->setMaterial(material);
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>(gApplication().getPrimaryWindow());
+		cameraSO->setPosition(Vector3(0.0f, 0.0f, 5.0f));
+		cameraSO->lookAt(Vector3(0.0f, 0.0f, 0.0f));
+
+		GameObjectHandle<FrameCounter> frameCounter = cameraSO->addComponent<FrameCounter>();
+
+		Application::instance().runMainLoop();
+
+		if (frameCounter->getNumFrames() != NUM_FRAMES)
+		{
+			LOGERR("Smoke test failed: Main loop ran for " + toString(frameCounter->getNumFrames()) + " frames, " + 
+				"expected " + toString(NUM_FRAMES) + ".");
+			result = 1;
+		}
+
+		renderableSO->destroy();
+		cameraSO->destroy();
+	}
+
+	Application::shutDown();
+
+	return result;
+}
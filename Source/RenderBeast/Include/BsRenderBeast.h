@@ -5,11 +5,13 @@
 #include "BsRenderBeastPrerequisites.h"
 #include "BsRenderer.h"
 #include "BsBounds.h"
+#include "BsBoundsArray.h"
 #include "BsRenderableElement.h"
 #include "BsSamplerOverrides.h"
 #include "BsRendererMaterial.h"
 #include "BsLightRendering.h"
 #include "BsPostProcessing.h"
+#include "BsVisibilityTree.h"
 
 namespace BansheeEngine
 {
@@ -33,6 +35,7 @@ namespace BansheeEngine
 		RenderableCore* renderable;
 		Vector<BeastRenderableElement> elements;
 		RenderableHandler* controller;
+		UINT32 visibilityNode; /**< Handle of the leaf representing the renderable in the visibility tree. */
 	};
 
 	/**	Data bound to the shader when rendering a specific renderable. */
@@ -101,6 +104,13 @@ namespace BansheeEngine
 
 			SPtr<RenderTargets> target;
 			PostProcessInfo postProcessInfo;
+
+			// Scratch buffers re-used between determineVisible() calls
+			Vector<UINT32> visibleRenderables;
+			Vector<UINT32> cullCandidates;
+			Vector<UINT32> visibilityQueryStack;
+			BoundsArray cullCandidateBounds;
+			Vector<UINT32> cullCandidateVisibility;
 		};
 
 		/**	Data used by the renderer for lights. */
@@ -188,9 +198,14 @@ namespace BansheeEngine
 		/**
 		 * Populates camera render queues by determining visible renderable object.
 		 *
-		 * @param[in]	camera	The camera to determine visibility for.
+		 * @param[in]	camera		The camera to determine visibility for.
+		 * @param[in]	cameraData	Renderer data for @p camera, whose render queues to populate.
+		 *
+		 * @note	
+		 * Core thread, or a task worker started from the core thread. Only modifies @p cameraData so it is safe to call
+		 * concurrently for different cameras.
 		 */
-		void determineVisible(const CameraCore& camera);
+		void determineVisible(const CameraCore& camera, CameraData& cameraData);
 
 		/**
 		 * Renders all objects visible by the provided camera.
@@ -274,6 +289,7 @@ namespace BansheeEngine
 		Vector<RenderableData> mRenderables;
 		Vector<RenderableShaderData> mRenderableShaderData;
 		Vector<Bounds> mWorldBounds;
+		VisibilityTree mVisibilityTree;
 
 		Vector<LightData> mDirectionalLights;
 		Vector<LightData> mPointLights;
@@ -30,6 +30,7 @@
 #include "BsRenderTargets.h"
 #include "BsRendererUtility.h"
 #include "BsRenderStateManager.h"
+#include "BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
@@ -87,6 +88,8 @@ namespace BansheeEngine
 		mRenderTargets.clear();
 		mCameraData.clear();
 		mRenderables.clear();
+		mWorldBounds.clear();
+		mVisibilityTree.clear();
 
 		PostProcessing::shutDown();
 		RenderTexturePool::shutDown();
@@ -113,6 +116,8 @@ namespace BansheeEngine
 
 		RenderableData& renderableData = mRenderables.back();
 		renderableData.renderable = renderable;
+		renderableData.visibilityNode = mVisibilityTree.add(renderableId, mWorldBounds.back().getBox(),
+			renderable->getLayer());
 
 		RenderableShaderData& shaderData = mRenderableShaderData.back();
 		shaderData.worldTransform = renderable->getTransform();
@@ -221,6 +226,8 @@ namespace BansheeEngine
 			element.samplerOverrides = nullptr;
 		}
 
+		mVisibilityTree.remove(mRenderables[renderableId].visibilityNode);
+
 		if (renderableId != lastRenderableId)
 		{
 			// Swap current last element with the one we want to erase
@@ -229,6 +236,7 @@ namespace BansheeEngine
 			std::swap(mRenderableShaderData[renderableId], mRenderableShaderData[lastRenderableId]);
 
 			lastRenerable->setRendererId(renderableId);
+			mVisibilityTree.setId(mRenderables[renderableId].visibilityNode, renderableId);
 
 			for (auto& element : elements)
 				element.renderableId = renderableId;
@@ -252,6 +260,7 @@ namespace BansheeEngine
 		shaderData.worldDeterminantSign = shaderData.worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
 
 		mWorldBounds[renderableId] = renderable->getBounds();
+		mVisibilityTree.update(mRenderables[renderableId].visibilityNode, mWorldBounds[renderableId].getBox());
 	}
 
 	void RenderBeast::notifyLightAdded(LightCore* light)
@@ -497,12 +506,39 @@ namespace BansheeEngine
 		// Update global per-frame hardware buffers
 		mStaticHandler->updatePerFrameBuffers(time);
 
-		// Generate render queues per camera
-		for (auto& cameraData : mCameraData)
+		// Generate render queues per camera. Each camera only touches its own render queues, so if there are multiple
+		// cameras their queues are generated in parallel.
+		gProfilerCPU().beginSample("DetermineVisible");
+
+		bs_frame_mark();
 		{
-			const CameraCore* camera = cameraData.first;
-			determineVisible(*camera);
+			FrameVector<std::pair<const CameraCore*, CameraData*>> visibilityCameras;
+			for (auto& cameraData : mCameraData)
+			{
+				const CameraCore* camera = cameraData.first;
+
+				bool isOverlayCamera = camera->getFlags().isSet(CameraFlag::Overlay);
+				if (isOverlayCamera)
+					continue;
+
+				visibilityCameras.push_back(std::make_pair(camera, &cameraData.second));
+			}
+
+			// This thread participates, so with a single camera nothing gets queued
+			auto determineVisibleRange = [&](UINT32 begin, UINT32 end)
+			{
+				for (UINT32 i = begin; i < end; i++)
+					determineVisible(*visibilityCameras[i].first, *visibilityCameras[i].second);
+			};
+
+			// Culling runs on worker threads, so it is sampled as a whole on this thread
+			gProfilerCPU().beginSample("FrustumCull");
+			TaskScheduler::instance().parallelFor(0, (UINT32)visibilityCameras.size(), 1, determineVisibleRange);
+			gProfilerCPU().endSample("FrustumCull");
 		}
+		bs_frame_clear();
+
+		gProfilerCPU().endSample("DetermineVisible");
 
 		// Render everything, target by target
 		for (auto& renderTargetData : mRenderTargets)
@@ -815,50 +851,52 @@ namespace BansheeEngine
 		gProfilerCPU().endSample("RenderOverlay");
 	}
 	
-	void RenderBeast::determineVisible(const CameraCore& camera)
+	void RenderBeast::determineVisible(const CameraCore& camera, CameraData& cameraData)
 	{
 		bool isOverlayCamera = camera.getFlags().isSet(CameraFlag::Overlay);
 		if (isOverlayCamera)
 			return;
 
-		CameraData& cameraData = mCameraData[&camera];
-
 		UINT64 cameraLayers = camera.getLayers();
 		ConvexVolume worldFrustum = camera.getWorldFrustum();
 
-		// Update per-object param buffers and queue render elements
-		for (auto& renderableData : mRenderables)
-		{
-			RenderableCore* renderable = renderableData.renderable;
-			UINT32 rendererId = renderable->getRendererId();
+		// Find renderables whose bounds are potentially in the frustum
+		Vector<UINT32>& visibleRenderables = cameraData.visibleRenderables;
+		Vector<UINT32>& cullCandidates = cameraData.cullCandidates;
 
-			if ((renderable->getLayer() & cameraLayers) == 0)
-				continue;
+		visibleRenderables.clear();
+		cullCandidates.clear();
+		mVisibilityTree.query(worldFrustum, cameraLayers, visibleRenderables, cullCandidates, 
+			cameraData.visibilityQueryStack);
 
-			// Do frustum culling
-			// TODO - This is bound to be a bottleneck at some point. When it is ensure that intersect
-			// methods use vector operations, as it is trivial to update them.
-			const Sphere& boundingSphere = mWorldBounds[rendererId].getSphere();
-			if (worldFrustum.intersects(boundingSphere))
-			{
-				// More precise with the box
-				const AABox& boundingBox = mWorldBounds[rendererId].getBox();
+		// Renderables only partially intersecting the frustum require a more precise test
+		cameraData.cullCandidateBounds.clear();
+		for (auto& rendererId : cullCandidates)
+			cameraData.cullCandidateBounds.add(mWorldBounds[rendererId]);
 
-				if (worldFrustum.intersects(boundingBox))
-				{
-					float distanceToCamera = (camera.getPosition() - boundingBox.getCenter()).length();
+		worldFrustum.intersectsBatch(cameraData.cullCandidateBounds, cameraData.cullCandidateVisibility);
 
-					for (auto& renderElem : renderableData.elements)
-					{
-						bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+		UINT32 numCandidates = (UINT32)cullCandidates.size();
+		for (UINT32 i = 0; i < numCandidates; i++)
+		{
+			if ((cameraData.cullCandidateVisibility[i / 32] & (1U << (i % 32))) != 0)
+				visibleRenderables.push_back(cullCandidates[i]);
+		}
 
-						if (isTransparent)
-							cameraData.transparentQueue->add(&renderElem, distanceToCamera);
-						else
-							cameraData.opaqueQueue->add(&renderElem, distanceToCamera);
-					}
+		// Queue render elements
+		for (auto& rendererId : visibleRenderables)
+		{
+			RenderableData& renderableData = mRenderables[rendererId];
+			float distanceToCamera = (camera.getPosition() - mWorldBounds[rendererId].getBox().getCenter()).length();
 
-				}
+			for (auto& renderElem : renderableData.elements)
+			{
+				bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+
+				if (isTransparent)
+					cameraData.transparentQueue->add(&renderElem, distanceToCamera);
+				else
+					cameraData.opaqueQueue->add(&renderElem, distanceToCamera);
 			}
 		}
 